@@ -0,0 +1,55 @@
+include_guard(GLOBAL)
+
+# ---------------------------------------------------------------------------
+# String Keys
+# ---------------------------------------------------------------------------
+
+# Writes resources/stringkeys.hpp into the build directory, with a StringID
+# for every key in dat/strings.json, so that code which looks up the same
+# string every frame can go straight to it by index rather than hashing its
+# name. CMake is re-run (and the header rewritten) whenever strings.json is
+# changed, though the header is only touched if the keys themselves differ.
+
+set(SORCERY_STRINGS_JSON "${CMAKE_SOURCE_DIR}/dat/strings.json")
+set(SORCERY_GENERATED_INC "${CMAKE_BINARY_DIR}/inc")
+
+set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS
+	"${SORCERY_STRINGS_JSON}"
+)
+
+file(READ "${SORCERY_STRINGS_JSON}" _strings_json)
+string(JSON _strings_count LENGTH "${_strings_json}")
+math(EXPR _strings_last "${_strings_count} - 1")
+
+set(_string_ids "")
+set(_string_keys "")
+foreach(_index RANGE ${_strings_last})
+	string(JSON _key MEMBER "${_strings_json}" ${_index})
+	string(APPEND _string_ids "\t${_key},\n")
+	string(APPEND _string_keys "\t\"${_key}\",\n")
+endforeach()
+
+MESSAGE("Generating ${_strings_count} String Keys from dat/strings.json")
+
+file(CONFIGURE
+	OUTPUT "${SORCERY_GENERATED_INC}/resources/stringkeys.hpp"
+	CONTENT "// Generated from dat/strings.json by StringKeys.cmake - do not edit
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace Sorcery {
+
+enum class StringID : std::uint16_t {
+@_string_ids@};
+
+inline constexpr std::array<std::string_view, @_strings_count@> STRING_KEYS{
+@_string_keys@};
+
+}
+"
+	@ONLY
+)
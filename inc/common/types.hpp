@@ -27,7 +27,9 @@
 #include <ostream>
 #include <print>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "common/cereal.hpp"
@@ -36,6 +38,21 @@
 
 namespace Sorcery {
 
+// Transparent hash so string-keyed maps can be probed with a string_view
+// without building a temporary std::string
+struct StringHash {
+
+		using is_transparent = void;
+
+		auto operator()(std::string_view value) const noexcept -> std::size_t {
+			return std::hash<std::string_view>{}(value);
+		}
+};
+
+template <typename T>
+using StringMap =
+	std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
 struct Rect {
 
 		// Struct to represent a rect on the screen
@@ -25,6 +25,7 @@
 #include <atomic>
 #include <chrono>
 #include <mutex>
+#include <random>
 #include <thread>
 #include <vector>
 
@@ -32,12 +33,12 @@
 
 namespace Sorcery {
 
-class Random;
-
+// The wallpaper and attract mode pick their sprites with an engine of their
+// own: they run on wall-clock timers in their own threads, and so must never
+// draw from the game's RNG, which a replay seeds and relies upon
 class Animation {
 	public:
-		Animation(Random *random);
-		Animation() = delete;
+		Animation();
 		~Animation();
 
 		double lerp;
@@ -62,7 +63,8 @@ class Animation {
 		auto get_attract_data() -> std::vector<unsigned int>;
 
 	private:
-		Random *_random;
+		std::mt19937_64 _random;
+		std::mutex _random_mutex;
 		std::jthread _attract_th;
 		std::jthread _colcyc_th;
 		std::jthread _wallpaper_th;
@@ -88,6 +90,8 @@ class Animation {
 		auto _do_attract() -> void;
 		auto _do_colcyc() -> void;
 		auto _do_wp() -> void;
+		auto _roll(const unsigned int min, const unsigned int max)
+			-> unsigned int;
 };
 
 }
\ No newline at end of file
@@ -45,6 +45,8 @@ class EdgeOfTown;
 class Engine;
 class Game;
 class MainMenu;
+class Replay;
+class Snapshots;
 class Resources;
 class Splash;
 class System;
@@ -127,6 +129,7 @@ class Application {
 		auto _build_startup_plan() -> StartupPlan;
 		auto _add_quickstart_party() -> void;
 		auto _check_param(std::string_view param) const -> bool;
+		auto _start_replay() -> void;
 		auto _load_existing_game() -> void;
 		auto _start_new_game(const bool quickstart) -> void;
 		auto _continue_existing_game() -> int;
@@ -137,6 +140,7 @@ class Application {
 		// Private Members
 		std::vector<std::string> _args;
 		std::unique_ptr<System> _system;
+		std::unique_ptr<Replay> _replay;
 		std::unique_ptr<Resources> _resources;
 		std::unique_ptr<Display> _display;
 		std::unique_ptr<Controller> _controller;
@@ -144,6 +148,7 @@ class Application {
 		std::unique_ptr<MainMenu> _main_menu;
 		std::unique_ptr<Splash> _splash;
 		std::unique_ptr<Game> _game;
+		std::unique_ptr<Snapshots> _snapshots;
 		std::unique_ptr<Castle> _castle;
 		std::unique_ptr<EdgeOfTown> _edge_of_town;
 		std::unique_ptr<Engine> _engine;
@@ -22,7 +22,11 @@
 
 #pragma once
 
+#include "core/packedinput.hpp"
+#include "resources/resourcepack.hpp"
+
 #include <SDL2/SDL_audio.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,7 +43,7 @@ class AudioPlayer {
 		AudioPlayer();
 		~AudioPlayer();
 
-		void load(const std::string &filename);
+		void load(const Resource &resource);
 		void play();
 		void stop();
 		void update(); // call every frame
@@ -56,6 +60,7 @@ class AudioPlayer {
 		AVPacket *_packet = nullptr;
 		AVFrame *_frame = nullptr;
 		SwrContext *_swr = nullptr;
+		std::unique_ptr<PackedInput> _input;
 
 		int _stream_index = -1;
 
@@ -0,0 +1,83 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Sorcery {
+
+// Which thread a Bootstrap phase runs on - anything that touches SDL, OpenGL
+// or ImGui must stay on the main thread
+enum class BootstrapLane {
+	MAIN,
+	WORKER
+};
+
+// Small dependency graph used to build the Application. Phases are added in
+// dependency order (a phase may only depend upon phases added before it), and
+// run() then starts every worker phase immediately on its own thread (each
+// waiting only upon its own dependencies) whilst the main phases are run in
+// order on the calling thread
+class Bootstrap {
+
+	public:
+		using clock = std::chrono::steady_clock;
+
+		Bootstrap();
+
+		// Public Methods
+		auto add(std::string_view name, const BootstrapLane lane,
+				 std::vector<std::string> depends, std::function<void()> task)
+			-> void;
+		auto run() -> void;
+		auto report() const -> std::string;
+
+	private:
+		struct Phase {
+				std::string name;
+				BootstrapLane lane;
+				std::vector<std::size_t> depends;
+				std::function<void()> task;
+				std::shared_future<void> done;
+				clock::time_point queued;
+				clock::time_point started;
+				clock::time_point finished;
+		};
+
+		// Private Methods
+		auto _find(std::string_view name) const -> std::size_t;
+		auto _execute(Phase &phase) -> void;
+		auto _wait(const Phase &phase) const -> void;
+
+		// Private Members
+		std::vector<Phase> _phases;
+		clock::time_point _start;
+		clock::time_point _finish;
+};
+
+}
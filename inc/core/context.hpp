@@ -22,11 +22,17 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 #include <string_view>
 
 #include "common/enum.hpp"
+#include "core/controlkey.hpp"
+#include "types/componenthandle.hpp"
+
+union SDL_Event;
 
 namespace Sorcery {
 
@@ -42,13 +48,20 @@ class ImageStore;
 class ComponentStore;
 class Animation;
 class AudioPlayer;
+class BakedFile;
 class StringStore;
 class Random;
+class Replay;
 class System;
 class UI;
 class Application;
 class MenuBuilder;
+class OverlayStack;
 class SaveStore;
+class SaveWriter;
+class Snapshots;
+struct Resource;
+enum class StringID : std::uint16_t;
 
 // Context struct for simplying DI
 struct Context {
@@ -62,29 +75,40 @@ struct Context {
 		Game *game = nullptr;
 		Animation *animation = nullptr;
 		AudioPlayer *audio = nullptr;
+		BakedFile *baked = nullptr;
 		Config *config = nullptr;
 		FileStore *files = nullptr;
 		Random *random = nullptr;
+		Replay *replay = nullptr;
 		StringStore *strings = nullptr;
 		ComponentStore *components = nullptr;
 		FontStore *fonts = nullptr;
 		ImageStore *images = nullptr;
 		MenuBuilder *menubuilder = nullptr;
+		OverlayStack *overlays = nullptr;
 		SaveStore *saves = nullptr;
+		SaveWriter *writer = nullptr;
+		Snapshots *snapshots = nullptr;
 
 		// Helpers
 		auto get_random(const Enums::System::Random random_type)
 			-> unsigned int;
 		auto get_string(std::string_view key) -> std::string;
+		auto get_text(std::string_view key) const -> std::string_view;
+		auto get_text(const StringID id) const -> std::string_view;
 		auto get_config(const unsigned int i) -> bool &;
 		auto get_config(std::string_view section, std::string_view value) const
 			-> std::string;
 		auto get_directory(std::string_view key) const -> std::filesystem::path;
 		auto get_file(std::string_view key) const -> std::filesystem::path;
+		auto get_resource(std::string_view key) const -> Resource;
+		auto get_component(const ComponentHandle &handle) -> Component &;
 		auto get_component(std::string_view combined_key) -> Component &;
-		auto get_flag_ref(const std::string &flag) -> bool &;
-		auto get_flag(const std::string &flag) -> bool;
-		auto get_selected(const std::string &flag) const -> int;
+		auto get_flag_ref(const ControlKey &flag) -> bool &;
+		auto get_flag(const ControlKey &flag) -> bool;
+		auto get_selected(const ControlKey &flag) const -> int;
+		auto poll_event(SDL_Event &event) -> bool;
+		auto now() const -> std::chrono::steady_clock::time_point;
 
 		auto tick() -> void;
 };
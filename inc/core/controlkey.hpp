@@ -0,0 +1,44 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "types/internedid.hpp"
+
+#include <cstddef>
+
+namespace Sorcery {
+
+// The name of a Controller flag, text or selection interned into a dense
+// process-wide id, so that the Controller can keep them in flat arrays. The
+// names themselves are only needed for serialisation and the debug dump
+struct ControlTag {
+		static constexpr std::size_t CAPACITY{256};
+		static constexpr auto NAME{"control"};
+};
+using ControlKey = InternedId<ControlTag>;
+
+}
+
+// A literal flag/text/selection name, interned at startup
+#define CONTROL(key) (Sorcery::interned<Sorcery::ControlTag, key>)
\ No newline at end of file
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <map>
 #include <memory>
@@ -31,6 +32,7 @@
 #include <vector>
 
 #include "common/enum.hpp"
+#include "core/controlkey.hpp"
 #include "core/enum.hpp"
 
 union SDL_Event;
@@ -43,6 +45,7 @@ class Game;
 class UI;
 class Character;
 struct MenuAction;
+class Overlay;
 
 // UI Interaction Logic Controller
 class Controller {
@@ -52,11 +55,23 @@ class Controller {
 		Controller(Context &ctx);
 		Controller() = default;
 
-		// Serialisation
-		template <class Archive> auto serialize(Archive &archive) -> void {
-			archive(_selected, _busy, _last_screen, _last_event, _last_dir,
+		// Serialisation (flags, texts and selections are written by name, as
+		// the ids they have are only valid for the current run)
+		template <class Archive> auto save(Archive &archive) const -> void {
+			archive(_selected_by_name(), _busy, _last_screen, _last_event,
+					_last_dir, _can_undo, _fullscreen, _candidate_party,
+					_screen, _characters, _flags_by_name(), _texts_by_name(),
+					_monochrome);
+		}
+
+		template <class Archive> auto load(Archive &archive) -> void {
+			std::map<std::string, int> selected{};
+			std::map<std::string, bool> flags{};
+			std::map<std::string, std::string> texts{};
+			archive(selected, _busy, _last_screen, _last_event, _last_dir,
 					_can_undo, _fullscreen, _candidate_party, _screen,
-					_characters, _flags, _texts, _monochrome);
+					_characters, flags, texts, _monochrome);
+			_restore_by_name(selected, flags, texts);
 		}
 
 		// Overloaded Operator
@@ -66,7 +81,7 @@ class Controller {
 		// Public Methods
 		auto check_for_abort(const SDL_Event event) -> bool;
 		auto check_for_back(const SDL_Event event) -> bool;
-		auto check_for_back(const SDL_Event event, bool &flag) -> void;
+		auto check_for_back(const SDL_Event event, Overlay &flag) -> void;
 		auto check_for_debug(const SDL_Event event) -> void;
 		auto check_for_automap(const SDL_Event event) -> bool;
 		auto check_for_movement(const SDL_Event event) -> int;
@@ -75,6 +90,7 @@ class Controller {
 		auto check_for_quick_inspect(const SDL_Event event) -> int;
 		auto check_for_resize(const SDL_Event event, UI *ui) -> void;
 		auto check_for_ui_toggle(const SDL_Event event) -> void;
+		auto check_for_undo(const SDL_Event event) -> bool;
 		auto handle_button_click(const std::string &component, UI *ui,
 								 const int data) -> void;
 		auto handle_input_button_click(const std::string &component, UI *ui,
@@ -93,23 +109,23 @@ class Controller {
 		auto get_character(const Enums::CharacterSlot flag) const -> int;
 		auto set_character(const Enums::CharacterSlot flag, const int value)
 			-> void;
-		auto set_selected(const std::string &flag, int value) -> void;
-		auto get_flag(const std::string &flag) const -> bool;
-		auto get_flag_ref(const std::string &flag) -> bool &;
-		auto set_flag(const std::string &flag) -> void;
-		auto set_flag_value(const std::string &flag, const bool value) -> void;
-		auto unset_flag(const std::string &flag) -> void;
-		auto has_flag(const std::string &flag) const -> bool;
-		auto toggle_flag(const std::string &flag) -> void;
+		auto set_selected(const ControlKey &flag, int value) -> void;
+		auto get_flag(const ControlKey &flag) const -> bool;
+		auto get_flag_ref(const ControlKey &flag) -> bool &;
+		auto set_flag(const ControlKey &flag) -> void;
+		auto set_flag_value(const ControlKey &flag, const bool value) -> void;
+		auto unset_flag(const ControlKey &flag) -> void;
+		auto has_flag(const ControlKey &flag) const -> bool;
+		auto toggle_flag(const ControlKey &flag) -> void;
 		auto get_flags() const -> std::string;
 		auto get_characters() const -> std::string;
-		auto has_text(const std::string &flag) const -> bool;
-		auto set_text(const std::string &flag, const std::string &text) -> void;
-		auto get_text(const std::string &flag) const -> const std::string;
-		auto unset_text(const std::string &flag) -> void;
-		auto has_selected(const std::string &flag) const -> bool;
-		auto get_selected(const std::string &flag) const -> int;
-		auto unset_selected(const std::string &flag) -> void;
+		auto has_text(const ControlKey &flag) const -> bool;
+		auto set_text(const ControlKey &flag, const std::string &text) -> void;
+		auto get_text(const ControlKey &flag) const -> const std::string &;
+		auto unset_text(const ControlKey &flag) -> void;
+		auto has_selected(const ControlKey &flag) const -> bool;
+		auto get_selected(const ControlKey &flag) const -> int;
+		auto unset_selected(const ControlKey &flag) -> void;
 
 		auto set_monochrome(const bool value) -> void;
 		auto get_monochrome() const -> bool;
@@ -144,20 +160,20 @@ class Controller {
 		auto want_to_leave_game() -> bool &;
 		auto clear_modal_flags() -> void;
 
-		auto execute_action(const MenuAction &action, int data,
-							std::vector<std::reference_wrapper<bool>> &ui_flags)
-			-> void;
+		auto execute_action(
+			const MenuAction &action, int data,
+			std::vector<std::reference_wrapper<Overlay>> &ui_flags) -> void;
 
 		auto handle_standard_menu(std::string_view component,
 								  const std::vector<std::string> &items,
 								  const int data, const int selection) -> void;
 		auto handle_action_table_menu(
 			std::string_view menu, int selection, int data,
-			std::vector<std::reference_wrapper<bool>> &ui_flags) -> bool;
+			std::vector<std::reference_wrapper<Overlay>> &ui_flags) -> bool;
 		auto handle_dynamic_menu(
 			std::string_view, const std::vector<std::string> &items,
 			const int data, const int selection,
-			std::vector<std::reference_wrapper<bool>> in_flags) -> bool;
+			std::vector<std::reference_wrapper<Overlay>> in_flags) -> bool;
 
 		auto inspect_party_member(const int character_id) -> void;
 		auto handle_icon_click(const int icon_idx) -> void;
@@ -170,6 +186,16 @@ class Controller {
 		bool go_back;
 
 	private:
+		// Private Methods
+		auto _clear_controls() -> void;
+		auto _flags_by_name() const -> std::map<std::string, bool>;
+		auto _texts_by_name() const -> std::map<std::string, std::string>;
+		auto _selected_by_name() const -> std::map<std::string, int>;
+		auto _restore_by_name(const std::map<std::string, int> &selected,
+							  const std::map<std::string, bool> &flags,
+							  const std::map<std::string, std::string> &texts)
+			-> void;
+
 		// Private Members
 		Context &_ctx;
 		Enums::Screen _screen;
@@ -187,9 +213,9 @@ class Controller {
 		Enums::Map::Event _last_event;				// Last event in dungeon
 		Enums::Map::Direction _last_dir;			// Last movement in dungeon
 		std::map<Enums::CharacterSlot, int> _characters; // Character Selections
-		std::map<std::string, bool> _flags;				 // Logic Flags
-		std::map<std::string, std::string> _texts;		 // "Global" Texts
-		std::map<std::string, int> _selected;			 // Menu Selections
+		std::array<bool, ControlKey::CAPACITY> _flags;		  // Logic Flags
+		std::array<std::string, ControlKey::CAPACITY> _texts; // "Global" Texts
+		std::array<int, ControlKey::CAPACITY> _selected;	  // Menu Selections
 		std::string _input_buffer; // Input Buffer for Text Input
 		std::optional<int> _menu_key;
 };
@@ -0,0 +1,77 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace Sorcery {
+
+// Watches data files for changes (using inotify where available, and otherwise
+// - or for any file that it can't watch - by polling their modification times)
+// on a background thread. When a file changes its reparse callback is run on
+// that thread, and its commit callback is then run on the main thread at the
+// next call to update(), which is made once per frame, so that lookups never
+// need to touch the file system
+class FileWatcher {
+
+	public:
+		FileWatcher();
+		~FileWatcher();
+		FileWatcher(const FileWatcher &) = delete;
+		auto operator=(const FileWatcher &) -> FileWatcher & = delete;
+
+		auto watch(const std::filesystem::path &file,
+				   std::function<void()> reparse, std::function<void()> commit)
+			-> void;
+		auto update() -> void;
+		auto stop() -> void;
+
+	private:
+		struct Watch {
+				std::filesystem::path file;
+				std::filesystem::file_time_type modified;
+				int descriptor;
+				std::function<void()> reparse;
+				std::function<void()> commit;
+				bool pending;
+		};
+
+		auto _run(std::stop_token stop) -> void;
+		auto _wait_for_changes(std::stop_token stop)
+			-> std::vector<std::filesystem::path>;
+		auto _poll_for_changes() -> std::vector<std::filesystem::path>;
+
+		int _inotify;
+		std::mutex _mutex;
+		std::vector<Watch> _watches;
+		std::atomic<bool> _pending;
+		std::jthread _thread;
+};
+
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "common/imgui.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Sorcery {
+
+class Component;
+
+// The pixel geometry needed to turn grid units into screen positions
+struct LayoutMetrics {
+		ImVec2 origin;
+		ImVec2 cell;
+		ImVec2 viewport;
+		float font_sz;
+};
+
+// Where a Component ends up on screen at the current resolution. Axes that
+// are centred (x or y of -1 in the layout) can only be resolved once the size
+// of whatever is drawn there is known, so that is measured by the first draw
+// and kept in content until the cache is next invalidated
+struct Placement {
+		long id;
+		ImVec2 pos;
+		ImVec2 size;
+		ImVec2 adjust;
+		ImVec2 content;
+		float font_sz;
+		float wrap;
+		bool centre_x;
+		bool centre_y;
+		bool measured;
+};
+
+// Every Component's Placement in one array (indexed by Component::slot),
+// rebuilt only when the window is resized or the layout is reloaded
+class LayoutCache {
+
+	public:
+		LayoutCache();
+
+		auto resolve(std::span<const Component> components,
+					 const LayoutMetrics &metrics, std::uint64_t generation)
+			-> void;
+		auto is_current(std::uint64_t generation) const -> bool;
+		auto invalidate() -> void;
+		auto forget_content() -> void;
+		auto find(const Component *component) -> Placement *;
+		auto place(const Component *component) const -> Placement;
+		auto origin(const Placement &placement, const ImVec2 content) const
+			-> ImVec2;
+
+	private:
+		std::vector<Placement> _placements;
+		LayoutMetrics _metrics;
+		std::uint64_t _generation;
+		bool _valid;
+};
+
+}
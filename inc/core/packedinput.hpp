@@ -0,0 +1,57 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+struct AVFormatContext;
+struct AVIOContext;
+
+namespace Sorcery {
+
+// Custom FFmpeg I/O so that audio and video can be demuxed directly from a
+// span of the mapped resource pack rather than from a file. This must outlive
+// the AVFormatContext that is opened with it
+class PackedInput {
+
+	public:
+		explicit PackedInput(std::span<const std::byte> data);
+		~PackedInput();
+		PackedInput(const PackedInput &) = delete;
+		auto operator=(const PackedInput &) -> PackedInput & = delete;
+
+		auto open(AVFormatContext **format) -> int;
+
+	private:
+		static auto _read(void *opaque, std::uint8_t *buffer, int size) -> int;
+		static auto _seek(void *opaque, std::int64_t offset, int whence)
+			-> std::int64_t;
+
+		std::span<const std::byte> _data;
+		std::int64_t _position;
+		AVIOContext *_io;
+};
+
+}
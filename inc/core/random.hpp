@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <random>
 #include <string>
@@ -42,6 +43,7 @@ class Random {
 		auto get(const unsigned int min, const unsigned int max)
 			-> unsigned int;
 		auto get(const Enums::System::Random random_type) -> unsigned int;
+		auto seed(const std::uint64_t value) -> void;
 
 	private:
 		std::random_device _device;
@@ -0,0 +1,134 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Sorcery {
+
+struct Context;
+
+enum class ReplayMode {
+	OFF,
+	RECORD,
+	PLAY
+};
+
+// Records a session as the input events polled in each frame, together with
+// how long each frame took and the RNG seeds, saves, log journal and settings
+// that it started from,
+// and plays one back through the same game logic. Whilst recording or playing
+// game time only advances once per frame, so that anything timed (fades,
+// delayed map transitions, transient messages) lasts exactly as many frames
+// on playback. Playback is unpaced, and checks digests of the game state every
+// CHECKPOINT_INTERVAL frames to find where it diverges. It is not headless: as
+// the game logic is driven from the UI, it still needs a (hidden) window, a GL
+// context and ImGui frames, but nothing is shown, heard or synced to vblank
+class Replay {
+
+	public:
+		using clock = std::chrono::steady_clock;
+
+		explicit Replay(Context &ctx);
+		~Replay();
+
+		Replay(const Replay &) = delete;
+		auto operator=(const Replay &) -> Replay & = delete;
+
+		// Public Methods
+		auto record(const std::filesystem::path &path,
+					std::vector<std::string> args) -> void;
+		auto play(const std::filesystem::path &path) -> void;
+		auto mode() const noexcept -> ReplayMode;
+		auto hidden() const noexcept -> bool;
+		auto finished() const noexcept -> bool;
+		auto failed() const noexcept -> bool;
+		auto args() const -> const std::vector<std::string> &;
+		auto save_file() const -> std::filesystem::path;
+		auto characters_directory() const -> std::filesystem::path;
+
+		auto poll(SDL_Event &event) -> bool;
+		auto now() const -> clock::time_point;
+		auto frame_delta() const noexcept -> float;
+		auto tick() -> void;
+
+		// For the terminate handler, so that a recording survives a crash
+		static auto flush_recording() -> void;
+
+		// Frames between state digests (about five seconds at 60Hz)
+		static constexpr std::uint64_t CHECKPOINT_INTERVAL{300};
+
+	private:
+		struct Frame {
+				std::uint64_t elapsed;
+				std::vector<SDL_Event> events;
+				std::uint64_t game_digest;
+				std::uint64_t controller_digest;
+		};
+
+		// Private Methods
+		auto _capture(const SDL_Event &event) -> void;
+		auto _deliver(SDL_Event &event) -> void;
+		auto _digest(std::uint64_t &game, std::uint64_t &controller) const
+			-> void;
+		auto _is_checkpoint() const noexcept -> bool;
+		auto _read_frame() -> bool;
+		auto _write_frame(const std::uint64_t elapsed) -> void;
+		auto _fail(std::string_view reason) -> void;
+		auto _finish() -> void;
+		auto _flush() -> void;
+
+		// Private Members
+		Context &_ctx;
+		ReplayMode _mode;
+		std::vector<std::string> _args;
+		std::filesystem::path _sandbox;
+		std::ofstream _out;
+		std::string _buffer;
+		std::string _data;
+		std::size_t _position;
+		Frame _frame;
+		std::size_t _next_event;
+		std::string _pending;
+		std::uint64_t _pending_count;
+		std::uint64_t _frame_index;
+		std::uint64_t _event_count;
+		std::uint64_t _checkpoints;
+		std::uint64_t _elapsed;
+		std::uint64_t _last_elapsed;
+		clock::time_point _start;
+		bool _finished;
+		bool _failed;
+
+		static inline Replay *_s_recording{nullptr};
+};
+
+}
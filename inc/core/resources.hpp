@@ -32,17 +32,26 @@ class LevelStore;
 class MonsterStore;
 class SpellStore;
 class SaveStore;
+class SaveWriter;
 class Resources {
 
 	public:
-		Resources(Context &ctx);
+		Resources(Context &ctx, const bool deferred = false);
 		~Resources();
 
+		// Individual loaders (used directly by the Bootstrap when deferred)
+		auto load_items() -> void;
+		auto load_levels() -> void;
+		auto load_monsters() -> void;
+		auto load_spells() -> void;
+		auto load_saves() -> void;
+
 		std::unique_ptr<ItemStore> items;
 		std::unique_ptr<LevelStore> levels;
 		std::unique_ptr<MonsterStore> monsters;
 		std::unique_ptr<SpellStore> spells;
 		std::unique_ptr<SaveStore> saves;
+		std::unique_ptr<SaveWriter> writer;
 
 	private:
 		Context &_ctx;
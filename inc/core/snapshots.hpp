@@ -0,0 +1,91 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace Sorcery {
+
+struct Context;
+
+// Binary snapshots kept in memory. The engine takes one at the start of every
+// turn into a ring of the last CAPACITY turns, which can then be rewound one
+// or more turns at a time - but only as far as the Controller says a turn can
+// be undone, as anything before a turn that couldn't be is forgotten. These
+// are only what a turn of movement can change (the party, where it is and
+// the current floor), and only the newest is kept whole; each older one is
+// kept as just the bytes that differ from the one after it, which for a turn
+// of movement is very little. Separately, a quicksave of the whole Game and
+// Controller is kept in memory so that quickloading it is immediate, and is
+// written to disc on a background thread (unless persist is turned off)
+class Snapshots {
+
+	public:
+		explicit Snapshots(Context &ctx);
+		~Snapshots();
+		Snapshots(const Snapshots &) = delete;
+		auto operator=(const Snapshots &) -> Snapshots & = delete;
+
+		// Public Methods
+		auto take() -> void;
+		auto rewind(std::size_t turns = 1) -> bool;
+		auto clear() -> void;
+		auto size() const noexcept -> std::size_t;
+		auto bytes() const noexcept -> std::size_t;
+		auto save(const std::filesystem::path &path) -> bool;
+		auto load(const std::filesystem::path &path) -> bool;
+		auto wait() -> void;
+
+		static constexpr std::size_t CAPACITY{64};
+
+		// Public Members
+		bool persist;
+
+	private:
+		struct Snapshot {
+				bool whole;
+				std::string data;
+		};
+
+		// Private Methods
+		auto _serialise() const -> std::string;
+		auto _serialise_turn() const -> std::string;
+		auto _restore(const std::string &data) -> void;
+		auto _restore_turn(const std::string &data) -> void;
+
+		// Private Members
+		Context &_ctx;
+		std::deque<Snapshot> _ring;
+		std::shared_ptr<const std::string> _quick;
+		std::filesystem::path _quick_path;
+		std::jthread _flush;
+};
+
+}
@@ -32,8 +32,10 @@ namespace Sorcery {
 struct Context;
 class Animation;
 class AudioPlayer;
+class BakedFile;
 class Config;
 class FileStore;
+class FileWatcher;
 class StringStore;
 class Random;
 
@@ -54,8 +56,10 @@ class System {
 
 		std::unique_ptr<Animation> animation;
 		std::unique_ptr<AudioPlayer> audio;
+		std::unique_ptr<BakedFile> baked;
 		std::unique_ptr<Config> config;
 		std::unique_ptr<FileStore> files;
+		std::unique_ptr<FileWatcher> watcher;
 		std::unique_ptr<StringStore> strings;
 		std::unique_ptr<Random> random;
 
@@ -27,6 +27,8 @@ using GLuint = unsigned int;
 #include "common/enum.hpp"
 #include "common/imgui.hpp"
 #include "core/enum.hpp"
+#include "core/layoutcache.hpp"
+#include "gui/menukey.hpp"
 #include "types/enum.hpp"
 
 #include <any>
@@ -59,6 +61,8 @@ class Message;
 class Menu;
 class MenuBuilder;
 class Modal;
+class Overlay;
+class OverlayStack;
 class Render;
 class Popup;
 struct Tile;
@@ -85,8 +89,9 @@ struct TransientMessage {
 class UI {
 
 	public:
-		// Standard Constructor
-		UI(Context &ctx);
+		// Standard Constructor (layout is loaded ahead of time as part of the
+		// Bootstrap since it doesn't need the OpenGL context)
+		UI(Context &ctx, std::unique_ptr<ComponentStore> layout);
 
 		// standard Destructor
 		~UI();
@@ -103,7 +108,7 @@ class UI {
 						const ImVec2 p_min, const ImVec2 p_sz) -> void;
 		auto draw_view_image(std::string_view source, const VertexArray &array)
 			-> void;
-		auto draw_menu(const std::string name, const ImColor sel_colour,
+		auto draw_menu(const MenuKey &key, const ImColor sel_colour,
 					   const ImVec2 pos, const ImVec2 sz,
 					   const Enums::Layout::Font font,
 					   std::vector<std::string> &items, std::vector<int> &data,
@@ -139,6 +144,9 @@ class UI {
 		auto base_font_sz() const noexcept -> float;
 		auto columns() const noexcept -> unsigned int;
 		auto rows() const noexcept -> unsigned int;
+		auto placement(const Component *component) -> Placement;
+		auto layout_origin(const Placement &placement,
+						   const ImVec2 content) const -> ImVec2;
 
 		auto show_transient(
 			std::string text,
@@ -156,6 +164,9 @@ class UI {
 
 		std::unique_ptr<MenuBuilder> menubuilder;
 
+		// Must outlive every widget below, since they unlink themselves from it
+		std::unique_ptr<OverlayStack> overlays;
+
 		std::unique_ptr<Dialog> dialog_exit;
 		std::unique_ptr<Dialog> dialog_new;
 		std::unique_ptr<Dialog> dialog_leave;
@@ -193,8 +204,8 @@ class UI {
 		unsigned int frame_rd;
 		unsigned int ui_rd;
 		ImVec4 ui_colour;
-		std::map<std::string, int> selected;
-		std::map<std::string, int> highlighted;
+		std::array<int, MenuKey::CAPACITY> selected;
+		std::array<int, MenuKey::CAPACITY> highlighted;
 		std::map<std::string, bool> pressed;
 		std::array<bool, 21> ms_selected;
 		std::array<bool, 29> ps_selected;
@@ -221,6 +232,8 @@ class UI {
 		unsigned int _grid_sz;
 		float _font_sz;
 		float _base_font_sz;
+		LayoutCache _layout_cache;
+		std::uint64_t _strings_generation;
 		static constexpr unsigned int _columns{60};
 		static constexpr unsigned int _rows{35};
 		static constexpr unsigned int _base_width{1024};
@@ -228,6 +241,8 @@ class UI {
 		std::optional<TransientMessage> _transient_message;
 
 		// Private Methods
+		auto _text_origin(const Component *component, Placement &placement,
+						  std::string_view text) -> ImVec2;
 		auto _display_atlas() -> void;
 		auto _display_bestiary() -> void;
 		auto _display_compendium() -> void;
@@ -283,13 +298,13 @@ class UI {
 		auto _display_license(const std::string &string) -> void;
 
 		auto _draw_attract_mode() -> void;
-		auto _draw_tiled_bg(Component *component) -> void;
+		auto _draw_tiled_bg(const Component *component) -> void;
 		auto _draw_bg_image(Component *component) -> void;
 		auto _draw_bg_video() -> void;
 
 		auto _draw_buffbar() -> void;
 		auto _draw_buy() -> void;
-		auto _draw_button(Component *component,
+		auto _draw_button(const Component *component,
 						  std::optional<bool *> is_clicked = std::nullopt)
 			-> void;
 		auto _draw_button_click(Component *component, bool &is_clicked,
@@ -315,7 +330,7 @@ class UI {
 			-> void;
 		auto _draw_current_character(const int mode) -> void;
 		auto _draw_cursor() -> void;
-		auto _draw_fg_image(Component *component) -> void;
+		auto _draw_fg_image(const Component *component) -> void;
 		auto _draw_fg_image_with_idx(std::string_view source, const int idx,
 									 const ImVec2 p_min, const ImVec2 p_sz,
 									 const ImVec4 tint = ImVec4{
@@ -325,7 +340,7 @@ class UI {
 									 const ImVec2 p_min, const ImVec2 p_sz,
 									 const ImVec4 tint = ImVec4{
 										 1.0f, 1.0f, 1.0f, 1.0f}) -> void;
-		auto _draw_frame(Component *component) -> void;
+		auto _draw_frame(const Component *component) -> void;
 		auto _draw_heal(const int stage) -> void;
 		auto _draw_rite(const int stage) -> void;
 		auto _draw_icons() -> void;
@@ -342,10 +357,10 @@ class UI {
 		auto _draw_level_up(const int mode) -> void;
 		auto _draw_map_tile(const Tile &tile, const ImVec2 pos, const ImVec2 sz)
 			-> void;
-		auto _draw_menu(Component *component) -> void;
+		auto _draw_menu(const Component *component) -> void;
 		auto _draw_monster_info() -> void;
 		auto _draw_no_level_up(const int mode) -> void;
-		auto _draw_paragraph(Component *component) -> void;
+		auto _draw_paragraph(const Component *component) -> void;
 		auto _draw_party_panel() -> void;
 		auto _draw_pay_info() -> void;
 		auto _draw_options() -> void;
@@ -359,12 +374,11 @@ class UI {
 		auto _draw_spell_info() -> void;
 		auto _draw_stepper(Component *component, const std::string &name,
 						   int *value) -> void;
-		auto _draw_text(Component *component) -> void;
-		auto _draw_text(Component *component, const std::string &string)
+		auto _draw_text(const Component *component) -> void;
+		auto _draw_text(const Component *component, const std::string &string)
 			-> void;
 		auto _draw_uncurse() -> void;
 		auto _get_status_color(Character *character) const -> ImVec4;
-		auto _get_popups() const -> std::string;
 		auto _setup_windows() -> void;
 
 		auto _draw_debug() -> void;
@@ -376,13 +390,13 @@ class UI {
 		auto _mage_spell_index(Enums::Magic::SpellID id) -> std::size_t;
 		auto _priest_spell_index(Enums::Magic::SpellID id) -> std::size_t;
 
-		auto _popup_states() const -> std::vector<bool *>;
+		auto _bind_overlays() -> void;
 
 		auto _activate_menu_item(const std::string_view name,
 								 const int selection, const int data_item,
 								 const std::vector<std::string> &items) -> void;
 		auto _get_legacy_menu_ui_flags(const std::string_view name)
-			-> std::vector<std::reference_wrapper<bool>>;
+			-> std::vector<std::reference_wrapper<Overlay>>;
 		auto _handle_menu_reordering(const std::string_view name,
 									 std::vector<std::string> &items,
 									 std::vector<int> &data,
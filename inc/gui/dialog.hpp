@@ -23,6 +23,7 @@
 #pragma once
 
 #include "common/enum.hpp"
+#include "gui/overlay.hpp"
 #include "types/enum.hpp"
 
 #include <string>
@@ -44,7 +45,7 @@ class Dialog {
 		auto id() const -> std::string;
 		auto name() const -> std::string;
 
-		bool show;
+		Overlay show;
 
 	private:
 		Context &_ctx;
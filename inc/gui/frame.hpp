@@ -34,7 +34,7 @@ class Frame {
 
 	public:
 		Frame() = delete;
-		Frame(Context &ctx, Component *component);
+		Frame(Context &ctx, const Component *component);
 		Frame(Context &ctx, std::string_view name, const ImVec2 pos,
 			  const Size size, const ImU32 colour, const ImU32 bg_colour);
 
@@ -42,7 +42,7 @@ class Frame {
 		auto _draw(const bool foreground) -> void;
 
 		Context &_ctx;
-		Component *_component;
+		const Component *_component;
 		std::string _name;
 		ImVec2 _pos;
 		Size _size;
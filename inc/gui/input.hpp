@@ -24,6 +24,7 @@
 
 #include "common/enum.hpp"
 #include "common/imgui.hpp"
+#include "gui/overlay.hpp"
 #include "types/enum.hpp"
 
 namespace Sorcery {
@@ -44,7 +45,7 @@ class Input {
 		auto set(const std::string value) -> void;
 		auto name() const -> std::string;
 
-		bool show;
+		Overlay show;
 
 	private:
 		Context &_ctx;
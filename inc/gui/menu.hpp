@@ -26,6 +26,7 @@
 #include "common/imgui.hpp"
 #include "common/types.hpp"
 #include "gui/define.hpp"
+#include "gui/menukey.hpp"
 #include "types/enum.hpp"
 
 namespace Sorcery {
@@ -38,16 +39,17 @@ class Menu {
 
 	public:
 		Menu() = delete;
-		Menu(Context &ctx, Component *component, Game *game);
+		Menu(Context &ctx, const Component *component, Game *game);
 		~Menu();
 
 		auto draw() -> void;
 		auto regenerate() -> void;
 
 		Context &_ctx;
-		Component *_component;
+		const Component *_component;
 		Game *_game;
 		std::string _name;
+		MenuKey _key;
 		ImVec2 _pos;
 		unsigned int _width;
 		unsigned int _height;
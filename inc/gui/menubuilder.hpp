@@ -25,6 +25,10 @@
 #include "common/types.hpp"
 #include "core/enum.hpp"
 
+#include <array>
+#include <string>
+#include <vector>
+
 namespace Sorcery {
 
 struct Context;
@@ -41,6 +45,12 @@ class MenuBuilder {
 	private:
 		Context &_ctx;
 
+		// Rows that only depend on the stores are formatted once, the first
+		// time they are needed - by SpellID, and by TypeID as it appears to
+		// a class that can or can't use it
+		std::vector<std::string> _spell_rows;
+		std::vector<std::array<std::string, 2>> _buy_rows;
+
 		auto _get_menu_flags(std::string_view menu_name) const -> int;
 
 		auto _load_party_characters(std::vector<std::string> &items,
@@ -79,6 +89,8 @@ class MenuBuilder {
 							   std::vector<std::string> &items) -> void;
 		auto _load_buy_menu(unsigned int width, std::vector<std::string> &items,
 							std::vector<int> &data) -> void;
+		auto _format_spell_rows() -> void;
+		auto _format_buy_rows() -> void;
 };
 
 }
\ No newline at end of file
@@ -24,6 +24,8 @@
 
 #include "common/enum.hpp"
 #include "common/imgui.hpp"
+#include "gui/menukey.hpp"
+#include "gui/overlay.hpp"
 #include "types/enum.hpp"
 
 namespace Sorcery {
@@ -43,7 +45,7 @@ class Modal {
 		auto regenerate() -> void;
 		auto name() const -> std::string;
 
-		bool show;
+		Overlay show;
 
 	private:
 		Context &_ctx;
@@ -61,6 +63,7 @@ class Modal {
 		std::vector<std::string> _items;
 		std::vector<int> _data;
 		std::string _menu_name;
+		MenuKey _menu_key;
 		bool _has_title;
 };
 
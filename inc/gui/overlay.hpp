@@ -0,0 +1,94 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Sorcery {
+
+class OverlayStack;
+
+// The visibility of a Modal, Dialog, Message, Popup or Input, which doubles
+// as its node in the OverlayStack - setting it to true pushes it on top of
+// the stack and setting it to false unlinks it again, both in O(1), so that
+// only the overlays actually open ever need to be looked at
+class Overlay {
+
+	public:
+		Overlay(OverlayStack *stack, std::string_view name);
+		~Overlay();
+
+		Overlay(const Overlay &) = delete;
+		auto operator=(const Overlay &) -> Overlay & = delete;
+
+		// Public Methods
+		auto operator=(const bool value) -> Overlay &;
+		operator bool() const noexcept;
+		auto name() const -> const std::string &;
+		auto set_draw(std::function<void()> draw) -> void;
+
+	private:
+		friend class OverlayStack;
+
+		// Private Members
+		OverlayStack *_stack;
+		Overlay *_prev;
+		Overlay *_next;
+		bool _active;
+		std::string _name;
+		std::function<void()> _draw;
+};
+
+// Every open Overlay, in the order they were opened (so the last is on top)
+class OverlayStack {
+
+	public:
+		OverlayStack();
+		~OverlayStack();
+
+		OverlayStack(const OverlayStack &) = delete;
+		auto operator=(const OverlayStack &) -> OverlayStack & = delete;
+
+		// Public Methods
+		auto push(Overlay &overlay) -> void;
+		auto remove(Overlay &overlay) -> void;
+		auto close_all() -> void;
+		auto draw() -> void;
+		auto empty() const noexcept -> bool;
+		auto size() const noexcept -> std::size_t;
+		auto top() const noexcept -> Overlay *;
+		auto describe() const -> std::string;
+
+	private:
+		// Private Members
+		Overlay *_head;
+		Overlay *_tail;
+		Overlay *_cursor;
+		std::size_t _size;
+		bool _drawing;
+};
+
+}
@@ -24,6 +24,7 @@
 
 #include <string>
 
+#include "gui/overlay.hpp"
 #include "types/enum.hpp"
 
 namespace Sorcery {
@@ -40,7 +41,7 @@ class Popup {
 		auto id() const -> std::string;
 		auto name() const -> std::string;
 
-		bool show;
+		Overlay show;
 
 	private:
 		Context &_ctx;
@@ -27,6 +27,8 @@
 #include "common/opengl.hpp"
 #include "common/types.hpp"
 #include "core/macro.hpp"
+#include "core/packedinput.hpp"
+#include "resources/resourcepack.hpp"
 
 namespace Sorcery {
 
@@ -39,7 +41,7 @@ class VideoPlayer {
 		~VideoPlayer();
 
 		// Public Methods
-		auto load(const std::string &filename) -> void;
+		auto load(const Resource &resource) -> void;
 		auto update(double playback_time) -> void;
 		auto render(const char *window_name, ImVec2 position = {0, 0},
 					ImVec2 size = {0, 0}) -> void;
@@ -55,6 +57,7 @@ class VideoPlayer {
 		AVFrame *_rgb_frame;
 		AVPacket *_packet;
 		SwsContext *_sws_ctx;
+		std::unique_ptr<PackedInput> _input;
 
 		std::vector<uint8_t> _rgb_buffer;
 
@@ -0,0 +1,133 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "common/cereal.hpp"
+#include "resources/resourcepack.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <exception>
+#include <map>
+#include <span>
+#include <spanstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Sorcery {
+
+// The JSON data files, validated and fully resolved ahead of time by the
+// sorcery-bake tool. Each section holds one store's contents as a binary
+// archive, so loading it is a single read with no parsing. A section also
+// records the size and hash of the JSON it was baked from, and the schema of
+// what it holds, and is ignored if either has changed since - the JSON remains
+// the source of truth, and the stores fall back to it
+class BakedFile {
+
+	public:
+		struct Section {
+				std::string key;
+				std::uint64_t source_size;
+				std::uint64_t source_hash;
+				std::uint64_t schema;
+				std::string data;
+		};
+
+		explicit BakedFile(const Resource &resource);
+		BakedFile() = delete;
+		BakedFile(const BakedFile &) = delete;
+		auto operator=(const BakedFile &) -> BakedFile & = delete;
+
+		[[nodiscard]] auto is_open() const -> bool;
+		[[nodiscard]] auto get(std::string_view key, const Resource &source,
+							   std::uint64_t schema) const
+			-> std::span<const std::byte>;
+
+		static auto section(std::string_view key, const Resource &source,
+							std::uint64_t schema, std::string data)
+			-> Section;
+
+		// The layout of the type that is archived and the revision of how it
+		// is archived and parsed, which catches a stale bake that would
+		// otherwise still unpack (just into the wrong fields)
+		static auto schema(std::size_t size, std::size_t alignment,
+						   std::uint32_t revision) -> std::uint64_t;
+		template <typename T>
+		static auto schema(const std::uint32_t revision) -> std::uint64_t {
+
+			return schema(sizeof(T), alignof(T), revision);
+		}
+		static auto write(const std::filesystem::path &filename,
+						  const std::vector<Section> &sections) -> void;
+
+		// Archive a store's contents into a section, and back again
+		template <typename T> static auto pack(const T &value) -> std::string {
+
+			std::ostringstream stream{};
+			{
+				cereal::BinaryOutputArchive archive{stream};
+				archive(value);
+			}
+
+			return std::move(stream).str();
+		}
+
+		template <typename T>
+		static auto unpack(const std::span<const std::byte> data, T &value)
+			-> bool {
+
+			if (data.empty())
+				return false;
+
+			try {
+				std::ispanstream stream{std::span{
+					reinterpret_cast<const char *>(data.data()), data.size()}};
+				cereal::BinaryInputArchive archive{stream};
+				archive(value);
+				return true;
+			} catch (const std::exception &) {
+				value = T{};
+				return false;
+			}
+		}
+
+	private:
+		struct Entry {
+				std::uint64_t source_size;
+				std::uint64_t source_hash;
+				std::uint64_t schema;
+				std::span<const std::byte> data;
+		};
+
+		auto _index() -> bool;
+
+		std::vector<std::byte> _buffer;
+		std::span<const std::byte> _data;
+		std::map<std::string, Entry, std::less<>> _entries;
+};
+
+}
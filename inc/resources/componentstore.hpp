@@ -22,38 +22,69 @@
 
 #pragma once
 
-#include <chrono>
+#include "resources/resourcepack.hpp"
+#include "types/component.hpp"
+#include "types/componenthandle.hpp"
+
+#include <cstdint>
 #include <filesystem>
 #include <map>
-#include <optional>
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace Sorcery {
 
-class Component;
-
 class ComponentStore {
 
 	public:
-		explicit ComponentStore(const std::filesystem::path filename);
+		explicit ComponentStore(const Resource resource);
 
-		auto operator()(std::string_view screen)
-			-> std::optional<std::vector<Component>>;
+		auto operator()(std::string_view screen) const
+			-> std::span<const Component>;
 
+		auto get(const ComponentHandle &handle) -> Component &;
 		auto get(std::string_view combined_key) -> Component &;
-		auto get_custom(std::string_view screen)
-			-> std::optional<std::vector<Component>>;
+		auto get_custom(std::string_view screen) const
+			-> std::span<const Component>;
+		auto get_resource() const -> const Resource &;
+		auto all() const -> std::span<const Component>;
+		auto generation() const -> std::uint64_t;
+		auto reparse() -> void;
+		auto commit() -> void;
 
 	private:
-		auto load(const std::filesystem::path filename) -> bool;
-		auto need_refresh() -> bool;
+		// Where the components of a screen are found in the array
+		struct Screen {
+				std::size_t automatic{0};
+				std::size_t automatic_size{0};
+				std::size_t manual{0};
+				std::size_t manual_size{0};
+		};
+
+		struct Layout {
+				std::vector<Component> components;
+				std::map<std::string, std::size_t, std::less<>> index;
+				std::map<std::string, Screen, std::less<>> screens;
+		};
+
+		auto load(const Resource &resource, Layout &layout) -> bool;
+		auto _build(std::map<std::string, Component> &parsed,
+					Layout &layout) const -> void;
+		auto _hold(std::string_view combined_key) -> Component &;
+		auto _missing(const Layout &layout) const -> std::vector<std::string>;
+		auto _resolve(std::string_view combined_key) const -> std::size_t;
 
-		std::map<std::string, Component> _components;
+		Layout _layout;
 		bool _loaded;
-		std::filesystem::file_time_type _last_mod;
-		std::chrono::time_point<std::chrono::file_clock> _last_load;
-		std::filesystem::path _file;
+		Resource _file;
+		std::mutex _staged_mutex;
+		std::unique_ptr<Layout> _staged;
+		std::map<std::string, Component, std::less<>> _held;
+		std::vector<Component *> _slots;
+		std::uint64_t _generation;
 		unsigned int _grid_w;
 		unsigned int _grid_h;
 };
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 using namespace std::string_literals;
@@ -77,9 +78,44 @@ inline constexpr auto TOWN_MUSIC{"town.mp3"sv};
 inline constexpr auto UNKNOWN_CREATURES_TEXTURE{"unknown.tga"sv};
 inline constexpr auto WIREFRAME_TEXTURE{"wireframe.tga"sv};
 
-inline constexpr auto SAVE_GAME_FILE{"game.json"sv};
+inline constexpr auto SAVE_GAME_FILE{"game.sav"sv};
+inline constexpr auto SAVE_LEGACY_GAME_FILE{"game.json"sv};
+inline constexpr auto SAVE_JOURNAL_FILE{"journal.bin"sv};
 inline constexpr auto SAVE_CHARACTERS_FILE{"characters.json"sv};
 inline constexpr auto SAVE_STATE_FILENAME{"save_state.b64"sv};
+inline constexpr auto QUICKSAVE_MAGIC{"SQSZ"sv};
+inline constexpr auto REPLAY_FILENAME{"session.replay"sv};
+
+// Save Files (character saves are named by id, e.g. "3.sav")
+inline constexpr auto SAVE_MAGIC{"SSAV"sv};
+inline constexpr std::uint16_t SAVE_VERSION{3};
+inline constexpr std::uint8_t SAVE_FLAG_COMPRESSED{0x01};
+inline constexpr std::size_t SAVE_COMPRESS_MINIMUM{256};
+inline constexpr auto SAVE_EXTENSION{".sav"sv};
+inline constexpr auto SAVE_LEGACY_EXTENSION{".json"sv};
+
+// Roster (every character save, kept in the characters directory)
+inline constexpr auto ROSTER_FILE{"roster.db"sv};
+inline constexpr auto ROSTER_MAGIC{"SROS"sv};
+inline constexpr std::uint16_t ROSTER_VERSION{1};
+inline constexpr std::uint64_t ROSTER_COMPACT_MINIMUM{64 * 1024};
+
+// Baked Data (optional - written by sorcery-bake into the data directory)
+inline constexpr auto BAKE_FILE{"sorcery.bake"sv};
+inline constexpr auto BAKE_MAGIC{"SBAK"sv};
+inline constexpr std::uint16_t BAKE_VERSION{3};
+
+// What each store bakes - bump one whenever its type's serialize() or the
+// parsing of its JSON changes, so that sections baked before are ignored
+inline constexpr std::uint32_t BAKE_ITEMS_REVISION{1};
+inline constexpr std::uint32_t BAKE_MONSTERS_REVISION{1};
+inline constexpr std::uint32_t BAKE_STRINGS_REVISION{1};
+
+// Resource Pack (optional - if present, found next to the executable)
+inline constexpr auto PACK_FILE{"sorcery.pak"sv};
+inline constexpr auto PACK_MAGIC{"SPAK"sv};
+inline constexpr std::uint32_t PACK_VERSION{1};
+inline constexpr std::size_t PACK_ALIGNMENT{64};
 
 // Miscellaneous error strings
 static const std::string KEY_NOT_FOUND{"KEY NOT FOUND"};
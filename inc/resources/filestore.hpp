@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include "resources/resourcepack.hpp"
+
 #include <filesystem>
 #include <string>
 #include <string_view>
@@ -39,6 +41,15 @@ class FileStore {
 
 		[[nodiscard]] auto get_path(std::string_view key) const -> std::string;
 
+		[[nodiscard]] auto get_resource(std::string_view key) const
+			-> Resource;
+
+		[[nodiscard]] auto is_packed() const -> bool;
+
+		[[nodiscard]] auto get_packed_keys() const -> std::vector<std::string>;
+
+		auto write_pack() const -> std::size_t;
+
 		[[nodiscard]] auto get_directory(std::string_view key) const
 			-> std::filesystem::path;
 
@@ -85,6 +96,8 @@ class FileStore {
 
 		[[nodiscard]] auto _get_exe_path() const -> std::filesystem::path;
 
+		auto _open_pack() -> void;
+
 		auto _validate_files() const -> void;
 
 		std::filesystem::path _base_path;
@@ -92,6 +105,8 @@ class FileStore {
 		std::vector<std::filesystem::path> _required_files;
 		std::unordered_map<std::string, std::filesystem::path> _directory_paths;
 		std::vector<std::filesystem::path> _required_directories;
+		ResourcePack _pack;
+		std::filesystem::file_time_type _pack_time;
 };
 
 }
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include "common/types.hpp"
 #include "core/macro.hpp"
 #include "resources/define.hpp"
+#include "resources/resourcepack.hpp"
 #include "types/enum.hpp"
 // #pragma GCC diagnostic push
 // #pragma GCC diagnostic ignored "-Wswitch-default"
@@ -75,13 +76,17 @@ class FontStore {
 		ImFont *_default_font{nullptr};
 		FT_Library _ft;
 
-		auto _is_valid_ttf(const std::string &path) const -> bool;
-		auto _is_monospace_ttf(const std::string &path) const -> bool;
+		auto _is_valid_ttf(const std::vector<unsigned char> &buffer) const
+			-> bool;
+		auto _is_monospace_ttf(const std::vector<unsigned char> &buffer) const
+			-> bool;
 		auto _get_font_full_name(const std::vector<unsigned char> &buffer)
 			-> std::string;
 		auto _get_fonts() const -> const std::vector<FontInfo> &;
-		auto _load_font(const std::string &path, bool is_monospace,
-						Enums::Layout::Font font_type) -> void;
+		auto _load_font(const Resource &resource,
+						const std::vector<unsigned char> &buffer,
+						bool is_monospace, Enums::Layout::Font font_type)
+			-> void;
 		auto _sort_fonts_by_name(bool case_insensitive = true) -> void;
 };
 } // namespace Sorcery
\ No newline at end of file
@@ -27,6 +27,7 @@
 
 #include "common/opengl.hpp"
 #include "resources/define.hpp"
+#include "resources/resourcepack.hpp"
 
 namespace Sorcery {
 
@@ -50,8 +51,9 @@ class ImageStore {
 
 	private:
 		auto _initialise() -> bool;
-		auto _load_texture_from_disc(const char *filename, GLuint *out_texture,
-									 int *out_width, int *out_height) -> bool;
+		auto _load_texture_from_disc(const Resource &resource,
+									 GLuint *out_texture, int *out_width,
+									 int *out_height) -> bool;
 		auto _load_image(const std::string &key) -> bool;
 
 		Context &_ctx;
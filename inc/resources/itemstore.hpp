@@ -22,10 +22,16 @@
 
 #pragma once
 
+#include <array>
+#include <bitset>
 #include <filesystem>
 #include <regex>
+#include <span>
+#include <utility>
 
 #include "common/enum.hpp"
+#include "common/types.hpp"
+#include "resources/resourcepack.hpp"
 #include "types/enum.hpp"
 #include "types/item.hpp"
 #include "types/itemtype.hpp"
@@ -33,26 +39,28 @@
 namespace Sorcery {
 
 struct Context;
+class BakedFile;
 
 class ItemStore {
 
 	public:
-		ItemStore(Context &ctx, const std::filesystem::path filename);
+		ItemStore(Context &ctx, const Resource resource,
+				  const BakedFile *baked = nullptr);
 		ItemStore() = delete;
 
-		auto get(Enums::Items::TypeID item_type_id) const -> ItemType;
-		auto get(unsigned int item_type_id) const -> ItemType;
-		auto get(Enums::Items::Category category) const
-			-> std::vector<ItemType>;
-		auto get(std::string_view name) const -> ItemType;
+		auto get(Enums::Items::TypeID item_type_id) const -> const ItemType &;
+		auto get(unsigned int item_type_id) const -> const ItemType &;
+		auto get(std::string_view name) const -> const ItemType &;
 
 		auto get_item_type(const Enums::Items::TypeID item_type_id) const
-			-> ItemType;
+			-> const ItemType &;
 		auto get_an_item(const Enums::Items::TypeID item_type_id) const -> Item;
 		auto get_random_item(const Enums::Items::TypeID min_item_type_id,
 							 const Enums::Items::TypeID max_item_type_id) const
 			-> Item;
-		auto get_all_types() const -> std::vector<ItemType>;
+		auto get_all_types() const -> std::span<const ItemType>;
+		auto is_usable(const Enums::Items::TypeID item_type_id,
+					   const Enums::Character::Class cclass) const -> bool;
 		auto is_usable(const Enums::Items::TypeID item_type_id,
 					   const Enums::Character::Class cclass,
 					   const Enums::Character::Align calign) const -> bool;
@@ -63,13 +71,31 @@ class ItemStore {
 			-> bool;
 		auto sellable_price(const Enums::Items::TypeID item_type_id) const
 			-> unsigned int;
+		auto bake() const -> std::string;
+		static auto bake_schema() -> std::uint64_t;
 
 	private:
+		static constexpr auto CLASSES{
+			std::to_underlying(Enums::Character::Class::NINJA) + 1};
+		static constexpr auto ALIGNMENTS{
+			std::to_underlying(Enums::Character::Align::EVIL) + 1};
+
+		// Per item flags, packed so usability checks are a single lookup
+		struct Usability {
+				std::bitset<CLASSES> classes;
+				std::bitset<ALIGNMENTS> alignments;
+				bool usable;
+				bool invokable;
+		};
+
 		Context &_ctx;
-		std::map<Enums::Items::TypeID, ItemType> _items;
+		std::vector<ItemType> _items; // Indexed by TypeID
+		StringMap<Enums::Items::TypeID> _names;
+		std::vector<Usability> _usability; // Indexed by TypeID
 		bool _loaded;
 
-		auto _load(const std::filesystem::path filename) -> bool;
+		auto _load(const Resource resource) -> bool;
+		auto _index() -> void;
 		auto _get_defensive_effects(const std::string defensive_s) const
 			-> std::array<bool, 22>;
 		auto _get_offensive_effects(const std::string offsensive_s) const
@@ -25,6 +25,7 @@
 #include <filesystem>
 
 #include "common/cereal.hpp"
+#include "resources/resourcepack.hpp"
 #include "types/enum.hpp"
 #include "types/level.hpp"
 
@@ -35,7 +36,7 @@ class LevelStore {
 	public:
 		// Constructors
 		LevelStore();
-		LevelStore(const std::filesystem::path filename);
+		LevelStore(const Resource resource);
 
 		// Serialisation
 		template <class Archive> auto serialize(Archive &archive) -> void {
@@ -56,7 +57,7 @@ class LevelStore {
 
 		// Private Methods
 		auto _get(const int depth) const -> std::optional<Level>;
-		auto _load(const std::filesystem::path filename) -> bool;
+		auto _load(const Resource resource) -> bool;
 };
 
 }
\ No newline at end of file
@@ -23,41 +23,51 @@
 #pragma once
 
 #include <filesystem>
+#include <span>
 
 #include "common/define.hpp"
 #include "common/enum.hpp"
+#include "common/types.hpp"
 #include "resources/define.hpp"
+#include "resources/resourcepack.hpp"
 #include "types/dice.hpp"
 #include "types/enum.hpp"
 #include "types/monstertype.hpp"
 
 namespace Sorcery {
 
+class BakedFile;
+
 class MonsterStore {
 
 	public:
-		MonsterStore(const std::filesystem::path filename);
+		MonsterStore(const Resource resource, const BakedFile *baked = nullptr);
 		MonsterStore() = delete;
 
-		auto get(Enums::Monsters::TypeID monster_type_id) const -> MonsterType;
-		auto get(int monster_type_id) const -> MonsterType;
+		auto get(Enums::Monsters::TypeID monster_type_id) const
+			-> const MonsterType &;
+		auto get(int monster_type_id) const -> const MonsterType &;
 		// auto operator()(ITC category) const -> std::vector<ItemType>;
-		auto get(std::string name) const -> MonsterType;
+		auto get(std::string_view name) const -> const MonsterType &;
 
 		// Public methods
 		// auto get_a_monster(const MTI monster_type_id) const -> Monster;
 		// auto get_random_monster(
 		//	const MTI min_monster_type_id, const MTI max_monster_type_id) const
 		//-> Monster;
-		auto get_all_types() const -> std::vector<MonsterType>;
+		auto get_all_types() const -> std::span<const MonsterType>;
+		auto bake() const -> std::string;
+		static auto bake_schema() -> std::uint64_t;
 
 	private:
 		// Private members
-		std::map<Enums::Monsters::TypeID, MonsterType> _items;
+		std::vector<MonsterType> _items; // Indexed by TypeID
+		StringMap<Enums::Monsters::TypeID> _names;
 		bool _loaded;
 
 		// Private methods
-		auto _load(const std::filesystem::path filename) -> bool;
+		auto _load(const Resource resource) -> bool;
+		auto _index() -> void;
 		auto _parse_attacks(const std::string value) const -> std::vector<Dice>;
 		auto _parse_breath_weapons(const std::string value) const
 			-> Enums::Monsters::Breath;
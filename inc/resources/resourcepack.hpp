@@ -0,0 +1,108 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Sorcery {
+
+// A file resolved by the FileStore - either a loose file on disc, or a span
+// into the mapped resource pack (which may be empty, for an empty file)
+struct Resource {
+		Resource(const std::filesystem::path &path);
+		Resource(const std::filesystem::path &path,
+				 std::span<const std::byte> data);
+
+		[[nodiscard]] auto packed() const -> bool;
+		[[nodiscard]] auto stream() const -> std::unique_ptr<std::istream>;
+		[[nodiscard]] auto bytes() const -> std::vector<unsigned char>;
+
+		std::filesystem::path path;
+		std::span<const std::byte> data;
+		bool in_pack;
+};
+
+// Read-only single-file archive of the game data. The file is laid out as a
+// fixed header, an index of entries, a table of keys, and then each file as a
+// blob aligned to PACK_ALIGNMENT bytes. The whole file is mapped into memory
+// once and lookups return spans into it, so no further file system calls are
+// needed to read any packed resource
+class ResourcePack {
+
+	public:
+		ResourcePack();
+		~ResourcePack();
+		ResourcePack(const ResourcePack &) = delete;
+		auto operator=(const ResourcePack &) -> ResourcePack & = delete;
+
+		auto open(const std::filesystem::path &filename) -> bool;
+		auto close() -> void;
+
+		[[nodiscard]] auto is_open() const -> bool;
+		[[nodiscard]] auto contains(std::string_view key) const -> bool;
+		[[nodiscard]] auto get(std::string_view key) const
+			-> std::span<const std::byte>;
+		[[nodiscard]] auto keys() const -> std::vector<std::string>;
+		[[nodiscard]] auto size() const -> std::size_t;
+
+		static auto write(
+			const std::filesystem::path &filename,
+			const std::vector<std::pair<std::string, std::filesystem::path>>
+				&files) -> void;
+
+	private:
+		struct Header {
+				char magic[4];
+				std::uint32_t version;
+				std::uint32_t count;
+				std::uint32_t reserved;
+		};
+
+		struct Entry {
+				std::uint64_t offset;
+				std::uint64_t size;
+				std::uint32_t key_offset;
+				std::uint32_t key_size;
+		};
+
+		auto _map(const std::filesystem::path &filename) -> bool;
+		auto _index() -> bool;
+
+		const std::byte *_data;
+		std::size_t _size;
+		bool _mapped;
+		std::vector<std::byte> _buffer;
+		std::unordered_map<std::string, std::span<const std::byte>> _entries;
+};
+
+}
@@ -0,0 +1,101 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Sorcery {
+
+// Every character save kept in a single file. The file is a short header and
+// then a log of records, each either putting a new version of a character or
+// erasing one, which is only ever appended to. When opened the log is read
+// once (through a mapping, as with the ResourcePack) to build an index of
+// where the newest version of each character is, and a torn record at the
+// end from an interrupted write is dropped. A complete record that doesn't
+// check out means the file is damaged: it is moved aside untouched, and the
+// roster carries on with the records before the damage. Once more of the file
+// is taken up by superseded records than current ones it is rewritten
+// (compacted) with just the current ones. Records are opaque here
+class RosterFile {
+
+	public:
+		explicit RosterFile(const std::filesystem::path &path);
+		~RosterFile();
+		RosterFile(const RosterFile &) = delete;
+		auto operator=(const RosterFile &) -> RosterFile & = delete;
+
+		// Public Methods
+		[[nodiscard]] auto ids() const noexcept
+			-> const std::vector<unsigned int> &;
+		[[nodiscard]] auto contains(unsigned int id) const -> bool;
+		[[nodiscard]] auto get(unsigned int id) const -> std::string_view;
+		auto put(unsigned int id, std::string_view record) -> void;
+		auto erase(unsigned int id) -> bool;
+		auto clear() -> void;
+		auto compact() -> void;
+		[[nodiscard]] auto path() const -> const std::filesystem::path &;
+
+	private:
+		enum class Op : std::uint8_t {
+			PUT = 1,
+			ERASE = 2
+		};
+
+		struct Entry {
+				std::uint64_t offset;
+				std::uint32_t size;
+		};
+
+		// Private Methods
+		auto _open() -> void;
+		auto _close() -> void;
+		auto _map() const -> void;
+		auto _unmap() const -> void;
+		auto _scan() -> std::uint64_t;
+		auto _quarantine(std::uint64_t position) -> void;
+		auto _append(Op op, unsigned int id, std::string_view record)
+			-> void;
+		auto _wasted() const noexcept -> std::uint64_t;
+
+		// Private Members
+		std::filesystem::path _path;
+		std::ofstream _out;
+		std::uint64_t _size;
+		std::uint64_t _live;
+		std::unordered_map<unsigned int, Entry> _index;
+		std::vector<unsigned int> _ids;
+		mutable const std::byte *_data;
+		mutable std::size_t _mapped_size;
+		mutable bool _mapped;
+		mutable std::vector<std::byte> _buffer;
+};
+
+}
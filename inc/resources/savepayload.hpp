@@ -0,0 +1,119 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "resources/zstream.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+namespace Sorcery {
+
+inline constexpr std::uint64_t FNV_OFFSET_BASIS{14695981039346656037ull};
+
+inline auto fnv1a(const std::string_view bytes,
+				  std::uint64_t hash = FNV_OFFSET_BASIS) -> std::uint64_t {
+
+	for (const auto byte : bytes) {
+		hash ^= static_cast<unsigned char>(byte);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+// A payload as it is stored in a save - deflated if compressed is set - along
+// with the size and checksum of what was serialised into it
+struct SavePayload {
+		std::string data;
+		std::uint64_t size{};
+		std::uint64_t checksum{FNV_OFFSET_BASIS};
+		bool compressed{};
+};
+
+// Checksums everything written to it, and keeps it as a SavePayload, so that
+// a cereal archive can be serialised straight into a save without the whole
+// of it ever being held uncompressed. Once more than SAVE_COMPRESS_MINIMUM
+// has been written (and if compress is set) the rest is deflated as it goes.
+// If keep is not set then nothing is kept at all, only the size and checksum
+class PayloadBuffer : public std::streambuf {
+
+	public:
+		explicit PayloadBuffer(bool compress, bool keep = true);
+		PayloadBuffer(const PayloadBuffer &) = delete;
+		auto operator=(const PayloadBuffer &) -> PayloadBuffer & = delete;
+
+		// Public Methods
+		auto finish() -> SavePayload;
+
+	protected:
+		auto overflow(int_type ch) -> int_type override;
+		auto xsputn(const char *data, std::streamsize count)
+			-> std::streamsize override;
+
+	private:
+		// Where the deflated payload ends up
+		class Sink : public std::streambuf {
+
+			public:
+				explicit Sink(std::string &data);
+
+			protected:
+				auto overflow(int_type ch) -> int_type override;
+				auto xsputn(const char *data, std::streamsize count)
+					-> std::streamsize override;
+
+			private:
+				std::string &_data;
+		};
+
+		// Private Methods
+		auto _store(std::string_view bytes) -> void;
+
+		// Private Members
+		SavePayload _payload;
+		Sink _sink_buffer;
+		std::ostream _sink;
+		std::optional<DeflateBuffer> _deflate;
+		bool _compress;
+		bool _keep;
+};
+
+class PayloadStream : public std::ostream {
+
+	public:
+		explicit PayloadStream(bool compress, bool keep = true);
+
+		// Public Methods
+		auto finish() -> SavePayload;
+
+	private:
+		PayloadBuffer _buffer;
+};
+
+}
@@ -22,7 +22,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -32,34 +36,69 @@
 namespace Sorcery {
 
 struct GameEntry;
+struct SavePayload;
+class RosterFile;
 
+// What sits in front of the payload in a save file - the game uses key and
+// the characters use name, and the times are seconds since the epoch
+struct SaveHeader {
+		unsigned int id{};
+		unsigned int game_id{};
+		std::string key;
+		std::string name;
+		std::string status;
+		std::int64_t created{};
+		std::int64_t modified{};
+};
+
+// Game and characters are each kept in a small versioned binary container
+// (header, payload, checksum) - the payloads themselves are opaque here, and
+// arrive already deflated (see SavePayload) if compress was set. The game has
+// a file of its own, whilst the characters are all records in the roster.
+// The headers are remembered once read or written, so that updating a save
+// never needs to read the previous one back in. Saves in the older formats
+// (JSON, and one file per character) are converted when the store is created
 class SaveStore {
 	public:
 		explicit SaveStore(const std::filesystem::path &game_file,
 						   const std::filesystem::path &characters_directory);
 		SaveStore() = delete;
+		~SaveStore();
 
 		auto has_game() const -> bool;
 		auto wipe_data() -> void;
-		auto create_game_state(std::string key, std::string data)
+		auto create_game_state(std::string key, const SavePayload &payload)
 			-> unsigned int;
 		auto load_game_state() const -> std::optional<GameEntry>;
 		auto save_game_state(unsigned int game_id, std::string_view key,
-							 std::string data) -> void;
+							 const SavePayload &payload) -> void;
 		auto add_character(unsigned int game_id, std::string name,
-						   std::string data) -> unsigned int;
+						   const SavePayload &payload) -> unsigned int;
 		auto update_character(unsigned int game_id, unsigned int character_id,
-							  std::string name, std::string data) -> bool;
+							  std::string name, const SavePayload &payload)
+			-> bool;
 		auto delete_character(unsigned int game_id, unsigned int character_id)
 			-> void;
 		auto get_character_ids(unsigned int game_id) const
-			-> std::vector<unsigned int>;
+			-> const std::vector<unsigned int> &;
 		auto get_character(unsigned int game_id,
 						   unsigned int character_id) const -> std::string;
+		auto journal_file() const -> std::filesystem::path;
+
+		// Public Members
+		std::atomic_bool compress;
 
 	private:
 		std::filesystem::path _game_file;
 		std::filesystem::path _characters_directory;
+		mutable std::optional<SaveHeader> _game;
+		mutable std::unordered_map<unsigned int, SaveHeader> _characters;
+		std::unique_ptr<RosterFile> _roster;
+
+		auto _character_header(unsigned int character_id) const
+			-> std::optional<SaveHeader>;
+		auto _game_header() const -> const SaveHeader &;
+		auto _migrate() -> void;
 
 		auto _to_epoch_seconds(const std::chrono::system_clock::time_point time)
 			const -> std::int64_t;
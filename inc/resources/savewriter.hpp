@@ -0,0 +1,101 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "resources/savepayload.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+namespace Sorcery {
+
+class SaveStore;
+
+enum class SaveStatus {
+	IDLE,
+	PENDING,
+	WRITING,
+	FAILED
+};
+
+// Writes saves to disk on a background thread. The caller serialises the
+// game into a Snapshot (deflating it on the way) and submits it, and the
+// writer then puts it into the SaveStore. A snapshot submitted whilst an
+// earlier one is still waiting is merged into it, so a burst of saves is only
+// written once, and a snapshot that fails to write is kept and retried with
+// the next one.
+// Anything else that uses the SaveStore directly must flush() first
+class SaveWriter {
+
+	public:
+		struct Character {
+				std::string name;
+				SavePayload data;
+		};
+
+		struct Snapshot {
+				unsigned int game_id;
+				std::string key;
+				SavePayload state;
+				std::map<unsigned int, Character> characters;
+		};
+
+		explicit SaveWriter(SaveStore &saves);
+		~SaveWriter();
+		SaveWriter(const SaveWriter &) = delete;
+		auto operator=(const SaveWriter &) -> SaveWriter & = delete;
+
+		// Public Methods
+		auto submit(Snapshot snapshot) -> void;
+		auto flush() -> bool;
+		auto discard() -> void;
+		auto stop() -> void;
+		auto status() const -> SaveStatus;
+		auto error() const -> std::string;
+
+	private:
+		// Private Methods
+		auto _run(std::stop_token stop) -> void;
+		auto _write(const Snapshot &snapshot) -> void;
+
+		// Private Members
+		SaveStore &_saves;
+		mutable std::mutex _mutex;
+		std::condition_variable_any _wake;
+		std::condition_variable _idle;
+		std::optional<Snapshot> _pending;
+		std::optional<Snapshot> _retry;
+		std::atomic<SaveStatus> _status;
+		std::string _error;
+		bool _writing;
+		std::jthread _thread;
+};
+
+}
@@ -22,6 +22,10 @@
 
 #pragma once
 
+#include <array>
+#include <span>
+#include <utility>
+
 #include "common/enum.hpp"
 #include "common/types.hpp"
 #include "types/enum.hpp"
@@ -37,19 +41,24 @@ class SpellStore {
 		// Constructor
 		SpellStore(Context &ctx);
 
-		auto get(Enums::Magic::SpellID spell_id) const -> Spell;
+		auto get(Enums::Magic::SpellID spell_id) const -> const Spell &;
 		auto get(Enums::Magic::SpellCategory category) const
-			-> std::vector<Spell>;
-		auto get(std::string_view name) const -> Spell;
+			-> std::span<const Enums::Magic::SpellID>;
+		auto get(std::string_view name) const -> const Spell &;
 
 		// Public Methods
-		auto get_all() -> std::vector<Spell>;
+		auto get_all() const -> std::span<const Spell>;
 
 	private:
+		static constexpr auto CATEGORIES{
+			std::to_underlying(Enums::Magic::SpellCategory::ATTACK) + 1};
+
 		// Private Members
 		Context &_ctx;
 		bool _loaded;
-		std::vector<Spell> _spells;
+		std::vector<Spell> _spells; // Indexed by SpellID
+		StringMap<Enums::Magic::SpellID> _names;
+		std::array<std::vector<Enums::Magic::SpellID>, CATEGORIES> _by_category;
 
 		// Private Functions
 		auto _load() -> void;
@@ -22,24 +22,46 @@
 
 #pragma once
 
-#include <map>
+#include "resources/resourcepack.hpp"
+#include "resources/stringtable.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 
 namespace Sorcery {
+
+class BakedFile;
+
 class StringStore {
 
 	public:
-		explicit StringStore(const std::string &filename);
+		explicit StringStore(const Resource &resource,
+							 const BakedFile *baked = nullptr);
 		StringStore() = delete;
 
-		auto get(std::string_view key) const -> std::string;
+		auto get(std::string_view key) const -> std::string_view;
+		auto get(const StringID id) const -> std::string_view;
 		auto reload() -> void;
+		auto get_resource() const -> const Resource &;
+		auto generation() const -> std::uint64_t;
+		auto reparse() -> void;
+		auto commit() -> void;
+		auto bake() const -> std::string;
+		static auto bake_schema() -> std::uint64_t;
 
 	private:
-		auto _load() -> bool;
+		using Strings = StringTable;
+
+		auto _load(Strings &strings) const -> bool;
 
-		std::string _filename;
-		std::map<std::string, std::string, std::less<>> _strings;
+		Resource _resource;
+		Strings _strings;
 		bool _loaded;
+		std::uint64_t _generation;
+		std::mutex _staged_mutex;
+		std::unique_ptr<Strings> _staged;
 };
 }
\ No newline at end of file
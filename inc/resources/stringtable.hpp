@@ -0,0 +1,84 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "common/cereal.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Sorcery {
+
+enum class StringID : std::uint16_t;
+
+// Every key and string laid end to end in one buffer, found through an
+// open-addressed hash table of offsets built once they are all loaded. Each
+// string is followed by a NUL, so a view of one can be handed straight to
+// ImGui. Views stay valid until the table is next changed
+class StringTable {
+
+	public:
+		auto add(std::string_view key, std::string_view value) -> void;
+		auto index() -> void;
+		auto clear() -> void;
+		auto size() const -> std::size_t;
+		auto find(std::string_view key) const
+			-> std::optional<std::string_view>;
+		auto find(const StringID id) const -> std::optional<std::string_view>;
+
+		// Serialisation (only the strings, the index is rebuilt on loading)
+		template <class Archive> auto serialize(Archive &archive) -> void {
+			archive(_arena, _entries);
+		}
+
+	private:
+		struct Entry {
+				std::uint32_t key;
+				std::uint32_t key_size;
+				std::uint32_t value;
+				std::uint32_t value_size;
+
+				template <class Archive>
+				auto serialize(Archive &archive) -> void {
+					archive(key, key_size, value, value_size);
+				}
+		};
+
+		static constexpr auto EMPTY{0u};
+		static constexpr auto MISSING{~0u};
+
+		auto _slot(std::string_view key) const -> std::size_t;
+		auto _key(const Entry &entry) const -> std::string_view;
+		auto _value(const Entry &entry) const -> std::string_view;
+
+		std::string _arena;
+		std::vector<Entry> _entries;
+		std::vector<std::uint32_t> _slots; // Entry + 1, or EMPTY
+		std::vector<std::uint32_t> _ids;   // Entry for each StringID
+};
+
+}
@@ -0,0 +1,118 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include <zlib.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+
+namespace Sorcery {
+
+// Deflates everything written to it into another stream as it goes, so that
+// a cereal archive (or anything else) can be compressed straight into a file
+// without first being built up in memory. finish() must be called once done,
+// to write out the end of the deflate stream
+class DeflateBuffer : public std::streambuf {
+
+	public:
+		explicit DeflateBuffer(std::ostream &sink, int level = Z_BEST_SPEED);
+		~DeflateBuffer() override;
+		DeflateBuffer(const DeflateBuffer &) = delete;
+		auto operator=(const DeflateBuffer &) -> DeflateBuffer & = delete;
+
+		// Public Methods
+		auto finish() -> void;
+		auto consumed() const noexcept -> std::uint64_t;
+		auto produced() const noexcept -> std::uint64_t;
+
+	protected:
+		auto overflow(int_type ch) -> int_type override;
+		auto sync() -> int override;
+		auto xsputn(const char *data, std::streamsize count)
+			-> std::streamsize override;
+
+	private:
+		// Private Methods
+		auto _deflate(int flush) -> void;
+
+		// Private Members
+		std::ostream &_sink;
+		z_stream _zs;
+		std::array<char, 16384> _in;
+		std::array<char, 16384> _out;
+		bool _finished;
+};
+
+// Inflates a deflate stream read from another stream as it is asked for. It
+// stops at the end of the deflate stream, leaving anything after it unread
+// in the source (other than what was already buffered)
+class InflateBuffer : public std::streambuf {
+
+	public:
+		explicit InflateBuffer(std::istream &source);
+		~InflateBuffer() override;
+		InflateBuffer(const InflateBuffer &) = delete;
+		auto operator=(const InflateBuffer &) -> InflateBuffer & = delete;
+
+	protected:
+		auto underflow() -> int_type override;
+
+	private:
+		// Private Members
+		std::istream &_source;
+		z_stream _zs;
+		std::array<char, 16384> _in;
+		std::array<char, 16384> _out;
+		bool _ended;
+};
+
+class DeflateStream : public std::ostream {
+
+	public:
+		explicit DeflateStream(std::ostream &sink, int level = Z_BEST_SPEED);
+
+		// Public Methods
+		auto finish() -> void;
+		auto consumed() const noexcept -> std::uint64_t;
+		auto produced() const noexcept -> std::uint64_t;
+
+	private:
+		DeflateBuffer _buffer;
+};
+
+class InflateStream : public std::istream {
+
+	public:
+		explicit InflateStream(std::istream &source);
+
+	private:
+		InflateBuffer _buffer;
+};
+
+}
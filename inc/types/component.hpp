@@ -27,6 +27,8 @@
 #include "common/imgui.hpp"
 #include "types/define.hpp"
 #include "types/enum.hpp"
+#include "types/property.hpp"
+#include <atomic>
 
 namespace Sorcery {
 
@@ -46,10 +48,10 @@ class Component {
 				  const Enums::Layout::DrawMode drawmode_);
 		Component();
 
-		auto get(std::string_view key) -> std::optional<std::string>;
 		auto get(std::string_view key) const -> std::optional<std::string>;
+		auto get(const PropertyId &key) const -> std::optional<std::string>;
 
-		auto set(std::string_view key, std::string_view value) -> void;
+		auto set(std::string_view key, std::string_view value) -> bool;
 		auto set_enabled(bool value) -> void;
 		auto get_enabled() const -> bool;
 		auto set_visible(bool value) -> void;
@@ -61,6 +63,11 @@ class Component {
 			-> float;
 		auto get_bool(std::string_view key, bool fallback = false) const
 			-> bool;
+		auto get_int(const PropertyId &key, int fallback = 0) const -> int;
+		auto get_float(const PropertyId &key, float fallback = 0.0f) const
+			-> float;
+		auto get_bool(const PropertyId &key, bool fallback = false) const
+			-> bool;
 
 		std::string form;
 		std::string name;
@@ -79,15 +86,17 @@ class Component {
 		unsigned int priority;
 		Enums::Layout::DrawMode drawmode;
 		std::string unique_key;
+		std::size_t slot;
 
 	private:
-		auto _get(std::string_view key) const -> std::optional<std::string>;
+		auto _find(std::size_t id) const -> const Property *;
 
 		bool _enabled;
 		bool _visible;
-		std::vector<std::pair<std::string, std::string>> _data;
+		std::vector<Property> _data;
+		std::vector<std::uint16_t> _slots;
 		long _id;
-		static inline long _s_id{0};
+		static inline std::atomic_long _s_id{0};
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "types/internedid.hpp"
+
+#include <cstddef>
+#include <limits>
+
+namespace Sorcery {
+
+// A "screen:name" component key interned into a process-wide id, so that the
+// ComponentStore can resolve it to an index into its component array once and
+// then look it up directly from then on. Ids are stable across layout reloads
+struct ComponentTag {
+		static constexpr std::size_t CAPACITY{
+			std::numeric_limits<std::size_t>::max()};
+		static constexpr auto NAME{"component"};
+};
+using ComponentHandle = InternedId<ComponentTag>;
+
+}
+
+// A literal component key, interned at startup
+#define COMPONENT(key) (Sorcery::interned<Sorcery::ComponentTag, key>)
\ No newline at end of file
@@ -42,6 +42,7 @@ class Config {
 			-> std::string;
 		auto has_changed() -> bool;
 		auto load() -> bool;
+		auto load(const std::filesystem::path &cfg_path) -> bool;
 		auto save() -> bool;
 		auto store() -> void;
 		auto set_rec_mode() -> void;
@@ -24,7 +24,12 @@
 
 #include "common/types.hpp"
 
+#include <cstdint>
+#include <optional>
 #include <random>
+#include <span>
+#include <stdexcept>
+#include <string_view>
 
 namespace Sorcery {
 
@@ -32,19 +37,75 @@ class Dice {
 
 	public:
 		// Constructors
-		Dice();
-		Dice(const unsigned int num_, const unsigned int dice_);
-		Dice(const std::string dice_);
-		Dice(const unsigned int num_, const unsigned int dice_, const int mod_);
+		constexpr Dice() : num{0}, dice{0}, mod{0} {}
+		constexpr Dice(const unsigned int num_, const unsigned int dice_)
+			: num{num_},
+			  dice{dice_},
+			  mod{0} {}
+		constexpr Dice(const unsigned int num_, const unsigned int dice_,
+					   const int mod_)
+			: num{num_},
+			  dice{dice_},
+			  mod{mod_} {}
+		constexpr Dice(const std::string_view dice_)
+			: Dice{parse(dice_).value_or(Dice{})} {}
+
+		// Serialisation
+		template <class Archive> auto serialize(Archive &archive) -> void {
+			archive(num, dice, mod);
+		}
+
+		// Parse "NdS", "NdS+M" or "NdS-M" (nothing if it isn't in that form)
+		static constexpr auto parse(std::string_view value)
+			-> std::optional<Dice> {
+
+			const auto number{[&value](unsigned int &result) {
+				auto digits{0u};
+				result = 0;
+				while (!value.empty() && value.front() >= '0' &&
+					   value.front() <= '9') {
+					if (++digits > 6)
+						return false;
+					result = (result * 10) +
+							 static_cast<unsigned int>(value.front() - '0');
+					value.remove_prefix(1);
+				}
+				return digits > 0;
+			}};
+
+			Dice result{};
+			if (!number(result.num) || !value.starts_with('d'))
+				return std::nullopt;
+			value.remove_prefix(1);
+			if (!number(result.dice))
+				return std::nullopt;
+
+			const auto negative{value.starts_with('-')};
+			if (negative || value.starts_with('+'))
+				value.remove_prefix(1);
+			auto mod{0u};
+			number(mod);
+			if (!value.empty())
+				return std::nullopt;
+			result.mod = negative ? -static_cast<int>(mod)
+								  : static_cast<int>(mod);
+
+			return result;
+		}
 
 		// Public Methods
 		auto roll() const -> int;
+		auto roll(std::span<int> results) const -> void;
 		auto roll_min() const -> int;
 		auto roll_max() const -> int;
+		auto mean() const -> double;
 		auto set(const unsigned int num_, const unsigned int dice_,
 				 const int mod_);
 		auto str() const -> std::string;
 
+		// Reseed the shared RNG (so that a session can be replayed)
+		static auto seed(const std::uint64_t value) -> void;
+
 		// Public Members
 		unsigned int num;
 		unsigned int dice;
@@ -55,4 +116,18 @@ class Dice {
 		static std::mt19937_64 _random;
 };
 
-}
\ No newline at end of file
+// Dice checked at compile time, e.g. "3d8+2"_d
+inline namespace Literals {
+
+	consteval auto operator""_d(const char *value, std::size_t size) -> Dice {
+
+		const auto dice{Dice::parse({value, size})};
+		if (!dice)
+			throw std::invalid_argument{"Invalid dice"};
+
+		return *dice;
+	}
+
+}
+
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "types/dice.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Sorcery {
+
+// The exact chance of every total from one or more dice rolled together (e.g.
+// a monster's attacks in a round), worked out by convolving each one in turn
+class DiceOdds {
+
+	public:
+		// Constructors
+		explicit DiceOdds(const Dice &dice);
+		explicit DiceOdds(std::span<const Dice> dice);
+		DiceOdds() = delete;
+
+		// Public Methods
+		auto min() const -> int;
+		auto max() const -> int;
+		auto mean() const -> double;
+		auto chance(const int total) const -> double;
+		auto at_least(const int total) const -> double;
+		auto percentile(const double fraction) const -> int;
+
+	private:
+		// Private Methods
+		auto _add(const Dice &dice) -> void;
+		auto _finish() -> void;
+
+		// Private Members
+		int _min;
+		std::vector<double> _odds;		 // Indexed by total - _min
+		std::vector<double> _cumulative; // Chance of that total or lower
+};
+
+}
@@ -24,8 +24,12 @@
 
 #include "common/cereal.hpp"
 #include "common/sdl2.hpp"
+#include "resources/savewriter.hpp"
 #include "types/character.hpp"
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace Sorcery {
 
 // Forward Declarations
@@ -101,10 +105,11 @@ class Game {
 		auto _create_game() -> void;
 		auto _save_game() -> void;
 		auto _load_game() -> void;
-		auto _load_characters() -> void;
+		auto _load_characters() -> bool;
 		auto _load_levels() -> void;
 		auto _get_characters() -> std::map<unsigned int, Character>;
-		auto _save_characters() -> void;
+		auto _save_characters()
+			-> std::map<unsigned int, SaveWriter::Character>;
 		auto _update_party_location() -> void;
 		auto _set_up_dungeon_events() -> void;
 		auto _set_up_debug_keys() -> void;
@@ -129,6 +134,7 @@ class Game {
 		unsigned int _id;
 		std::string _status;
 		std::vector<unsigned int> _char_ids;
+		std::unordered_map<unsigned int, std::uint64_t> _saved; // last written
 		bool _show_console;
 		std::vector<DungeonEvent> _events;
 		std::map<SDL_Keycode, std::function<void()>> _debug;
@@ -0,0 +1,103 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "common/cereal.hpp"
+#include "common/types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace Sorcery {
+
+// The game's console log. Only the most recent CAPACITY messages are kept in
+// memory (and in the save), in a ring, and each older message is appended to
+// a journal file as it drops out of the ring, from where page() can read it
+// back (though nothing in the UI shows more than the ring yet). Each journal
+// record is its length, the message and then its length again, so that it
+// can be read backwards from the newest end. Messages that drop out before
+// the journal has been opened are held until it is
+class GameLog {
+
+	public:
+		static constexpr std::size_t CAPACITY{256};
+
+		GameLog();
+		GameLog(const GameLog &) = delete;
+		auto operator=(const GameLog &) -> GameLog & = delete;
+
+		// Serialisation - the size of the journal is kept so that anything
+		// written to it after the last save can be dropped when reloading
+		// (so flush() needs to have been called before saving)
+		template <class Archive> auto save(Archive &archive) const -> void {
+			std::vector<ConsoleMessage> messages{};
+			messages.reserve(_count);
+			for (auto i = 0u; i < _count; i++)
+				messages.emplace_back((*this)[i]);
+			archive(messages, _journal_size, _journalled);
+		}
+
+		template <class Archive> auto load(Archive &archive) -> void {
+			std::vector<ConsoleMessage> messages{};
+			archive(messages, _journal_size, _journalled);
+			_clear_ring();
+			for (auto &message : messages)
+				add(std::move(message));
+			_loaded = true;
+		}
+
+		// Public Methods
+		auto add(ConsoleMessage message) -> void;
+		auto clear() -> void;
+		auto erase_journal() -> void;
+		auto flush() -> void;
+		auto open(const std::filesystem::path &journal) -> void;
+		auto size() const -> std::size_t;
+		auto journalled() const -> std::size_t;
+		auto operator[](std::size_t index) const -> const ConsoleMessage &;
+		auto recent(std::size_t count) const -> std::vector<ConsoleMessage>;
+		auto page(std::size_t skip, std::size_t count)
+			-> std::vector<ConsoleMessage>;
+
+	private:
+		// Private Methods
+		auto _clear_ring() -> void;
+		auto _journal(const ConsoleMessage &message) -> void;
+
+		// Private Members
+		std::vector<ConsoleMessage> _ring;
+		std::size_t _head;
+		std::size_t _count;
+		std::filesystem::path _path;
+		std::ofstream _out;
+		std::vector<ConsoleMessage> _unwritten;
+		std::uint64_t _journal_size;
+		std::uint64_t _journalled;
+		bool _loaded;
+};
+
+}
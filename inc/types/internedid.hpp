@@ -0,0 +1,151 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <format>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace Sorcery {
+
+// A name interned into a dense process-wide id, with a separate set of ids for
+// each Tag. Ids are never reused, so the Tag's CAPACITY bounds how many
+// different names can be used over the lifetime of the program
+template <typename Tag> class InternedId {
+
+	public:
+		static constexpr std::size_t CAPACITY{Tag::CAPACITY};
+
+		explicit InternedId(std::string_view key) {
+
+			auto &registry{_registry()};
+			std::scoped_lock<std::mutex> scoped_lock(registry.mutex);
+
+			if (const auto it{registry.ids.find(key)};
+				it != registry.ids.end())
+				_id = it->second;
+			else {
+				if (registry.keys.size() == CAPACITY)
+					throw std::length_error{std::format(
+						"Too many {} names (adding '{}')", Tag::NAME, key)};
+
+				_id = registry.keys.size();
+				registry.keys.emplace_back(key);
+				registry.ids.emplace(key, _id);
+			}
+			_key = registry.keys[_id];
+		}
+
+		auto id() const -> std::size_t {
+
+			return _id;
+		}
+
+		auto key() const -> std::string_view {
+
+			return _key;
+		}
+
+		static auto count() -> std::size_t {
+
+			auto &registry{_registry()};
+			std::scoped_lock<std::mutex> scoped_lock(registry.mutex);
+
+			return registry.keys.size();
+		}
+
+		// Look up a name without interning it (for names that come from
+		// outside the code, such as from a save file)
+		static auto find(std::string_view key) -> std::optional<InternedId> {
+
+			auto &registry{_registry()};
+			std::scoped_lock<std::mutex> scoped_lock(registry.mutex);
+
+			if (const auto it{registry.ids.find(key)};
+				it != registry.ids.end())
+				return InternedId{it->second, registry.keys[it->second]};
+
+			return std::nullopt;
+		}
+
+		static auto key_of(std::size_t id) -> std::string_view {
+
+			auto &registry{_registry()};
+			std::scoped_lock<std::mutex> scoped_lock(registry.mutex);
+
+			return id < registry.keys.size()
+					   ? std::string_view{registry.keys[id]}
+					   : std::string_view{};
+		}
+
+	private:
+		// Names are kept in a deque so that the views handed out remain valid
+		struct Registry {
+				std::mutex mutex;
+				std::deque<std::string> keys;
+				std::map<std::string, std::size_t, std::less<>> ids;
+		};
+
+		InternedId(std::size_t id, std::string_view key)
+			: _id{id},
+			  _key{key} {}
+
+		static auto _registry() -> Registry & {
+
+			static Registry registry{};
+			return registry;
+		}
+
+		std::size_t _id;
+		std::string_view _key;
+};
+
+// A string literal that can be used as a template argument
+template <std::size_t N> struct InternedKey {
+		consteval InternedKey(const char (&key)[N]) {
+			std::ranges::copy(key, value);
+		}
+
+		constexpr auto view() const -> std::string_view {
+			return {value, N - 1};
+		}
+
+		char value[N];
+};
+
+// One of these exists for every literal name used in the code, and as they are
+// namespace-scope variables they are all interned before main() runs; so
+// anything checking the names in use (such as the ComponentStore does when it
+// loads the layout) sees all of them, not just those that have been reached
+template <typename Tag, InternedKey key>
+inline const InternedId<Tag> interned{key.view()};
+
+}
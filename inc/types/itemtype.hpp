@@ -26,6 +26,7 @@
 #include "types/dice.hpp"
 #include "types/enum.hpp"
 
+#include <cstdint>
 #include <random>
 
 namespace Sorcery {
@@ -40,11 +41,24 @@ class ItemType {
 		auto friend operator<<(std::ostream &out_stream,
 							   const ItemType &ItemType) -> std::ostream &;
 
+		// Serialisation (only used for baked data)
+		template <class Archive> auto serialize(Archive &archive) -> void {
+			archive(_type, _known_name, _display_name, _unknown_name,
+					_category, _cursed, _value, _sellable, _usable, _alignment,
+					_swings, _to_hit_modifier, _damage_str, _damage_dice,
+					_ac_modifier, _curse_ac_modifier, _regeneration,
+					_offensive_effects, _defensive_effects, _invocation_effect,
+					_invocation_decay_chance, _use_effect, _use_decay_chance,
+					_decay_type, _shop_initial_stock, _discovered_by_player,
+					_description, _gfx, _buy, _sell, _effects, _invokage,
+					_usage);
+		}
+
 		// Public Methods
 		auto get_type_id() const -> Enums::Items::TypeID;
-		auto get_known_name() const -> std::string;
-		auto get_display_name() const -> std::string;
-		auto get_unknown_name() const -> std::string;
+		auto get_known_name() const -> const std::string &;
+		auto get_display_name() const -> const std::string &;
+		auto get_unknown_name() const -> const std::string &;
 		auto get_category() const -> Enums::Items::Category;
 		auto get_cursed() const -> bool;
 		auto get_value() const -> unsigned int;
@@ -121,6 +135,9 @@ class ItemType {
 		auto set_invokage(const std::string value) -> void;
 		auto get_invokage() const -> std::string;
 
+		// Reseed the shared RNG (so that a session can be replayed)
+		static auto seed(const std::uint64_t value) -> void;
+
 	private:
 		// Private Members
 		Enums::Items::TypeID _type; // e.g. LONG_SWORD, LONG_SWORD_PLUS_1 etc
@@ -28,8 +28,23 @@
 #include "types/tile.hpp"
 #include <jsoncpp/json/json.h>
 
+#include <optional>
+#include <set>
+
 namespace Sorcery {
 
+// What has changed on a floor since it was loaded from the LevelStore, which
+// is all that needs saving as the rest can be rebuilt from the depth
+struct LevelDelta {
+		std::optional<int> depth; // nullopt if not a floor from the store
+		std::vector<Coordinate> cleared;
+		std::map<Coordinate, std::vector<Item>> items;
+
+		template <class Archive> auto serialize(Archive &archive) -> void {
+			archive(depth, cleared, items);
+		}
+};
+
 class Level {
 
 	public:
@@ -76,6 +91,9 @@ class Level {
 		auto wrap_size() const -> Size;
 		auto wrap_top_right() const -> Coordinate;
 		auto clear_event(const Coordinate loc) -> void;
+		auto delta() const -> LevelDelta;
+		auto apply(const LevelDelta &delta) -> void;
+		auto rebase(const Level &pristine) -> void;
 
 	private:
 		// Private Members - need getters for these (bot not setters)
@@ -86,6 +104,8 @@ class Level {
 		Size _size;
 		std::map<Coordinate, Tile> _tiles;
 		std::map<std::string, Enums::Map::Event> _event_mappings;
+		std::set<Coordinate> _cleared;
+		bool _stored{false};
 
 		// Private Methods
 		auto _add_tile(const Coordinate location) -> void;
@@ -26,6 +26,7 @@
 #include "types/dice.hpp"
 #include "types/enum.hpp"
 
+#include <cstdint>
 #include <random>
 
 namespace Sorcery {
@@ -40,6 +41,17 @@ class MonsterType {
 		auto friend operator<<(std::ostream &out_stream,
 							   const MonsterType &ItemType) -> std::ostream &;
 
+		// Serialisation (only used for baked data)
+		template <class Archive> auto serialize(Archive &archive) -> void {
+			archive(_type, _known_name, _unknown_name, _known_name_plural,
+					_unknown_name_plural, _group_size, _level, _hit_dice,
+					_known_gfx, _unknown_gfx, _category, _class, _armour_class,
+					_attacks, _breath_weapon, _level_drain, _regeneration,
+					_reward_1, _reward_2, _resistances, _properties, _xp,
+					_partner_type_id, _partner_chance, _mage_level,
+					_priest_level, _spell_resistance, _weaknesses, _traits);
+		}
+
 		// Public Methods
 		auto get_type_id() const -> Enums::Monsters::TypeID;
 		auto get_known_name() const -> std::string;
@@ -106,6 +118,9 @@ class MonsterType {
 		auto has_property(Enums::Monsters::Property value) -> bool;
 		auto clear_attacks() -> void;
 
+		// Reseed the shared RNG (so that a session can be replayed)
+		static auto seed(const std::uint64_t value) -> void;
+
 	private:
 		// Private Members
 		Enums::Monsters::TypeID _type;
@@ -0,0 +1,71 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#pragma once
+
+#include "types/internedid.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace Sorcery {
+
+// A component property name interned into a process-wide id, so that each
+// Component can find a property with a single array index instead of having
+// to compare strings
+struct PropertyTag {
+		static constexpr std::size_t CAPACITY{
+			std::numeric_limits<std::size_t>::max()};
+		static constexpr auto NAME{"property"};
+};
+using PropertyId = InternedId<PropertyTag>;
+
+// What a property must parse as for a layout to be accepted
+enum class PropertyKind {
+	TEXT,
+	NUMBER,
+	BOOLEAN
+};
+
+// A property value parsed once when the layout is loaded, along with its
+// original text (for those properties that are used as strings)
+struct Property {
+		std::size_t id;
+		std::string text;
+		bool numeric;
+		int integer;
+		float number;
+		bool boolean;
+
+		static auto kind_of(std::string_view key) -> PropertyKind;
+		static auto parse(const PropertyId &key, std::string_view value)
+			-> std::optional<Property>;
+};
+
+}
+
+// A literal property name, interned at startup
+#define PROPERTY(key) (Sorcery::interned<Sorcery::PropertyTag, key>)
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include "common/types.hpp"
 #include "types/enum.hpp"
 #include "types/explore.hpp"
+#include "types/gamelog.hpp"
 #include "types/level.hpp"
 
 #include <memory>
@@ -45,13 +46,73 @@ class State {
 		State();
 		State(Context *ctx);
 
-		// Serialisation
-		template <class Archive> auto serialize(Archive &archive) -> void {
-			archive(_version, _party, level, explored, _player_depth,
+		// Serialisation - the current floor is saved only as the changes made
+		// to it, and is rebuilt from the LevelStore by set() after loading
+		// (saves older than VERSION 2 have the whole floor in them instead),
+		// and the log only as what is still in its ring (before VERSION 3 it
+		// was saved whole)
+		template <class Archive> auto save(Archive &archive) const -> void {
+			archive(VERSION, _party, level->delta(), explored, _player_depth,
 					_previous_depth, _player_pos, _previous_pos,
 					_playing_facing, _lit, _turns, _log, _shop);
 		}
 
+		template <class Archive> auto load(Archive &archive) -> void {
+			archive(_version, _party);
+			if (_version < 2) {
+				archive(level);
+				_rebase_floor = true;
+			} else {
+				LevelDelta delta{};
+				archive(delta);
+				level = std::make_unique<Level>();
+				_floor = std::move(delta);
+			}
+			archive(explored, _player_depth, _previous_depth, _player_pos,
+					_previous_pos, _playing_facing, _lit, _turns);
+			if (_version < 3) {
+				std::vector<ConsoleMessage> log{};
+				archive(log);
+				_log.clear();
+				for (auto &message : log)
+					_log.add(std::move(message));
+			} else
+				archive(_log);
+			archive(_shop);
+			_version = VERSION;
+		}
+
+		// As above but without the console log, whose messages are stamped
+		// with the wall clock (used to compare a replay with its recording)
+		template <class Archive> auto checkpoint(Archive &archive) -> void {
+			archive(_version, _party, level, explored, _player_depth,
+					_previous_depth, _player_pos, _previous_pos,
+					_playing_facing, _lit, _turns, _shop);
+		}
+
+		// Only what a turn of movement can change - the party and where it
+		// is, what has been explored of the current floor and the changes
+		// made to it - for undoing a turn without the rest of the game
+		template <class Archive>
+		auto save_turn(Archive &archive) const -> void {
+			const auto it{explored.find(_player_depth)};
+			archive(_party, _player_depth, _previous_depth, _player_pos,
+					_previous_pos, _playing_facing, _lit, _turns,
+					level->delta(),
+					it != explored.end() ? it->second : Explore{});
+		}
+
+		template <class Archive> auto load_turn(Archive &archive) -> void {
+			LevelDelta delta{};
+			archive(_party, _player_depth, _previous_depth, _player_pos,
+					_previous_pos, _playing_facing, _lit, _turns, delta);
+			archive(explored[_player_depth]);
+			_floor = std::move(delta);
+			_restore_floor();
+		}
+
+		static constexpr int VERSION{3};
+
 		// Public Members
 		bool valid;
 		std::unique_ptr<Level> level; // current level
@@ -101,6 +162,8 @@ class State {
 			-> void;
 		auto get_log_messages(unsigned int last = 0) const
 			-> std::vector<ConsoleMessage>;
+		auto flush_log_journal() -> void;
+		auto erase_log_journal() -> void;
 		auto print() -> void;
 		auto check_shop_stock(const Enums::Items::TypeID item_type) const
 			-> int;
@@ -123,6 +186,7 @@ class State {
 		auto _clear() -> void;
 		auto _clear_explored() -> void;
 		auto _restart_expedition() -> void;
+		auto _restore_floor() -> void;
 
 		// Private Members
 		Context *_ctx;
@@ -135,7 +199,9 @@ class State {
 		bool _lit;
 		int _version;
 		unsigned int _turns;
-		std::vector<ConsoleMessage> _log;
+		GameLog _log;
 		std::array<ShopStock, 101> _shop; // Max ItemID + 1 as its 0-indexed
+		std::optional<LevelDelta> _floor; // loaded but not yet restored
+		bool _rebase_floor{false};		  // loaded whole from an old save
 };
 }
@@ -0,0 +1,344 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "common/enum.hpp"
+#include "core/context.hpp"
+#include "resources/bakedfile.hpp"
+#include "resources/componentstore.hpp"
+#include "resources/define.hpp"
+#include "resources/itemstore.hpp"
+#include "resources/monsterstore.hpp"
+#include "resources/stringstore.hpp"
+#include "types/dice.hpp"
+#include "types/enum.hpp"
+#include "types/meta.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <print>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <jsoncpp/json/json.h>
+
+// Data baker: checks that items.json, monsters.json, strings.json and
+// layout.json are well-formed and that every enum name, dice string and
+// effect list in them resolves, then writes the resolved items, monsters and
+// strings into a single versioned file that the stores load in place of the
+// JSON for as long as it is current. It exits non-zero (without writing
+// anything) if a file has errors, so that a broken edit fails the build
+//
+//     sorcery-bake <data directory> [output file]
+
+namespace {
+
+using namespace Sorcery;
+
+class Report {
+
+	public:
+		auto fail(std::string_view file, std::string_view message) -> void {
+
+			std::println(stderr, "{}: {}", file, message);
+			++_errors;
+		}
+
+		auto errors() const -> std::size_t {
+
+			return _errors;
+		}
+
+	private:
+		std::size_t _errors{0};
+};
+
+auto parse(const std::filesystem::path &path, Report &report)
+	-> std::optional<Json::Value> {
+
+	std::ifstream file{path, std::ios::binary};
+	if (!file.is_open()) {
+		report.fail(path.filename().string(), "unable to open");
+		return std::nullopt;
+	}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+	Json::Reader reader{};
+#pragma GCC diagnostic pop
+	Json::Value root{};
+	if (!reader.parse(file, root)) {
+		report.fail(path.filename().string(),
+					reader.getFormattedErrorMessages());
+		return std::nullopt;
+	}
+
+	return root;
+}
+
+auto split(std::string_view value) -> std::vector<std::string_view> {
+
+	std::vector<std::string_view> terms;
+	while (!value.empty()) {
+		const auto comma{value.find(',')};
+		if (const auto term{value.substr(0, comma)}; !term.empty())
+			terms.emplace_back(term);
+		if (comma == std::string_view::npos)
+			break;
+		value.remove_prefix(comma + 1);
+	}
+
+	return terms;
+}
+
+// Optional string fields are treated as absent when empty, as the loaders do
+auto field(const Json::Value &entry, const char *name) -> std::string {
+
+	return entry.isMember(name) ? entry[name].asString() : std::string{};
+}
+
+template <Enum E>
+auto check_enum(Report &report, std::string_view file, std::string_view where,
+				const Json::Value &entry, const char *name) -> void {
+
+	if (const auto value{field(entry, name)};
+		!value.empty() && !enum_cast<E>(value))
+		report.fail(file, std::format("{}: unknown {} '{}'", where, name,
+									  value));
+}
+
+// Comma separated effect names, each of which may be negated with a '!'
+template <Enum E>
+auto check_effects(Report &report, std::string_view file,
+				   std::string_view where, const Json::Value &entry,
+				   const char *name, const std::set<std::string_view> &extra)
+	-> void {
+
+	const auto value{field(entry, name)};
+	for (auto term : split(value)) {
+		if (term.starts_with('!'))
+			term.remove_prefix(1);
+		if (!extra.contains(term) && !enum_cast<E>(term))
+			report.fail(file, std::format("{}: unknown {} effect '{}'", where,
+										  name, term));
+	}
+}
+
+auto check_dice(Report &report, std::string_view file, std::string_view where,
+				std::string_view name, std::string_view value) -> void {
+
+	if (!Dice::parse(value))
+		report.fail(file, std::format("{}: {} '{}' is not a dice roll", where,
+									  name, value));
+}
+
+// The stores index by id, so ids must run from zero with no gaps
+template <Enum E>
+auto check_ids(Report &report, std::string_view file, const Json::Value &list)
+	-> void {
+
+	std::vector<bool> seen(list.size(), false);
+	for (auto i = 0u; i < list.size(); i++) {
+		const auto &id{list[i]["id"]};
+		if (!id.isIntegral() || !enum_cast<E>(id.asInt())) {
+			report.fail(file, std::format("entry {}: invalid id", i));
+			continue;
+		}
+		const auto value{static_cast<std::size_t>(id.asInt())};
+		if (value >= seen.size() || seen[value])
+			report.fail(file, std::format("entry {}: id {} is duplicated or "
+										  "leaves a gap",
+										  i, value));
+		else
+			seen[value] = true;
+	}
+}
+
+auto check_items(const Json::Value &root, Report &report) -> void {
+
+	const auto file{ITEMS_FILE};
+	const auto &items{root["item"]};
+	if (!items.isArray() || items.empty()) {
+		report.fail(file, "no items");
+		return;
+	}
+
+	check_ids<Enums::Items::TypeID>(report, file, items);
+	for (auto i = 0u; i < items.size(); i++) {
+		const auto &item{items[i]};
+		const auto where{std::format("item {}", item["id"].asInt())};
+
+		check_enum<Enums::Items::Category>(report, file, where, item,
+										   "category");
+		check_enum<Enums::Magic::SpellID>(report, file, where, item, "use");
+		check_enum<Enums::Items::Effects::Invoke>(report, file, where, item,
+												  "invoke");
+		check_effects<Enums::Items::Effects::Offensive>(
+			report, file, where, item, "offensive", {});
+		check_effects<Enums::Items::Effects::Defensive>(
+			report, file, where, item, "defensive",
+			{"RESIST_ALL", "PROTECT_VS_ALL"});
+		if (const auto damage{field(item, "damage")}; !damage.empty())
+			check_dice(report, file, where, "damage", damage);
+		if (!item["value"].isConvertibleTo(Json::uintValue))
+			report.fail(file, std::format("{}: invalid value", where));
+		if (field(item, "allowed classes").find_first_not_of("fmptbsln") !=
+			std::string::npos)
+			report.fail(file, std::format("{}: unknown allowed class", where));
+		if (field(item, "allowed alignments").find_first_not_of("gne") !=
+			std::string::npos)
+			report.fail(file,
+						std::format("{}: unknown allowed alignment", where));
+	}
+}
+
+auto check_monsters(const Json::Value &root, Report &report) -> void {
+
+	const auto file{MONSTERS_FILE};
+	const auto &monsters{root["monster"]};
+	if (!monsters.isArray() || monsters.empty()) {
+		report.fail(file, "no monsters");
+		return;
+	}
+
+	check_ids<Enums::Monsters::TypeID>(report, file, monsters);
+	for (auto i = 0u; i < monsters.size(); i++) {
+		const auto &monster{monsters[i]};
+		const auto where{std::format("monster {}", monster["id"].asInt())};
+
+		// Humanoids give their class in place of a category
+		if (const auto category{field(monster, "category")};
+			!category.empty() &&
+			!enum_cast<Enums::Monsters::Category>(category) &&
+			!enum_cast<Enums::Monsters::Class>(category))
+			report.fail(file, std::format("{}: unknown category '{}'", where,
+										  category));
+
+		check_dice(report, file, where, "group size",
+				   field(monster, "group size"));
+		check_dice(report, file, where, "hit dice", field(monster, "hit dice"));
+		for (const auto attack : split(field(monster, "attacks")))
+			check_dice(report, file, where, "attack", attack);
+
+		if (monster.isMember("partner id") &&
+			monster["partner id"].asUInt() >= monsters.size())
+			report.fail(file, std::format("{}: unknown partner id", where));
+	}
+}
+
+auto check_strings(const Json::Value &root, Report &report) -> void {
+
+	const auto file{STRINGS_FILE};
+	if (!root.isObject() || root.empty()) {
+		report.fail(file, "no strings");
+		return;
+	}
+
+	for (const auto &key : root.getMemberNames())
+		if (!root[key].isString())
+			report.fail(file, std::format("'{}' is not a string", key));
+}
+
+}
+
+auto main(int argc, char **argv) -> int {
+
+	if (argc < 2) {
+		std::println(stderr, "Usage: {} <data directory> [output file]",
+					 argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	const std::filesystem::path directory{argv[1]};
+	const std::filesystem::path output{argc > 2 ? std::filesystem::path{argv[2]}
+												: directory / BAKE_FILE};
+
+	try {
+
+		Report report{};
+		if (const auto root{parse(directory / ITEMS_FILE, report)})
+			check_items(*root, report);
+		if (const auto root{parse(directory / MONSTERS_FILE, report)})
+			check_monsters(*root, report);
+		if (const auto root{parse(directory / STRINGS_FILE, report)})
+			check_strings(*root, report);
+
+		// The layout has its own checks (that everything the code refers to
+		// is present), which throw if they fail
+		try {
+			const Resource layout{directory / LAYOUT_FILE};
+			if (const ComponentStore components{layout};
+				components.all().empty())
+				report.fail(LAYOUT_FILE, "no components");
+		} catch (const std::runtime_error &e) {
+			report.fail(LAYOUT_FILE, e.what());
+		}
+
+		if (report.errors() > 0) {
+			std::println(stderr, "{} errors, nothing baked", report.errors());
+			return EXIT_FAILURE;
+		}
+
+		// Now load everything through the stores themselves, so that what
+		// is baked is exactly what they would have loaded from the JSON
+		const Resource items{directory / ITEMS_FILE};
+		const Resource monsters{directory / MONSTERS_FILE};
+		const Resource strings{directory / STRINGS_FILE};
+		StringStore string_store{strings};
+		Context ctx{};
+		ctx.strings = &string_store;
+		const ItemStore item_store{ctx, items};
+		const MonsterStore monster_store{monsters};
+
+		std::vector<BakedFile::Section> sections;
+		sections.emplace_back(BakedFile::section(ITEMS_FILE, items,
+												 ItemStore::bake_schema(),
+												 item_store.bake()));
+		sections.emplace_back(BakedFile::section(MONSTERS_FILE, monsters,
+												 MonsterStore::bake_schema(),
+												 monster_store.bake()));
+		sections.emplace_back(BakedFile::section(STRINGS_FILE, strings,
+												 StringStore::bake_schema(),
+												 string_store.bake()));
+		BakedFile::write(output, sections);
+
+		std::println("Baked {} item types, {} monster types and strings "
+					 "into {} ({} bytes)",
+					 item_store.get_all_types().size(),
+					 monster_store.get_all_types().size(), output.string(),
+					 std::filesystem::file_size(output));
+
+	} catch (const std::exception &e) {
+		std::println(stderr, "{}", e.what());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
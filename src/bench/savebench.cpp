@@ -0,0 +1,525 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "common/cereal.hpp"
+#include "core/context.hpp"
+#include "core/controller.hpp"
+#include "core/resources.hpp"
+#include "core/snapshots.hpp"
+#include "core/system.hpp"
+#include "engine/define.hpp"
+#include "resources/define.hpp"
+#include "resources/itemstore.hpp"
+#include "resources/savestore.hpp"
+#include "resources/savewriter.hpp"
+#include "types/game.hpp"
+#include "types/state.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <new>
+#include <print>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Save/load benchmarks: builds synthetic games with rosters of increasing
+// size (each character with a full inventory), a long console log and every
+// floor explored, in a scratch save directory, and then times the real save
+// and load paths against them. For each it reports latency percentiles, how
+// much it wrote, and how many allocations it made. It then compares the save
+// formats for each kind of save - the size on disc, and the time taken to
+// serialise and write it - uncompressed and deflated, and for the game and
+// characters in the XML in JSON that they were saved as before too
+//
+//     sorcery_bench [iterations]
+
+namespace {
+
+std::atomic<std::uint64_t> allocations{0};
+
+}
+
+auto operator new(std::size_t size) -> void * {
+
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	if (auto *address{std::malloc(size == 0 ? 1 : size)})
+		return address;
+
+	throw std::bad_alloc{};
+}
+
+auto operator delete(void *address) noexcept -> void {
+
+	std::free(address);
+}
+
+auto operator delete(void *address, std::size_t) noexcept -> void {
+
+	std::free(address);
+}
+
+namespace {
+
+using namespace Sorcery;
+using clock = std::chrono::steady_clock;
+
+constexpr auto LOG_MESSAGES{5000u};
+
+struct Result {
+		std::string name;
+		std::vector<double> times;
+		std::uint64_t bytes;
+		std::uint64_t allocations;
+};
+
+// Everything Game needs, other than anything to do with the display
+struct Harness {
+		Harness(const std::filesystem::path &directory)
+			: system{std::make_unique<System>(0, nullptr)},
+			  resources{std::make_unique<Resources>(ctx, true)} {
+
+			ctx.system = system.get();
+			ctx.animation = system->animation.get();
+			ctx.audio = system->audio.get();
+			ctx.baked = system->baked.get();
+			ctx.config = system->config.get();
+			ctx.files = system->files.get();
+			ctx.random = system->random.get();
+			ctx.strings = system->strings.get();
+			ctx.resources = resources.get();
+
+			resources->load_monsters();
+			resources->load_items();
+			resources->load_levels();
+			resources->load_spells();
+			resources->saves = std::make_unique<SaveStore>(
+				directory / "game.sav", directory / "characters");
+			resources->writer =
+				std::make_unique<SaveWriter>(*resources->saves);
+			ctx.saves = resources->saves.get();
+			ctx.writer = resources->writer.get();
+
+			game = std::make_unique<Game>(ctx);
+			ctx.game = game.get();
+			controller = std::make_unique<Controller>(ctx);
+			ctx.controller = controller.get();
+			snapshots = std::make_unique<Snapshots>(ctx);
+			ctx.snapshots = snapshots.get();
+		}
+
+		~Harness() {
+
+			ctx.writer->stop();
+			snapshots->wait();
+		}
+
+		Context ctx{};
+		std::unique_ptr<System> system;
+		std::unique_ptr<Resources> resources;
+		std::unique_ptr<Game> game;
+		std::unique_ptr<Controller> controller;
+		std::unique_ptr<Snapshots> snapshots;
+};
+
+// Everything passed to write() by any thread, which includes the SaveWriter
+auto written() -> std::uint64_t {
+
+	std::ifstream io{"/proc/self/io"};
+	std::string key{};
+	std::uint64_t value{};
+	while (io >> key >> value)
+		if (key == "wchar:")
+			return value;
+
+	return 0;
+}
+
+auto disc_usage(const std::filesystem::path &directory) -> std::uint64_t {
+
+	std::uint64_t total{0};
+	for (const auto &entry :
+		 std::filesystem::recursive_directory_iterator{directory})
+		if (entry.is_regular_file())
+			total += entry.file_size();
+
+	return total;
+}
+
+auto populate(Harness &harness, const unsigned int roster) -> void {
+
+	using enum Enums::Character::Class;
+	constexpr std::array classes{FIGHTER, MAGE, PRIEST, THIEF, BISHOP};
+
+	auto &game{*harness.game};
+	for (auto i = 0u; i < roster; i++) {
+		auto pc{Character(&harness.ctx)};
+		pc.create_class_alignment(classes[i % classes.size()],
+								  Enums::Character::Align::NEUTRAL);
+		pc.finalise();
+		pc.set_name(std::format("BENCH{}", i));
+		pc.set_location(Enums::Character::Location::TAVERN);
+		pc.set_stage(Enums::Character::Stage::COMPLETED);
+		while (pc.inventory.get_empty_slots() > 0) {
+			using enum Enums::Items::TypeID;
+			pc.inventory.add(harness.resources->items->get_random_item(
+				LONG_SWORD, RING_OF_DEATH));
+		}
+
+		const auto id{game.save_character(pc)};
+		game.characters[id] = pc;
+	}
+
+	for (auto i = 0u; i < LOG_MESSAGES; i++)
+		game.log(std::format("Benchmark message {} of {}", i, LOG_MESSAGES));
+
+	for (auto depth = -1; depth >= -10; --depth)
+		for (auto y = 0; y < MAP_SIZE; y++)
+			for (auto x = 0; x < MAP_SIZE; x++)
+				game.state->explored[depth].set(Coordinate{x, y});
+
+	game.save_game();
+	harness.ctx.writer->flush();
+}
+
+auto measure(const std::string &name, const unsigned int iterations,
+			 const std::function<void()> &run) -> Result {
+
+	Result result{.name = name, .times = {}, .bytes = 0, .allocations = 0};
+	result.times.reserve(iterations);
+
+	const auto before{written()};
+	const auto allocated{allocations.load()};
+	for (auto i = 0u; i < iterations; i++) {
+		const auto start{clock::now()};
+		run();
+		result.times.emplace_back(
+			std::chrono::duration<double, std::milli>(clock::now() - start)
+				.count());
+	}
+	result.allocations = (allocations.load() - allocated) / iterations;
+	result.bytes = (written() - before) / iterations;
+
+	return result;
+}
+
+// The records that the game and each character were saved as before the
+// binary container, written as SaveStore used to write them (reading the
+// previous record back first, as it had to for the header fields)
+struct LegacyGame {
+		std::uint32_t version{1};
+		unsigned int id{1};
+		std::string key;
+		std::string status;
+		std::int64_t started{};
+		std::int64_t last_played{};
+		std::string data;
+
+		template <class Archive> auto serialize(Archive &archive) -> void {
+			archive(CEREAL_NVP(version), CEREAL_NVP(id), CEREAL_NVP(key),
+					CEREAL_NVP(status), CEREAL_NVP(started),
+					CEREAL_NVP(last_played), CEREAL_NVP(data));
+		}
+};
+
+struct LegacyCharacter {
+		std::uint32_t version{1};
+		unsigned int id{};
+		unsigned int game_id{};
+		std::string name;
+		std::string status;
+		std::int64_t created{};
+		std::string data;
+
+		template <class Archive> auto serialize(Archive &archive) -> void {
+			archive(CEREAL_NVP(version), CEREAL_NVP(id), CEREAL_NVP(game_id),
+					CEREAL_NVP(name), CEREAL_NVP(status), CEREAL_NVP(created),
+					CEREAL_NVP(data));
+		}
+};
+
+template <typename Record, typename T>
+auto write_legacy(const std::filesystem::path &path, const char *name,
+				  const T &value) -> void {
+
+	Record record{};
+	if (std::ifstream input{path}; input.is_open()) {
+		cereal::JSONInputArchive archive{input};
+		archive(cereal::make_nvp(name, record));
+	}
+
+	std::ostringstream xml{};
+	{
+		cereal::XMLOutputArchive archive{xml};
+		archive(value);
+	}
+	record.status = "OK";
+	record.data = std::move(xml).str();
+
+	const std::filesystem::path temporary_file{path.string() + ".tmp"};
+	{
+		std::ofstream output{temporary_file, std::ios::out | std::ios::trunc};
+		cereal::JSONOutputArchive archive{output};
+		archive(cereal::make_nvp(name, record));
+	}
+	std::filesystem::rename(temporary_file, path);
+}
+
+// Each kind of save in each format, where bytes is the size on disc (for a
+// character in the roster, the size of the record added for it)
+auto formats(Harness &harness, const std::filesystem::path &directory,
+			 const unsigned int iterations) -> std::vector<Result> {
+
+	auto &game{*harness.game};
+	auto &saves{*harness.ctx.saves};
+	auto &writer{*harness.ctx.writer};
+	const auto game_id{game.get_id()};
+	const auto first{game.characters.begin()->first};
+	auto &character{game.characters.at(first)};
+
+	const auto game_file{directory / "game.sav"};
+	const auto roster_file{directory / "characters" / ROSTER_FILE};
+	const auto legacy_game_file{directory / "game.json"};
+	const auto legacy_character_file{directory /
+									 std::format("{}.json", first)};
+	const auto quicksave{directory / "quicksave.bin"};
+
+	std::vector<Result> results{};
+	const auto add{[&](const std::string &name,
+					   const std::filesystem::path &file,
+					   const std::function<void()> &run) {
+		auto result{measure(name, iterations, run)};
+		result.bytes = std::filesystem::file_size(file);
+		results.emplace_back(std::move(result));
+	}};
+	const auto update{[&] {
+		character.set_gold(character.get_gold() + 1);
+		game.update_character(game_id, first, character);
+	}};
+
+	// A compaction can shrink the roster, after which the next record can't
+	const auto record_size{[&] {
+		for (auto attempt = 0u; attempt < 2; attempt++) {
+			const auto before{std::filesystem::file_size(roster_file)};
+			update();
+			if (const auto after{std::filesystem::file_size(roster_file)};
+				after > before)
+				return after - before;
+		}
+		return std::uintmax_t{0};
+	}};
+
+	const auto compress{saves.compress.load()};
+
+	add("game, XML in JSON", legacy_game_file, [&] {
+		write_legacy<LegacyGame>(legacy_game_file, "game", game.state);
+	});
+	for (const auto deflate : {false, true}) {
+		saves.compress = deflate;
+		add(deflate ? "game, deflated" : "game, binary", game_file, [&] {
+			game.save_game();
+			writer.flush();
+		});
+	}
+
+	add("character, XML in JSON", legacy_character_file, [&] {
+		character.set_gold(character.get_gold() + 1);
+		write_legacy<LegacyCharacter>(legacy_character_file, "character",
+									  character);
+	});
+	for (const auto deflate : {false, true}) {
+		saves.compress = deflate;
+		auto result{measure(deflate ? "character, deflated"
+									: "character, binary",
+							iterations, update)};
+		result.bytes = record_size();
+		results.emplace_back(std::move(result));
+	}
+
+	for (const auto deflate : {false, true}) {
+		saves.compress = deflate;
+		add(deflate ? "quicksave, deflated" : "quicksave, binary", quicksave,
+			[&] {
+				harness.snapshots->save(quicksave);
+				harness.snapshots->wait();
+			});
+	}
+
+	saves.compress = compress;
+
+	return results;
+}
+
+auto percentile(std::vector<double> times, const double fraction) -> double {
+
+	std::ranges::sort(times);
+	const auto index{static_cast<std::size_t>(
+		fraction * static_cast<double>(times.size() - 1) + 0.5)};
+
+	return times[index];
+}
+
+auto report(const unsigned int roster, const std::uint64_t size,
+			const std::vector<Result> &results) -> std::string {
+
+	auto output{std::format("\nRoster of {} ({} log messages, all floors "
+							"explored, {} bytes of saves)\n",
+							roster, LOG_MESSAGES, size)};
+	output.append(std::format("  {:<28} {:>9} {:>9} {:>9} {:>9} {:>11} "
+							  "{:>9}\n",
+							  "operation", "p50 ms", "p90 ms", "p99 ms",
+							  "max ms", "written/op", "allocs/op"));
+	for (const auto &result : results)
+		output.append(std::format(
+			"  {:<28} {:>9.3f} {:>9.3f} {:>9.3f} {:>9.3f} {:>11} {:>9}\n",
+			result.name, percentile(result.times, 0.5),
+			percentile(result.times, 0.9), percentile(result.times, 0.99),
+			std::ranges::max(result.times), result.bytes,
+			result.allocations));
+
+	return output;
+}
+
+auto report_formats(const std::vector<Result> &results) -> std::string {
+
+	auto output{std::format("\n  {:<28} {:>9} {:>9} {:>11}\n", "save format",
+							"p50 ms", "p90 ms", "bytes")};
+	for (const auto &result : results)
+		output.append(std::format("  {:<28} {:>9.3f} {:>9.3f} {:>11}\n",
+								  result.name, percentile(result.times, 0.5),
+								  percentile(result.times, 0.9),
+								  result.bytes));
+
+	return output;
+}
+
+auto run(const unsigned int roster, const unsigned int iterations)
+	-> std::string {
+
+	const auto directory{std::filesystem::temp_directory_path() /
+						 std::format("sorcery-bench-{}", roster)};
+	std::filesystem::remove_all(directory);
+	std::filesystem::create_directories(directory);
+
+	std::vector<Result> results{};
+	std::vector<Result> format_results{};
+	std::uint64_t size{};
+	{
+		Harness harness{directory};
+		populate(harness, roster);
+		size = disc_usage(directory);
+
+		auto &game{*harness.game};
+		auto &writer{*harness.ctx.writer};
+		const auto game_id{game.get_id()};
+		const auto first{game.characters.begin()->first};
+
+		// Each save changes one character, as after most turns
+		results.emplace_back(measure("save_game (one dirty)", iterations, [&] {
+			auto &character{game.characters.at(first)};
+			character.set_gold(character.get_gold() + 1);
+			game.pass_turn();
+			game.save_game();
+			writer.flush();
+		}));
+		results.emplace_back(measure("save_game (all dirty)", iterations, [&] {
+			for (auto &[id, character] : game.characters)
+				character.set_gold(character.get_gold() + 1);
+			game.save_game();
+			writer.flush();
+		}));
+		results.emplace_back(measure("load_game", iterations, [&] {
+			game.load_game();
+		}));
+		results.emplace_back(measure("update_character", iterations, [&] {
+			auto &character{game.characters.at(first)};
+			character.set_gold(character.get_gold() + 1);
+			game.update_character(game_id, first, character);
+		}));
+
+		const auto quicksave{directory / "quicksave.bin"};
+		results.emplace_back(measure("quicksave", iterations, [&] {
+			harness.snapshots->save(quicksave);
+			harness.snapshots->wait();
+		}));
+		results.emplace_back(measure("quickload (memory)", iterations, [&] {
+			harness.snapshots->load(quicksave);
+		}));
+		results.emplace_back(measure("quickload (disc)", iterations, [&] {
+			Snapshots cold{harness.ctx};
+			cold.load(quicksave);
+		}));
+
+		// As after a move, which is the only thing that can be undone
+		harness.controller->set_can_undo(true);
+		results.emplace_back(measure("turn snapshot", iterations, [&] {
+			game.pass_turn();
+			harness.snapshots->take();
+		}));
+		results.emplace_back(measure("undo", iterations, [&] {
+			harness.snapshots->take();
+			harness.controller->set_can_undo(true);
+			harness.snapshots->rewind();
+		}));
+
+		format_results = formats(harness, directory, iterations);
+	}
+
+	std::filesystem::remove_all(directory);
+
+	return report(roster, size, results) + report_formats(format_results);
+}
+
+}
+
+auto main(int argc, char *argv[]) -> int {
+
+	const auto iterations{
+		argc > 1 ? static_cast<unsigned int>(std::max(1, std::atoi(argv[1])))
+				 : 20u};
+
+	// Audio is never played, but System needs it to start
+	::setenv("SDL_AUDIODRIVER", "dummy", 1);
+
+	// Hold back the debug log until the end, so that it neither slows down
+	// nor is counted in what each operation writes
+	std::setvbuf(stdout, nullptr, _IOFBF, 64 * 1024 * 1024);
+
+	std::string output{};
+	for (const auto roster : {10u, 100u, 1000u})
+		output.append(run(roster, iterations));
+
+	std::println("{}", output);
+
+	return EXIT_SUCCESS;
+}
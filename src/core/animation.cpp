@@ -21,7 +21,6 @@
 // the resulting work.
 
 #include "core/animation.hpp"
-#include "core/random.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -29,8 +28,7 @@
 #include <thread>
 
 // Standard Constructor
-Sorcery::Animation::Animation(Random *random)
-	: _random{random} {
+Sorcery::Animation::Animation() : _random{std::random_device{}()} {
 
 	_finished = false;
 	_attract_mode.clear();
@@ -203,7 +201,7 @@ auto Sorcery::Animation::_do_wp() -> void {
 
 	std::scoped_lock<std::mutex> scoped_lock(_wp_mutex);
 
-	wp_idx = _random->get(Enums::System::Random::D165);
+	wp_idx = _roll(1, 165);
 	_last_wp = std::chrono::steady_clock::now();
 }
 
@@ -211,13 +209,13 @@ auto Sorcery::Animation::_do_attract() -> void {
 
 	std::scoped_lock lock{_attract_mutex};
 
-	const auto count{_random->get(Enums::System::Random::D4)};
+	const auto count{_roll(1, 4)};
 
 	_attract_mode.clear();
 	_attract_mode.reserve(count);
 
 	while (_attract_mode.size() < count) {
-		const auto index{_random->get(Enums::System::Random::ZERO_TO_399)};
+		const auto index{_roll(0, 399)};
 
 		if (!std::ranges::contains(_attract_mode, index))
 			_attract_mode.push_back(index);
@@ -226,6 +224,15 @@ auto Sorcery::Animation::_do_attract() -> void {
 	_last_attract = std::chrono::steady_clock::now();
 }
 
+// Both the wallpaper and the attract mode threads come here
+auto Sorcery::Animation::_roll(const unsigned int min, const unsigned int max)
+	-> unsigned int {
+
+	std::scoped_lock lock{_random_mutex};
+
+	return std::uniform_int_distribution<unsigned int>{min, max}(_random);
+}
+
 auto Sorcery::Animation::get_attract_data() -> std::vector<unsigned int> {
 
 	std::scoped_lock<std::mutex> scoped_lock(_attract_mutex);
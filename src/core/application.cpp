@@ -23,10 +23,14 @@
 #include "core/application.hpp"
 #include "core/animation.hpp"
 #include "core/audioplayer.hpp"
+#include "core/bootstrap.hpp"
 #include "core/controller.hpp"
 #include "core/debug.hpp"
 #include "core/display.hpp"
+#include "core/filewatcher.hpp"
+#include "core/replay.hpp"
 #include "core/resources.hpp"
+#include "core/snapshots.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
 #include "engine/define.hpp"
@@ -36,16 +40,22 @@
 #include "gui/define.hpp"
 #include "modules/castle.hpp"
 #include "modules/edgeoftown.hpp"
+#include "resources/componentstore.hpp"
 #include "resources/filestore.hpp"
 #include "resources/imagestore.hpp"
 #include "resources/itemstore.hpp"
 #include "resources/levelstore.hpp"
 #include "resources/monsterstore.hpp"
+#include "resources/savestore.hpp"
+#include "resources/savewriter.hpp"
 #include "types/config.hpp"
 #include "types/game.hpp"
 #include "types/state.hpp"
 
+#include <cstdlib>
 #include <fstream>
+#include <print>
+#include <ranges>
 
 // Standard Constructor
 Sorcery::Application::Application(int argc, char **argv) {
@@ -64,6 +74,7 @@ Sorcery::Application::Application(int argc, char **argv) {
 		}
 		std::cerr << "errno: " << errno << ": " << std::strerror(errno)
 				  << std::endl;
+		Replay::flush_recording();
 		std::abort();
 	});
 
@@ -84,82 +95,122 @@ Sorcery::Application::Application(int argc, char **argv) {
 	ctx = Context{};
 	ctx.application = this;
 
-	// Set up all the Core Modules (and populate the DI helper as we go)
-	_system = std::make_unique<System>(argc, argv);
-	ctx.system = _system.get();
-	ctx.animation = _system->animation.get();
-	ctx.audio = _system->audio.get();
-	ctx.config = _system->config.get();
-	ctx.files = _system->files.get();
-	ctx.random = _system->random.get();
-	ctx.strings = _system->strings.get();
-	_resources = std::make_unique<Resources>(ctx);
-	ctx.resources = _resources.get();
-	ctx.saves = _resources->saves.get();
-	_display = std::make_unique<Display>(ctx);
-	ctx.display = _display.get();
-	_controller = std::make_unique<Controller>(ctx);
-	ctx.controller = _controller.get();
-	_ui = std::make_unique<UI>(ctx);
-	ctx.ui = _ui.get();
-	ctx.menubuilder = _ui->menubuilder.get();
-	ctx.components = _ui->components.get();
-	ctx.images = _ui->images.get();
-	ctx.fonts = _ui->fontstore.get();
-
-	_game = std::make_unique<Game>(ctx);
-	ctx.game = _game.get();
-
-	// Frontend Game Modules
-	_main_menu = std::make_unique<MainMenu>(ctx);
-	_splash = std::make_unique<Splash>(ctx);
-
-	// Castle/Town/etc Modules
-	_castle = std::make_unique<Castle>(ctx);
-	_edge_of_town = std::make_unique<EdgeOfTown>(ctx);
-
-	// Game Engine
-	_engine = std::make_unique<Engine>(ctx);
+	// Set up all the Core Modules (and populate the DI helper as we go) - the
+	// JSON-heavy stores don't need SDL/OpenGL so they are loaded on worker
+	// threads whilst the Display is initialised here on the main thread
+	using enum BootstrapLane;
+	Bootstrap bootstrap{};
+	std::unique_ptr<ComponentStore> layout{};
+
+	bootstrap.add("system", MAIN, {}, [&] {
+		_system = std::make_unique<System>(argc, argv);
+		ctx.system = _system.get();
+		ctx.animation = _system->animation.get();
+		ctx.audio = _system->audio.get();
+		ctx.baked = _system->baked.get();
+		ctx.config = _system->config.get();
+		ctx.files = _system->files.get();
+		ctx.random = _system->random.get();
+		ctx.strings = _system->strings.get();
+		_resources = std::make_unique<Resources>(ctx, true);
+		ctx.resources = _resources.get();
+	});
+	bootstrap.add("replay", MAIN, {"system"}, [&] {
+		_replay = std::make_unique<Replay>(ctx);
+		ctx.replay = _replay.get();
+		_start_replay();
+	});
+	bootstrap.add("monsters", WORKER, {"system"}, [&] {
+		_resources->load_monsters();
+	});
+	bootstrap.add("items", WORKER, {"system"}, [&] {
+		_resources->load_items();
+	});
+	bootstrap.add("levels", WORKER, {"system"}, [&] {
+		_resources->load_levels();
+	});
+	bootstrap.add("spells", WORKER, {"system"}, [&] {
+		_resources->load_spells();
+	});
+	bootstrap.add("saves", WORKER, {"replay"}, [&] {
+		_resources->load_saves();
+		ctx.saves = _resources->saves.get();
+		ctx.writer = _resources->writer.get();
+	});
+	bootstrap.add("layout", WORKER, {"system"}, [&] {
+		layout =
+			std::make_unique<ComponentStore>(ctx.get_resource(LAYOUT_FILE));
+	});
+	bootstrap.add("game", WORKER,
+				  {"monsters", "items", "levels", "spells", "saves"}, [&] {
+					  _game = std::make_unique<Game>(ctx);
+					  ctx.game = _game.get();
+					  _snapshots = std::make_unique<Snapshots>(ctx);
+					  ctx.snapshots = _snapshots.get();
+				  });
+	bootstrap.add("display", MAIN, {"system"}, [&] {
+		_display = std::make_unique<Display>(ctx);
+		ctx.display = _display.get();
+	});
+	bootstrap.add("controller", MAIN, {"display", "saves"}, [&] {
+		_controller = std::make_unique<Controller>(ctx);
+		ctx.controller = _controller.get();
+	});
+	bootstrap.add("ui", MAIN, {"controller", "layout"}, [&] {
+		_ui = std::make_unique<UI>(ctx, std::move(layout));
+		ctx.ui = _ui.get();
+		ctx.menubuilder = _ui->menubuilder.get();
+		ctx.components = _ui->components.get();
+		ctx.images = _ui->images.get();
+		ctx.fonts = _ui->fontstore.get();
+	});
+	bootstrap.add("modules", MAIN, {"ui", "game"}, [&] {
+
+		// Frontend Game Modules
+		_main_menu = std::make_unique<MainMenu>(ctx);
+		_splash = std::make_unique<Splash>(ctx);
+
+		// Castle/Town/etc Modules
+		_castle = std::make_unique<Castle>(ctx);
+		_edge_of_town = std::make_unique<EdgeOfTown>(ctx);
+
+		// Game Engine
+		_engine = std::make_unique<Engine>(ctx);
+	});
+	bootstrap.run();
+
+	// Command-line parameters (debug-only)
+	constexpr auto PARAM_STARTUP_REPORT{"--startup-report"sv};
+	if (_check_param(PARAM_STARTUP_REPORT))
+		std::print("{}", bootstrap.report());
+
+	// Rebuild the resource pack from the files just loaded
+	constexpr auto PARAM_WRITE_PACK{"--write-pack"sv};
+	if (_check_param(PARAM_WRITE_PACK))
+		std::println("Wrote {} files to {}", ctx.files->write_pack(),
+					 (ctx.files->get_base_path() / PACK_FILE).string());
 }
 
 auto Sorcery::Application::save_state_to_binary(const std::string &filename)
 	-> bool {
 
-	std::ofstream os(filename, std::ios::binary);
-	if (!os.is_open()) {
-		std::cerr << "Error: could not open " << filename << " for writing.\n";
-		return false;
-	}
-
 	// Note we serialize FROM existing objects thus no need to reinject after
-	cereal::BinaryOutputArchive archive(os);
-	archive(*_game, *_controller);
-
-	DEBUG_LOGF("Quicksave successfully written to {}!", filename);
-
-	return true;
+	return _snapshots->save(filename);
 }
 
 auto Sorcery::Application::load_state_from_binary(const std::string &filename)
 	-> bool {
 
-	std::ifstream is(filename, std::ios::binary);
-	if (!is.is_open()) {
-		std::cerr << "Error: could not open " << filename << " for reading.\n";
-		return false;
-	}
-
-	// Note we serialize INTO existing objects thus no need to reinject
-	cereal::BinaryInputArchive archive(is);
-	archive(*_game, *_controller);
-
-	DEBUG_LOGF("Quicksave successfully loaded from {}!", filename);
-
-	return true;
+	return _snapshots->load(filename);
 }
 
 // Default Destructor
-Sorcery::Application::~Application() {}
+Sorcery::Application::~Application() {
+
+	// The watcher calls back into the UI, which is destroyed before System
+	if (_system && _system->watcher)
+		_system->watcher->stop();
+}
 
 auto Sorcery::Application::get_resources() const -> Resources * {
 
@@ -179,7 +230,7 @@ auto Sorcery::Application::start() -> int {
 	ctx.animation->refresh_wp();
 	ctx.animation->start_wp_th();
 
-	ctx.audio->load(ctx.files->get(MAINMENU_MUSIC));
+	ctx.audio->load(ctx.get_resource(MAINMENU_MUSIC));
 	ctx.audio->set_volume(0.0f);
 
 	const auto plan{_build_startup_plan()};
@@ -233,12 +284,12 @@ auto Sorcery::Application::start() -> int {
 	ctx.audio->stop();
 	ctx.ui->stop();
 
-	return 0;
+	return ctx.replay->failed() ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
 auto Sorcery::Application::_run_town() -> AppFlow {
 
-	ctx.audio->load(ctx.files->get(TOWN_MUSIC));
+	ctx.audio->load(ctx.get_resource(TOWN_MUSIC));
 	ctx.audio->set_volume(0.0f);
 	ctx.audio->play();
 
@@ -318,7 +369,7 @@ auto Sorcery::Application::_run_maze(const int mode) -> AppFlow {
 
 	ctx.game->enter_maze();
 
-	ctx.audio->load(ctx.files->get(ENGINE_MUSIC));
+	ctx.audio->load(ctx.get_resource(ENGINE_MUSIC));
 	ctx.audio->set_volume(0.0f);
 	ctx.audio->play();
 
@@ -339,7 +390,7 @@ auto Sorcery::Application::_run_restart_maze(const int mode) -> AppFlow {
 	ctx.game->restart_maze(
 		ctx.controller->get_character(Enums::CharacterSlot::RESTART));
 
-	ctx.audio->load(ctx.files->get(ENGINE_MUSIC));
+	ctx.audio->load(ctx.get_resource(ENGINE_MUSIC));
 	ctx.audio->set_volume(0.0f);
 	ctx.audio->play();
 
@@ -365,6 +416,7 @@ auto Sorcery::Application::_build_startup_plan() -> StartupPlan {
 	constexpr auto PARAM_START_ENGINE{"--start-engine"sv};
 	constexpr auto PARAM_GO_TO{"--go-to"sv};
 	constexpr auto PARAM_MUTE{"--mute"sv};
+	constexpr auto PARAM_COMPRESS{"--compress"sv};
 
 	const bool load_game{_check_param(PARAM_LOAD_GAME)};
 	const bool new_game{_check_param(PARAM_NEW_GAME)};
@@ -375,8 +427,10 @@ auto Sorcery::Application::_build_startup_plan() -> StartupPlan {
 	// Independent global modifier
 	if (_check_param(PARAM_NO_IMAGES))
 		ctx.images->show_images = false;
-	if (_check_param(PARAM_MUTE))
+	if (_check_param(PARAM_MUTE) || ctx.replay->hidden())
 		ctx.audio->mute = true;
+	if (_check_param(PARAM_COMPRESS))
+		ctx.saves->compress = true;
 
 	// Validate mutually exclusive bootstrap options
 	const int bootstrap_count =
@@ -428,17 +482,22 @@ auto Sorcery::Application::_build_startup_plan() -> StartupPlan {
 
 auto Sorcery::Application::update() -> void {
 
-	if (signal_shutdown_requested()) {
-		ctx.controller->set_flag("want_abort_game");
-		ctx.controller->set_flag("want_exit_game");
+	ctx.replay->tick();
+
+	if (signal_shutdown_requested() || ctx.replay->finished()) {
+		ctx.controller->set_flag(CONTROL("want_abort_game"));
+		ctx.controller->set_flag(CONTROL("want_exit_game"));
 	}
 
 	ctx.audio->update();
+
+	// Swap in any data files that have been edited since the last frame
+	ctx.system->watcher->update();
 }
 
 auto Sorcery::Application::_run_main_menu() -> AppFlow {
 
-	ctx.audio->load(ctx.files->get(MAINMENU_MUSIC));
+	ctx.audio->load(ctx.get_resource(MAINMENU_MUSIC));
 	ctx.audio->set_volume(0.0f);
 	ctx.audio->play();
 
@@ -468,7 +527,7 @@ auto Sorcery::Application::_do_restart_expedition(const int mode) -> int {
 	ctx.game->restart_maze(
 		ctx.controller->get_character(Enums::CharacterSlot::RESTART));
 
-	ctx.audio->load(ctx.files->get(ENGINE_MUSIC));
+	ctx.audio->load(ctx.get_resource(ENGINE_MUSIC));
 	ctx.audio->set_volume(0.0f);
 
 	auto what{_engine->start(mode)};
@@ -481,7 +540,7 @@ auto Sorcery::Application::_do_restart_expedition(const int mode) -> int {
 auto Sorcery::Application::_do_start_expedition(const int mode) -> int {
 
 	ctx.game->enter_maze();
-	ctx.audio->load(ctx.files->get(ENGINE_MUSIC));
+	ctx.audio->load(ctx.get_resource(ENGINE_MUSIC));
 	ctx.audio->set_volume(0.0f);
 	auto what{_engine->start(mode)};
 	_engine->stop();
@@ -619,6 +678,10 @@ auto Sorcery::Application::_continue_existing_game() -> int {
 // Stop the Game
 auto Sorcery::Application::stop() -> void {
 
+	// Make sure that anything still being saved reaches the disk
+	ctx.writer->stop();
+	ctx.snapshots->wait();
+
 	// Stop relevant animation worker threads
 	ctx.animation->stop_colcyc_th();
 	ctx.animation->stop_wp_th();
@@ -630,6 +693,30 @@ auto Sorcery::Application::_check_param(std::string_view param) const -> bool {
 	return std::ranges::contains(_args, param);
 }
 
+// Record this session, or play a recorded one back in place of it (in which
+// case the arguments it was recorded with are used instead of our own)
+auto Sorcery::Application::_start_replay() -> void {
+
+	// Command-line parameters (debug-only)
+	constexpr auto PARAM_RECORD{"--record"sv};
+	constexpr auto PARAM_REPLAY{"--replay"sv};
+
+	const auto path{ctx.get_file(REPLAY_FILENAME)};
+	if (_check_param(PARAM_REPLAY)) {
+		_replay->play(path);
+		_args.resize(1);
+		_args.insert(_args.end(), _replay->args().begin(),
+					 _replay->args().end());
+		_args.emplace_back(PARAM_REPLAY);
+	} else if (_check_param(PARAM_RECORD)) {
+		std::vector<std::string> args{};
+		for (const auto &arg : _args | std::views::drop(1))
+			if (arg != PARAM_RECORD)
+				args.emplace_back(arg);
+		_replay->record(path, std::move(args));
+	}
+}
+
 auto Sorcery::Application::install_signal_handlers() -> void {
 
 	std::signal(SIGTERM, _handle_signal);
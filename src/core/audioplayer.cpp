@@ -73,6 +73,9 @@ void Sorcery::AudioPlayer::free_resources() {
 	if (_swr)
 		swr_free(&_swr);
 
+	// Only once the format context that reads from it has gone
+	_input.reset();
+
 	_packet = nullptr;
 	_frame = nullptr;
 	_codec = nullptr;
@@ -82,14 +85,19 @@ void Sorcery::AudioPlayer::free_resources() {
 	_stream_index = -1;
 }
 
-void Sorcery::AudioPlayer::load(const std::string &filename) {
+void Sorcery::AudioPlayer::load(const Resource &resource) {
 
 	PROFILE_SCOPE("AudioPlayer::load");
-	DEBUG_LOGF("Loading Resource: {}", filename);
+	DEBUG_LOGF("Loading Resource: {}", resource.path.string());
 
 	free_resources();
 
-	if (avformat_open_input(&_fmt, filename.c_str(), nullptr, nullptr) < 0)
+	if (resource.packed()) {
+		_input = std::make_unique<PackedInput>(resource.data);
+		if (_input->open(&_fmt) < 0)
+			throw std::runtime_error("Failed to open audio file");
+	} else if (avformat_open_input(&_fmt, resource.path.c_str(), nullptr,
+								   nullptr) < 0)
 		throw std::runtime_error("Failed to open audio file");
 
 	if (avformat_find_stream_info(_fmt, nullptr) < 0)
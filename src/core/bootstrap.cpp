@@ -0,0 +1,168 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/bootstrap.hpp"
+#include "core/debug.hpp"
+
+#include <exception>
+#include <format>
+#include <stdexcept>
+
+Sorcery::Bootstrap::Bootstrap() {
+
+	_phases.clear();
+}
+
+// Add a phase; dependencies must already have been added, which also
+// guarantees that the graph can never contain a cycle
+auto Sorcery::Bootstrap::add(std::string_view name, const BootstrapLane lane,
+							 std::vector<std::string> depends,
+							 std::function<void()> task) -> void {
+
+	Phase phase{.name = std::string{name},
+				.lane = lane,
+				.depends = {},
+				.task = std::move(task),
+				.done = {},
+				.queued = {},
+				.started = {},
+				.finished = {}};
+
+	for (const auto &depend : depends)
+		phase.depends.emplace_back(_find(depend));
+
+	_phases.emplace_back(std::move(phase));
+}
+
+auto Sorcery::Bootstrap::run() -> void {
+
+	_start = clock::now();
+
+	// Main phases signal completion through a promise, worker phases through
+	// their std::async future - either way everything waits on shared_futures
+	std::vector<std::promise<void>> promises(_phases.size());
+	for (auto i = 0u; i < _phases.size(); i++) {
+		auto &phase{_phases[i]};
+		phase.queued = _start;
+		if (phase.lane == BootstrapLane::MAIN)
+			phase.done = promises[i].get_future().share();
+		else
+			phase.done = std::async(std::launch::async, [this, &phase] {
+							 _wait(phase);
+							 _execute(phase);
+						 }).share();
+	}
+
+	for (auto i = 0u; i < _phases.size(); i++) {
+		auto &phase{_phases[i]};
+		if (phase.lane != BootstrapLane::MAIN)
+			continue;
+
+		try {
+			phase.queued = clock::now();
+			_wait(phase);
+			_execute(phase);
+			promises[i].set_value();
+		} catch (...) {
+
+			// Fail this and every later main phase, so that any worker
+			// waiting on one sees the exception rather than blocking, then
+			// wait for all the workers (which reference this frame and the
+			// phases) to finish before unwinding
+			const auto error{std::current_exception()};
+			for (auto j = i; j < _phases.size(); j++)
+				if (_phases[j].lane == BootstrapLane::MAIN)
+					promises[j].set_exception(error);
+			for (const auto &each : _phases)
+				if (each.lane != BootstrapLane::MAIN)
+					each.done.wait();
+
+			std::rethrow_exception(error);
+		}
+	}
+
+	// Join everything, then rethrow the first failure from a worker
+	for (const auto &phase : _phases)
+		phase.done.wait();
+	for (const auto &phase : _phases)
+		phase.done.get();
+
+	_finish = clock::now();
+
+	DEBUG_LOGF("Bootstrap completed {} phases in {} ms", _phases.size(),
+			   std::chrono::duration_cast<std::chrono::milliseconds>(_finish -
+																	 _start)
+				   .count());
+}
+
+// Per-phase timing report (offsets are from the start of run())
+auto Sorcery::Bootstrap::report() const -> std::string {
+
+	using ms = std::chrono::duration<double, std::milli>;
+
+	auto work{0.0};
+	std::string output{};
+	for (const auto &phase : _phases) {
+		const auto offset{ms(phase.started - _start).count()};
+		const auto waited{ms(phase.started - phase.queued).count()};
+		const auto took{ms(phase.finished - phase.started).count()};
+		work += took;
+		output.append(std::format(
+			"  {:<14} {:<6} {:>9.2f} {:>9.2f} {:>9.2f}\n", phase.name,
+			phase.lane == BootstrapLane::MAIN ? "main" : "worker", offset,
+			waited, took));
+	}
+
+	const auto wall{ms(_finish - _start).count()};
+	auto header{std::format("Startup Report: {} phases, {:.2f} ms elapsed, "
+							"{:.2f} ms of work ({:.2f}x)\n",
+							_phases.size(), wall, work,
+							wall > 0.0 ? work / wall : 0.0)};
+	header.append(std::format("  {:<14} {:<6} {:>9} {:>9} {:>9}\n", "phase",
+							  "lane", "start", "wait", "run"));
+
+	return header + output;
+}
+
+auto Sorcery::Bootstrap::_find(std::string_view name) const -> std::size_t {
+
+	for (auto i = 0u; i < _phases.size(); i++)
+		if (_phases[i].name == name)
+			return i;
+
+	throw std::invalid_argument{
+		std::format("Bootstrap phase '{}' has not been added yet", name)};
+}
+
+auto Sorcery::Bootstrap::_wait(const Phase &phase) const -> void {
+
+	// Note that get() on a shared_future rethrows any dependency failure
+	for (const auto depend : phase.depends)
+		_phases[depend].done.get();
+}
+
+auto Sorcery::Bootstrap::_execute(Phase &phase) -> void {
+
+	phase.started = clock::now();
+	phase.task();
+	phase.finished = clock::now();
+}
@@ -24,6 +24,7 @@
 #include "core/application.hpp"
 #include "core/controller.hpp"
 #include "core/random.hpp"
+#include "core/replay.hpp"
 #include "resources/componentstore.hpp"
 #include "resources/filestore.hpp"
 #include "resources/stringstore.hpp"
@@ -44,11 +45,25 @@ auto Sorcery::Context::get_random(const Enums::System::Random random_type)
 	return random->get(random_type);
 }
 
+// A copy, for text that is kept or changed
 auto Sorcery::Context::get_string(std::string_view key) -> std::string {
 
+	return std::string{strings->get(key)};
+}
+
+// The string itself (NUL-terminated), for text drawn this frame - it is only
+// valid until the strings are next reloaded
+auto Sorcery::Context::get_text(std::string_view key) const
+	-> std::string_view {
+
 	return strings->get(key);
 }
 
+auto Sorcery::Context::get_text(const StringID id) const -> std::string_view {
+
+	return strings->get(id);
+}
+
 auto Sorcery::Context::get_config(const unsigned int i) -> bool & {
 
 	return config->get(i);
@@ -66,29 +81,52 @@ auto Sorcery::Context::get_file(std::string_view key) const
 	return files->get(key);
 }
 
+auto Sorcery::Context::get_resource(std::string_view key) const -> Resource {
+
+	return files->get_resource(key);
+}
+
 auto Sorcery::Context::get_directory(std::string_view key) const
 	-> std::filesystem::path {
 
 	return files->get_directory(key);
 }
 
+auto Sorcery::Context::get_component(const ComponentHandle &handle)
+	-> Component & {
+
+	return components->get(handle);
+}
+
 auto Sorcery::Context::get_component(std::string_view combined_key)
 	-> Component & {
 
 	return components->get(combined_key);
 }
 
-auto Sorcery::Context::get_flag_ref(const std::string &flag) -> bool & {
+auto Sorcery::Context::get_flag_ref(const ControlKey &flag) -> bool & {
 
 	return controller->get_flag_ref(flag);
 }
 
-auto Sorcery::Context::get_flag(const std::string &flag) -> bool {
+auto Sorcery::Context::get_flag(const ControlKey &flag) -> bool {
 
 	return controller->get_flag(flag);
 }
 
-auto Sorcery::Context::get_selected(const std::string &flag) const -> int {
+auto Sorcery::Context::get_selected(const ControlKey &flag) const -> int {
 
 	return controller->get_selected(flag);
+}
+
+// Every module polls SDL through here so that input can be recorded/replayed
+auto Sorcery::Context::poll_event(SDL_Event &event) -> bool {
+
+	return replay->poll(event);
+}
+
+// Likewise anything timed in the game logic should use this clock
+auto Sorcery::Context::now() const -> std::chrono::steady_clock::time_point {
+
+	return replay->now();
 }
\ No newline at end of file
@@ -37,6 +37,7 @@
 #include "gui/dialog.hpp"
 #include "gui/menuaction.hpp"
 #include "gui/modal.hpp"
+#include "gui/overlay.hpp"
 #include "resources/itemstore.hpp"
 #include "resources/savestore.hpp"
 #include "types/character.hpp"
@@ -49,6 +50,7 @@
 Sorcery::Controller::Controller(Context &ctx)
 	: _ctx{ctx} {
 
+	_clear_controls();
 	initialise();
 	_game = nullptr;
 }
@@ -64,14 +66,12 @@ auto Sorcery::Controller::initialise() -> void {
 	go_back = false;
 
 	// Store these flags (if set)
-	// auto show_automap{_flags["show_automap"]};
-	auto show_party_panel{_flags["interface_party_panel"]};
-	auto show_ui{_flags["interface_ui"]};
+	// auto show_automap{get_flag(CONTROL("show_automap"))};
+	auto show_party_panel{get_flag(CONTROL("interface_party_panel"))};
+	auto show_ui{get_flag(CONTROL("interface_ui"))};
 
 	// TODO: are these needed?
-	_flags.clear();
-	_texts.clear();
-	_selected.clear();
+	_clear_controls();
 	_characters.clear();
 
 	// Set default state (these must all be present and set to false/-1)
@@ -130,22 +130,23 @@ auto Sorcery::Controller::initialise() -> void {
 
 			 "in_engine",
 		 })
-		unset_flag(flag);
+		if (const auto key{ControlKey::find(flag)}; key)
+			unset_flag(*key);
 
-	unset_text("heal_results");
+	unset_text(CONTROL("heal_results"));
 
-	unset_text("heal_results");
+	unset_text(CONTROL("heal_results"));
 
-	set_selected("bestiary_selected", 0);
-	set_selected("spellbook_selected", 0);
-	set_selected("museum_selected", 1);
-	set_selected("class_selected", 8);
-	set_selected("atlas_selected", 8);
+	set_selected(CONTROL("bestiary_selected"), 0);
+	set_selected(CONTROL("spellbook_selected"), 0);
+	set_selected(CONTROL("museum_selected"), 1);
+	set_selected(CONTROL("class_selected"), 8);
+	set_selected(CONTROL("atlas_selected"), 8);
 
 	// set ui flags again
-	//_flags["show_automap"] = show_automap;
-	_flags["interface_party_panel"] = show_party_panel;
-	_flags["interface_ui"] = show_ui;
+	// set_flag_value(CONTROL("show_automap"), show_automap);
+	set_flag_value(CONTROL("interface_party_panel"), show_party_panel);
+	set_flag_value(CONTROL("interface_ui"), show_ui);
 }
 
 auto Sorcery::Controller::add_to_candidate_party(unsigned int value) -> void {
@@ -192,8 +193,8 @@ auto Sorcery::Controller::set_last_dir(const Enums::Map::Direction value)
 auto Sorcery::Controller::get_flags() const -> std::string {
 
 	std::string output{};
-	for (const auto &flag : _flags)
-		output.append(std::format("{:>26}: {}\n", flag.first, flag.second));
+	for (const auto &[flag, value] : _flags_by_name())
+		output.append(std::format("{:>26}: {}\n", flag, value));
 
 	return output;
 }
@@ -240,10 +241,10 @@ auto Sorcery::Controller::has_saved_game() const -> bool {
 	return _has_save;
 }
 
-auto Sorcery::Controller::set_flag_value(const std::string &flag,
+auto Sorcery::Controller::set_flag_value(const ControlKey &flag,
 										 const bool value) -> void {
 
-	_flags[flag] = value;
+	_flags[flag.id()] = value;
 }
 
 auto Sorcery::Controller::set_game(Game *game) -> void {
@@ -258,7 +259,7 @@ auto Sorcery::Controller::check_for_debug(const SDL_Event event) -> void {
 		if (_game != nullptr)
 			_game->call_debug(event.key.keysym.sym);
 	} else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F12) {
-		for (auto const &[key, val] : _flags)
+		for (auto const &[key, val] : _flags_by_name())
 			DEBUG_LOGF("{}", std::format("{:>32}: {}", key, val));
 	}
 }
@@ -273,6 +274,11 @@ auto Sorcery::Controller::check_for_quickload(const SDL_Event event) -> bool {
 	return (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F10);
 }
 
+auto Sorcery::Controller::check_for_undo(const SDL_Event event) -> bool {
+
+	return (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_u);
+}
+
 auto Sorcery::Controller::check_for_automap(const SDL_Event event) -> bool {
 
 	return (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_m);
@@ -281,13 +287,13 @@ auto Sorcery::Controller::check_for_automap(const SDL_Event event) -> bool {
 auto Sorcery::Controller::check_for_ui_toggle(const SDL_Event event) -> void {
 
 	if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_s)
-		toggle_flag("interface_party_panel");
+		toggle_flag(CONTROL("interface_party_panel"));
 	else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_o)
-		toggle_flag("interface_ui");
+		toggle_flag(CONTROL("interface_ui"));
 	else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_n)
 		_monochrome = !_monochrome;
 	else if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_p)
-		toggle_flag("debug_ui");
+		toggle_flag(CONTROL("debug_ui"));
 }
 
 auto Sorcery::Controller::check_for_movement(const SDL_Event event) -> int {
@@ -825,7 +831,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 	std::string_view component,
 	[[maybe_unused]] const std::vector<std::string> &items,
 	[[maybe_unused]] const int data, const int selection,
-	std::vector<std::reference_wrapper<bool>> in_flags) -> bool {
+	std::vector<std::reference_wrapper<Overlay>> in_flags) -> bool {
 
 	DEBUG_LOGF("Dynamic Menu: {} {} {}", component, data, selection);
 
@@ -854,7 +860,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 			_game->save_game();
 
-			unset_flag("want_reclassed_ok");
+			unset_flag(CONTROL("want_reclassed_ok"));
 			_ctx.ui->notice_reclassed_ok->show = true;
 		}
 
@@ -920,7 +926,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 			go_back = true;
 		} else {
 			set_character(Enums::CharacterSlot::TITHE, data);
-			_flags["want_donate"] = true;
+			set_flag_value(CONTROL("want_donate"), true);
 			in_flags.at(1).get() = true;
 		}
 
@@ -970,7 +976,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 		// Flags = &_ui->modal_identify->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_identify"] = true;
+			set_flag_value(CONTROL("want_identify"), true);
 			in_flags.at(0).get() = false;
 		} else {
 			// TODO
@@ -980,7 +986,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 		// Flags = &_ui->modal_equip->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_equip"] = true;
+			set_flag_value(CONTROL("want_equip"), true);
 			in_flags.at(0).get() = false;
 		} else {
 			// TODO
@@ -990,7 +996,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 		// Flags = &_ui->modal_remove->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_remove"] = true;
+			set_flag_value(CONTROL("want_remove"), true);
 			in_flags.at(0).get() = false;
 		} else {
 			// TODO
@@ -1000,7 +1006,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 		// Flags = &_ui->modalspell->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_spell"] = true;
+			set_flag_value(CONTROL("want_spell"), true);
 			in_flags.at(0).get() = false;
 		} else {
 			// TODO
@@ -1010,7 +1016,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 		// Flags = &_ui->modal_drop->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_drop"] = true;
+			set_flag_value(CONTROL("want_drop"), true);
 			in_flags.at(0).get() = false;
 		} else {
 		}
@@ -1019,14 +1025,14 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 		// Flags = &_ui->modal_trade->show, &_ui->modal_give->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_trade"] = true;
-			_flags["want_give"] = true;
+			set_flag_value(CONTROL("want_trade"), true);
+			set_flag_value(CONTROL("want_give"), true);
 			in_flags.at(0).get() = false;
 		} else {
 			in_flags.at(0).get() = false;
 			in_flags.at(1).get() = true;
-			_flags["want_give"] = true;
-			_flags["want_trade"] = false;
+			set_flag_value(CONTROL("want_give"), true);
+			set_flag_value(CONTROL("want_trade"), false);
 
 			// Handle Trade
 		}
@@ -1035,7 +1041,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 		// Flags = &_ui->modal_use->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_use"] = true;
+			set_flag_value(CONTROL("want_use"), true);
 			in_flags.at(0).get() = false;
 		} else {
 		}
@@ -1044,7 +1050,7 @@ auto Sorcery::Controller::handle_dynamic_menu(
 
 		// Flags = &_ui->modal_invoke->show
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["want_invoke"] = true;
+			set_flag_value(CONTROL("want_invoke"), true);
 			in_flags.at(0).get() = false;
 		} else {
 		}
@@ -1064,23 +1070,23 @@ auto Sorcery::Controller::handle_icon_click(const int icon_idx) -> void {
 		break;
 
 	case ICON_PARTY:
-		set_flag("want_inspect");
+		set_flag(CONTROL("want_inspect"));
 		break;
 
 	case ICON_MAP:
-		set_flag("want_automap");
+		set_flag(CONTROL("want_automap"));
 		break;
 
 	case ICON_LOOK:
-		set_flag("want_look");
+		set_flag(CONTROL("want_look"));
 		break;
 
 	case ICON_CAST:
-		set_flag("want_spell");
+		set_flag(CONTROL("want_spell"));
 		break;
 
 	case ICON_USE:
-		set_flag("want_use");
+		set_flag(CONTROL("want_use"));
 		break;
 
 	default:
@@ -1094,98 +1100,141 @@ auto Sorcery::Controller::inspect_party_member(const int character_id) -> void {
 	go_to(Enums::Screen::INSPECT);
 }
 
-auto Sorcery::Controller::get_flag_ref(const std::string &flag) -> bool & {
+// Flags are kept as a flat array of bools rather than a std::bitset since
+// widgets hold on to references to them
+auto Sorcery::Controller::get_flag_ref(const ControlKey &flag) -> bool & {
+
+	return _flags[flag.id()];
+}
 
-	if (!_flags.contains(flag))
-		_flags[flag] = false;
+auto Sorcery::Controller::get_flag(const ControlKey &flag) const -> bool {
 
-	return _flags.at(flag);
+	return _flags[flag.id()];
 }
 
-auto Sorcery::Controller::get_flag(const std::string &flag) const -> bool {
+auto Sorcery::Controller::set_flag(const ControlKey &flag) -> void {
 
-	if (_flags.contains(flag))
-		return _flags.at(flag);
-	else
-		return false;
+	_flags[flag.id()] = true;
 }
 
-auto Sorcery::Controller::set_flag(const std::string &flag) -> void {
+auto Sorcery::Controller::toggle_flag(const ControlKey &flag) -> void {
 
-	_flags[flag] = true;
+	_flags[flag.id()] = !_flags[flag.id()];
 }
 
-auto Sorcery::Controller::toggle_flag(const std::string &flag) -> void {
+auto Sorcery::Controller::unset_flag(const ControlKey &flag) -> void {
 
-	if (_flags.contains(flag))
-		_flags.at(flag) = !_flags.at(flag);
-	else
-		_flags[flag] = true;
+	_flags[flag.id()] = false;
 }
 
-auto Sorcery::Controller::unset_flag(const std::string &flag) -> void {
+auto Sorcery::Controller::has_flag(const ControlKey &flag) const -> bool {
 
-	_flags[flag] = false;
+	return _flags[flag.id()];
 }
 
-auto Sorcery::Controller::has_flag(const std::string &flag) const -> bool {
+auto Sorcery::Controller::has_selected(const ControlKey &flag) const -> bool {
 
-	if (_flags.contains(flag))
-		return _flags.at(flag) == true;
+	return _selected[flag.id()] != -1;
+}
 
-	return false;
+auto Sorcery::Controller::set_selected(const ControlKey &flag, const int value)
+	-> void {
+
+	_selected[flag.id()] = value;
 }
 
-auto Sorcery::Controller::has_selected(const std::string &flag) const -> bool {
+auto Sorcery::Controller::get_selected(const ControlKey &flag) const -> int {
 
-	if (_selected.contains(flag))
-		return _selected.at(flag) != -1;
+	return _selected[flag.id()];
+}
 
-	return false;
+auto Sorcery::Controller::unset_selected(const ControlKey &flag) -> void {
+
+	_selected[flag.id()] = -1;
 }
 
-auto Sorcery::Controller::set_selected(const std::string &flag, const int value)
-	-> void {
+auto Sorcery::Controller::has_text(const ControlKey &flag) const -> bool {
 
-	_selected[flag] = value;
+	return _texts[flag.id()].length() > 0;
 }
 
-auto Sorcery::Controller::get_selected(const std::string &flag) const -> int {
+auto Sorcery::Controller::set_text(const ControlKey &flag,
+								   const std::string &text) -> void {
 
-	if (_selected.contains(flag))
-		return _selected.at(flag);
-	else
-		return -1;
+	_texts[flag.id()] = text;
 }
 
-auto Sorcery::Controller::unset_selected(const std::string &flag) -> void {
+auto Sorcery::Controller::unset_text(const ControlKey &flag) -> void {
 
-	_selected[flag] = -1;
+	_texts[flag.id()].clear();
 }
 
-auto Sorcery::Controller::has_text(const std::string &flag) const -> bool {
+auto Sorcery::Controller::get_text(const ControlKey &flag) const
+	-> const std::string & {
+
+	return _texts[flag.id()];
+}
 
-	if (_texts.contains(flag))
-		return _texts.at(flag).length() > 0;
+// Everything not yet set reads as false, -1 or an empty string, which is what
+// the old map-based lookups returned for missing names
+auto Sorcery::Controller::_clear_controls() -> void {
 
-	return false;
+	_flags.fill(false);
+	_selected.fill(-1);
+	for (auto &text : _texts)
+		text.clear();
 }
-auto Sorcery::Controller::set_text(const std::string &flag,
-								   const std::string &text) -> void {
 
-	_texts[flag] = text;
+auto Sorcery::Controller::_flags_by_name() const
+	-> std::map<std::string, bool> {
+
+	std::map<std::string, bool> flags{};
+	for (auto id = 0u; id < ControlKey::count(); id++)
+		if (_flags[id])
+			flags.emplace(ControlKey::key_of(id), true);
+
+	return flags;
 }
-auto Sorcery::Controller::unset_text(const std::string &flag) -> void {
 
-	_texts[flag] = "";
+auto Sorcery::Controller::_texts_by_name() const
+	-> std::map<std::string, std::string> {
+
+	std::map<std::string, std::string> texts{};
+	for (auto id = 0u; id < ControlKey::count(); id++)
+		if (!_texts[id].empty())
+			texts.emplace(ControlKey::key_of(id), _texts[id]);
+
+	return texts;
+}
+
+auto Sorcery::Controller::_selected_by_name() const
+	-> std::map<std::string, int> {
+
+	std::map<std::string, int> selected{};
+	for (auto id = 0u; id < ControlKey::count(); id++)
+		if (_selected[id] != -1)
+			selected.emplace(ControlKey::key_of(id), _selected[id]);
+
+	return selected;
 }
 
-auto Sorcery::Controller::get_text(const std::string &flag) const
-	-> const std::string {
-	if (_texts.contains(flag))
-		return _texts.at(flag);
+auto Sorcery::Controller::_restore_by_name(
+	const std::map<std::string, int> &selected,
+	const std::map<std::string, bool> &flags,
+	const std::map<std::string, std::string> &texts) -> void {
 
-	return "";
+	// Names that this version of the game never uses are skipped rather than
+	// interned, so that an old or edited save can't use up the ids
+	_clear_controls();
+	for (const auto &[name, value] : selected)
+		if (const auto key{ControlKey::find(name)}; key)
+			_selected[key->id()] = value;
+	for (const auto &[name, value] : flags)
+		if (const auto key{ControlKey::find(name)}; key)
+			_flags[key->id()] = value;
+	for (const auto &[name, value] : texts)
+		if (const auto key{ControlKey::find(name)}; key)
+			_texts[key->id()] = value;
 }
 
 auto Sorcery::Controller::get_character(const Enums::CharacterSlot flag) const
@@ -1249,7 +1298,7 @@ auto Sorcery::Controller::check_for_resize(const SDL_Event event, UI *ui)
 
 // Check if the SDL event is go-back-to-previous event (override to
 // set a flag, for example to display a dialog box!)
-auto Sorcery::Controller::check_for_back(const SDL_Event event, bool &flag)
+auto Sorcery::Controller::check_for_back(const SDL_Event event, Overlay &flag)
 	-> void {
 
 	if (event.type == SDL_KEYDOWN &&
@@ -1281,7 +1330,8 @@ auto Sorcery::Controller::clear_modal_flags() -> void {
 			 "want_take_stairs_down",
 			 "after_tile_message",
 		 })
-		unset_flag(flag);
+		if (const auto key{ControlKey::find(flag)}; key)
+			unset_flag(*key);
 }
 
 auto Sorcery::Controller::check_for_quick_inspect(const SDL_Event event)
@@ -1341,7 +1391,7 @@ auto Sorcery::Controller::abort(const bool value) -> void {
 
 auto Sorcery::Controller::want_to_abort() const -> bool {
 
-	return _abort || has_flag("want_abort_game");
+	return _abort || has_flag(CONTROL("want_abort_game"));
 }
 
 auto Sorcery::Controller::leave_game(const bool value) -> void {
@@ -1473,7 +1523,7 @@ auto Sorcery::Controller::handle_input_button_click(
 
 			_game->save_game();
 
-			unset_flag("want_renamed_ok");
+			unset_flag(CONTROL("want_renamed_ok"));
 			ui->notice_renamed_ok->show = true;
 
 		} else {
@@ -1496,64 +1546,64 @@ auto Sorcery::Controller::handle_button_click(const std::string &component,
 		// Show Identify Modal
 		ui->modal_identify->regenerate();
 		ui->modal_identify->show = true;
-		set_flag("want_identify");
+		set_flag(CONTROL("want_identify"));
 	} else if (component == "button_pool") {
 		// Show Pool Gold Notice
 		ui->notice_pool_gold->show = true;
-		set_flag("want_pool_gold");
+		set_flag(CONTROL("want_pool_gold"));
 		_game->pool_party_gold(get_character(Enums::CharacterSlot::INSPECT));
 	} else if (component == "button_leave") {
 		// Leave Inspect
-		unset_flag("want_inspect");
+		unset_flag(CONTROL("want_inspect"));
 		go_back = true;
 		ui->modal_inspect->show = false;
 	} else if (component == "button_drop") {
 		// Show Drop Modal
 		ui->modal_drop->regenerate();
 		ui->modal_drop->show = true;
-		set_flag("want_drop");
+		set_flag(CONTROL("want_drop"));
 	} else if (component == "button_trade") {
 		// Show Trade Modal
 		ui->modal_trade->regenerate();
 		ui->modal_trade->show = true;
 		ui->modal_give->regenerate();
 		ui->modal_give->show = false;
-		set_flag("want_trade");
-		unset_flag("want_give");
+		set_flag(CONTROL("want_trade"));
+		unset_flag(CONTROL("want_give"));
 	} else if (component == "button_use") {
 		// Show Use Modal
 		ui->modal_use->regenerate();
 		ui->modal_use->show = true;
-		set_flag("want_use");
+		set_flag(CONTROL("want_use"));
 	} else if (component == "button_equip") {
 		// Show Equip Modal
 		ui->modal_equip->regenerate();
 		ui->modal_equip->show = true;
-		set_flag("want_equip");
+		set_flag(CONTROL("want_equip"));
 	} else if (component == "button_remove") {
 		// Show Remove Modal
 		ui->modal_remove->regenerate();
 		ui->modal_remove->show = true;
-		set_flag("want_remove");
+		set_flag(CONTROL("want_remove"));
 	} else if (component == "button_spell") {
 		// Show Spell Modal
 		ui->modal_spell->regenerate();
 		ui->modal_spell->show = true;
-		set_flag("want_spell");
+		set_flag(CONTROL("want_spell"));
 	} else if (component == "button_invoke") {
 		// Show Invoke Modal
 		ui->modal_invoke->regenerate();
 		ui->modal_invoke->show = true;
-		set_flag("want_invoke");
+		set_flag(CONTROL("want_invoke"));
 	} else if (component == "button_keep_yes") {
 
 		// Save Character
-		_ctx.controller->set_flag("confirm_keep_character");
+		_ctx.controller->set_flag(CONTROL("confirm_keep_character"));
 
 	} else if (component == "button_keep_no") {
 
 		// Don't save Character
-		_ctx.controller->set_flag("confirm_discard_character");
+		_ctx.controller->set_flag(CONTROL("confirm_discard_character"));
 
 	} else if (component == "button_buy_leave") {
 
@@ -1631,7 +1681,7 @@ auto Sorcery::Controller::handle_standard_menu(
 			// Get the ID of the Character if we can, add the character to
 			// the party
 			set_character(Enums::CharacterSlot::RESTART, data);
-			_flags["want_restart_expedition"] = true;
+			set_flag_value(CONTROL("want_restart_expedition"), true);
 		}
 
 	} else if (component == "add_menu") {
@@ -1722,8 +1772,8 @@ auto Sorcery::Controller::handle_standard_menu(
 					break;
 				}
 
-				set_flag("want_choose_confirm");
-				unset_flag("want_choose_class");
+				set_flag(CONTROL("want_choose_confirm"));
+				unset_flag(CONTROL("want_choose_class"));
 			}
 		};
 	} else if (component == "reorder_menu") {
@@ -1731,15 +1781,15 @@ auto Sorcery::Controller::handle_standard_menu(
 		// Reorder has multiple entry points so need to rely upon calling
 		// screen to enable itself
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["show_reorder"] = false;
+			set_flag_value(CONTROL("show_reorder"), false);
 			go_back = true;
 		}
 	} else if (component == "pay_menu") {
 
 		if (selection == (static_cast<int>(items.size()) - 1))
-			_flags["show_pay"] = false;
+			set_flag_value(CONTROL("show_pay"), false);
 		else
-			_selected["pay_selected"] = selection;
+			set_selected(CONTROL("pay_selected"), selection);
 	} else if (component == "shop_menu") {
 
 		// Shop
@@ -1755,39 +1805,39 @@ auto Sorcery::Controller::handle_standard_menu(
 	} else if (component == "bestiary_menu") {
 
 		// Bestiary
-		_selected["bestiary_selected"] = selection;
+		set_selected(CONTROL("bestiary_selected"), selection);
 		if (selection == (static_cast<int>(items.size()) - 1))
 			go_to(Enums::Screen::COMPENDIUM);
 	} else if (component == "museum_menu") {
 
 		// Museum
-		_selected["museum_selected"] = selection;
+		set_selected(CONTROL("museum_selected"), selection);
 		if (selection == (static_cast<int>(items.size()) - 1))
 			go_to(Enums::Screen::COMPENDIUM);
 	} else if (component == "atlas_menu") {
 
 		// Atlas
-		_selected["atlas_selected"] = selection;
+		set_selected(CONTROL("atlas_selected"), selection);
 		if (selection == (static_cast<int>(items.size()) - 1))
 			go_to(Enums::Screen::COMPENDIUM);
 	} else if (component == "spellbook_menu") {
 
 		// Spellbook
-		_selected["spellbook_selected"] = selection;
+		set_selected(CONTROL("spellbook_selected"), selection);
 		if (selection == (static_cast<int>(items.size()) - 1))
 			go_to(Enums::Screen::COMPENDIUM);
 	} else if (component == "choose_menu") {
 
 		// Character Selection
 		if (selection == (static_cast<int>(items.size()) - 1)) {
-			_flags["show_choose"] = false;
+			set_flag_value(CONTROL("show_choose"), false);
 			clear_character(Enums::CharacterSlot::CHOOSE);
 		} else
 			set_character(Enums::CharacterSlot::CHOOSE, data);
 	} else if (component == "shop_menu") {
 
 		// Boltacs
-		_selected["store_selected"] = selection;
+		set_selected(CONTROL("store_selected"), selection);
 		if (selection == (static_cast<int>(items.size()) - 1))
 			go_to(Enums::Screen::SHOP);
 		else
@@ -1795,7 +1845,7 @@ auto Sorcery::Controller::handle_standard_menu(
 	} else if (component == "store_menu") {
 
 		// Store
-		_selected["store_selected"] = selection;
+		set_selected(CONTROL("store_selected"), selection);
 		if (selection == (static_cast<int>(items.size()) - 1))
 			go_to(Enums::Screen::SHOP);
 	}
@@ -1826,7 +1876,7 @@ auto Sorcery::Controller::is_at() const -> Enums::Screen {
 
 auto Sorcery::Controller::handle_action_table_menu(
 	std::string_view menu, int selection, int data,
-	std::vector<std::reference_wrapper<bool>> &ui_flags) -> bool {
+	std::vector<std::reference_wrapper<Overlay>> &ui_flags) -> bool {
 
 	DEBUG_LOGF("Action Table Menu: {} {} {}", menu, selection, data);
 
@@ -1846,14 +1896,16 @@ auto Sorcery::Controller::handle_action_table_menu(
 
 auto Sorcery::Controller::execute_action(
 	const MenuAction &action, int data,
-	std::vector<std::reference_wrapper<bool>> &ui_flags) -> void {
+	std::vector<std::reference_wrapper<Overlay>> &ui_flags) -> void {
 	switch (action.type) {
 	case MenuAction::Type::SETFLAG:
-		_flags[action.flag] = true;
+		if (const auto key{ControlKey::find(action.flag)}; key)
+			set_flag(*key);
 		break;
 
 	case MenuAction::Type::CLEARFLAG:
-		_flags[action.flag] = false;
+		if (const auto key{ControlKey::find(action.flag)}; key)
+			unset_flag(*key);
 		break;
 
 #pragma GCC diagnostic push
@@ -1889,7 +1941,8 @@ auto Sorcery::Controller::execute_action(
 			_game->pool_party_gold(get_character(Enums::CharacterSlot::STORE));
 		break;
 	case MenuAction::Type::SET_SELECTED:
-		set_selected(action.selected_key, action.selected_value);
+		if (const auto key{ControlKey::find(action.selected_key)}; key)
+			set_selected(*key, action.selected_value);
 		break;
 	case MenuAction::Type::GOTOSCREEN:
 		go_to(action.screen);
@@ -1984,10 +2037,10 @@ namespace Sorcery {
 auto operator<<(std::ostream &out_stream, const Sorcery::Controller &controller)
 	-> std::ostream & {
 
-	for (const auto &f : controller._flags)
+	for (const auto &f : controller._flags_by_name())
 		out_stream << "  Flag: " << f.first << " = " << f.second << std::endl;
 
-	for (const auto &s : controller._selected)
+	for (const auto &s : controller._selected_by_name())
 		out_stream << "  Selected: " << s.first << " = " << s.second
 				   << std::endl;
 
@@ -28,6 +28,7 @@
 #include "core/context.hpp"
 #include "core/debug.hpp"
 #include "core/framebuffer.hpp"
+#include "core/replay.hpp"
 #include "core/system.hpp"
 #include "resources/stringstore.hpp"
 #include "types/config.hpp"
@@ -122,6 +123,11 @@ auto Sorcery::Display::_initialise_SDL() -> int {
 	_SDL_window_flags = static_cast<SDL_WindowFlags>(
 		SDL_WINDOW_OPENGL | SDL_WINDOW_ALLOW_HIGHDPI | SDL_WINDOW_RESIZABLE);
 
+	// A replay still needs a window (and GL context) for ImGui, but not to see
+	if (_ctx.replay->hidden())
+		_SDL_window_flags =
+			static_cast<SDL_WindowFlags>(_SDL_window_flags | SDL_WINDOW_HIDDEN);
+
 	_SDL_window = SDL_CreateWindow(window_title.c_str(), SDL_WINDOWPOS_CENTERED,
 								   SDL_WINDOWPOS_CENTERED, _base_window_w,
 								   _base_window_h, _SDL_window_flags);
@@ -169,7 +175,9 @@ auto Sorcery::Display::_initialise_SDL() -> int {
 		return -1;
 	}
 
-	if (SDL_GL_SetSwapInterval(1) != 0) {
+	if (_ctx.replay->hidden())
+		SDL_GL_SetSwapInterval(0);
+	else if (SDL_GL_SetSwapInterval(1) != 0) {
 		std::println("Warning: unable to enable VSync: {}", SDL_GetError());
 	}
 
@@ -279,7 +287,8 @@ auto Sorcery::Display::present(ImDrawData *draw_data) -> void {
 	const auto width{_metrics.drawable_w};
 	const auto height{_metrics.drawable_h};
 
-	if (width <= 0 || height <= 0)
+	// Replays are neither drawn nor paced by VSync
+	if (width <= 0 || height <= 0 || _ctx.replay->hidden())
 		return;
 
 	if (_framebuffer.width() != width || _framebuffer.height() != height) {
@@ -0,0 +1,238 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/filewatcher.hpp"
+#include "core/debug.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <system_error>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// How often to check for (inotify) or look for (polling) changes
+static constexpr auto WATCH_INTERVAL{std::chrono::milliseconds{250}};
+
+Sorcery::FileWatcher::FileWatcher()
+	: _inotify{-1},
+	  _pending{false} {
+
+#ifdef __linux__
+	_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (_inotify < 0)
+		DEBUG_LOG("inotify unavailable, falling back to polling for changes");
+#endif
+}
+
+Sorcery::FileWatcher::~FileWatcher() {
+
+	stop();
+
+#ifdef __linux__
+	if (_inotify >= 0)
+		::close(_inotify);
+#endif
+}
+
+// Note that the parent directory is what is actually watched, as most editors
+// save by writing a new file and renaming it over the old one
+auto Sorcery::FileWatcher::watch(const std::filesystem::path &file,
+								 std::function<void()> reparse,
+								 std::function<void()> commit) -> void {
+
+	std::error_code error;
+	const auto modified{std::filesystem::last_write_time(file, error)};
+
+	auto descriptor{-1};
+#ifdef __linux__
+	if (_inotify >= 0) {
+		descriptor =
+			inotify_add_watch(_inotify, file.parent_path().c_str(),
+							  IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+		if (descriptor < 0)
+			DEBUG_LOGF("Unable to watch {}, polling it for changes instead",
+					   file.string());
+	}
+#endif
+
+	{
+		std::scoped_lock<std::mutex> scoped_lock(_mutex);
+		_watches.emplace_back(Watch{.file = file,
+									.modified = modified,
+									.descriptor = descriptor,
+									.reparse = std::move(reparse),
+									.commit = std::move(commit),
+									.pending = false});
+	}
+
+	DEBUG_LOGF("Watching for changes: {}", file.string());
+
+	if (!_thread.joinable())
+		_thread = std::jthread([this](std::stop_token stop) { _run(stop); });
+}
+
+// Stop watching altogether, after which no more callbacks will be made
+auto Sorcery::FileWatcher::stop() -> void {
+
+	if (_thread.joinable()) {
+		_thread.request_stop();
+		_thread.join();
+	}
+
+	std::scoped_lock<std::mutex> scoped_lock(_mutex);
+	_watches.clear();
+	_pending = false;
+}
+
+// Called on the main thread at a frame boundary
+auto Sorcery::FileWatcher::update() -> void {
+
+	if (!_pending.exchange(false))
+		return;
+
+	std::vector<std::function<void()>> commits;
+	{
+		std::scoped_lock<std::mutex> scoped_lock(_mutex);
+		for (auto &watch : _watches) {
+			if (watch.pending) {
+				commits.emplace_back(watch.commit);
+				watch.pending = false;
+			}
+		}
+	}
+
+	for (const auto &commit : commits)
+		commit();
+}
+
+auto Sorcery::FileWatcher::_run(std::stop_token stop) -> void {
+
+	while (!stop.stop_requested()) {
+
+		std::vector<std::filesystem::path> changes;
+		if (_inotify >= 0)
+			changes = _wait_for_changes(stop);
+		else
+			std::this_thread::sleep_for(WATCH_INTERVAL);
+
+		// Anything that inotify isn't watching (everything, without it) is
+		// polled instead
+		for (auto &file : _poll_for_changes())
+			if (!std::ranges::contains(changes, file))
+				changes.emplace_back(std::move(file));
+		if (changes.empty())
+			continue;
+
+		// Reparse outside of the lock as that is where all the time goes
+		std::vector<std::size_t> changed;
+		std::vector<std::function<void()>> reparses;
+		{
+			std::scoped_lock<std::mutex> scoped_lock(_mutex);
+			for (auto i = 0u; i < _watches.size(); i++) {
+				if (std::ranges::contains(changes, _watches[i].file)) {
+					changed.emplace_back(i);
+					reparses.emplace_back(_watches[i].reparse);
+				}
+			}
+		}
+
+		for (const auto &reparse : reparses)
+			reparse();
+
+		if (!changed.empty()) {
+			std::scoped_lock<std::mutex> scoped_lock(_mutex);
+			for (const auto i : changed)
+				_watches[i].pending = true;
+			_pending = true;
+		}
+	}
+}
+
+auto Sorcery::FileWatcher::_wait_for_changes(std::stop_token stop)
+	-> std::vector<std::filesystem::path> {
+
+	std::vector<std::filesystem::path> changes;
+
+#ifdef __linux__
+	pollfd fd{.fd = _inotify, .events = POLLIN, .revents = 0};
+	if (::poll(&fd, 1, static_cast<int>(WATCH_INTERVAL.count())) <= 0)
+		return changes;
+
+	// Let the writer finish (a save is often several events in quick
+	// succession) and then drain everything that has queued up
+	std::this_thread::sleep_for(WATCH_INTERVAL / 5);
+
+	std::scoped_lock<std::mutex> scoped_lock(_mutex);
+	alignas(inotify_event) std::array<char, 4096> buffer{};
+	while (!stop.stop_requested()) {
+		const auto length{::read(_inotify, buffer.data(), buffer.size())};
+		if (length <= 0)
+			break;
+
+		for (auto offset = 0l; offset < length;) {
+			const auto *event{reinterpret_cast<const inotify_event *>(
+				buffer.data() + offset)};
+			offset += static_cast<long>(sizeof(inotify_event) + event->len);
+			if (event->len == 0)
+				continue;
+
+			// Watch descriptors are per directory, so match on the name too
+			for (const auto &watch : _watches)
+				if (watch.descriptor == event->wd &&
+					watch.file.filename() == event->name &&
+					!std::ranges::contains(changes, watch.file))
+					changes.emplace_back(watch.file);
+		}
+	}
+#else
+	(void)stop;
+#endif
+
+	return changes;
+}
+
+// Only the files without a watch descriptor of their own are looked at
+auto Sorcery::FileWatcher::_poll_for_changes()
+	-> std::vector<std::filesystem::path> {
+
+	std::vector<std::filesystem::path> changes;
+	std::scoped_lock<std::mutex> scoped_lock(_mutex);
+	for (auto &watch : _watches) {
+		if (watch.descriptor >= 0)
+			continue;
+
+		std::error_code error;
+		const auto modified{
+			std::filesystem::last_write_time(watch.file, error)};
+		if (!error && modified != watch.modified) {
+			watch.modified = modified;
+			changes.emplace_back(watch.file);
+		}
+	}
+
+	return changes;
+}
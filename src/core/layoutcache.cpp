@@ -0,0 +1,112 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "core/layoutcache.hpp"
+#include "types/component.hpp"
+
+Sorcery::LayoutCache::LayoutCache() {
+
+	_placements.clear();
+	_metrics = LayoutMetrics{};
+	_generation = 0;
+	_valid = false;
+}
+
+// Work out every component's geometry for the current resolution in one go
+auto Sorcery::LayoutCache::resolve(std::span<const Component> components,
+								   const LayoutMetrics &metrics,
+								   std::uint64_t generation) -> void {
+
+	_metrics = metrics;
+	_placements.clear();
+	_placements.reserve(components.size());
+	for (const auto &component : components)
+		_placements.emplace_back(place(&component));
+
+	_generation = generation;
+	_valid = true;
+}
+
+auto Sorcery::LayoutCache::is_current(std::uint64_t generation) const
+	-> bool {
+
+	return _valid && _generation == generation;
+}
+
+// Called on a resize, as every placement depends upon the resolution
+auto Sorcery::LayoutCache::invalidate() -> void {
+
+	_valid = false;
+}
+
+// Called when the strings change, as any measured text may now be different
+auto Sorcery::LayoutCache::forget_content() -> void {
+
+	for (auto &placement : _placements)
+		placement.measured = false;
+}
+
+// Components that are copies of those in the layout keep their slot, so the
+// id is checked as well to make sure this is still the same component
+auto Sorcery::LayoutCache::find(const Component *component) -> Placement * {
+
+	if (!_valid || component->slot >= _placements.size())
+		return nullptr;
+
+	auto &placement{_placements[component->slot]};
+	return placement.id == component->id() ? &placement : nullptr;
+}
+
+auto Sorcery::LayoutCache::place(const Component *component) const
+	-> Placement {
+
+	const auto &cell{_metrics.cell};
+	const auto x{static_cast<float>(component->x)};
+	const auto y{static_cast<float>(component->y)};
+	return Placement{
+		.id = component->id(),
+		.pos = ImVec2{_metrics.origin.x + (x * cell.x),
+					  _metrics.origin.y + (y * cell.y)},
+		.size = ImVec2{static_cast<float>(component->w) * cell.x,
+					   static_cast<float>(component->h) * cell.y},
+		.adjust = ImVec2{component->get_float(PROPERTY("adjust_x")),
+						 component->get_float(PROPERTY("adjust_y"))},
+		.content = ImVec2{0.0f, 0.0f},
+		.font_sz = _metrics.font_sz,
+		.wrap = component->get_float(PROPERTY("width")) * _metrics.font_sz,
+		.centre_x = component->x == -1,
+		.centre_y = component->y == -1,
+		.measured = false};
+}
+
+// The top-left of something of the given size drawn at a placement
+auto Sorcery::LayoutCache::origin(const Placement &placement,
+								  const ImVec2 content) const -> ImVec2 {
+
+	return ImVec2{placement.centre_x
+					  ? (_metrics.viewport.x - content.x) / 2.0f
+					  : placement.pos.x,
+				  placement.centre_y
+					  ? (_metrics.viewport.y - content.y) / 2.0f
+					  : placement.pos.y};
+}
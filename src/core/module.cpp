@@ -36,9 +36,7 @@ auto Sorcery::Module::_fade(const std::function<void()> &draw, const float from,
 							const float to,
 							const std::chrono::milliseconds duration) -> void {
 
-	using clock = std::chrono::steady_clock;
-
-	const auto start{clock::now()};
+	const auto start{_ctx.now()};
 
 	_ctx.display->set_fade(from);
 
@@ -46,10 +44,10 @@ auto Sorcery::Module::_fade(const std::function<void()> &draw, const float from,
 
 		SDL_Event event{};
 
-		while (SDL_PollEvent(&event))
+		while (_ctx.poll_event(event))
 			ImGui_ImplSDL2_ProcessEvent(&event);
 
-		const auto elapsed{std::chrono::duration<float>(clock::now() - start)};
+		const auto elapsed{std::chrono::duration<float>(_ctx.now() - start)};
 
 		const auto total{std::chrono::duration<float>(duration)};
 
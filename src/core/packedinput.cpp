@@ -0,0 +1,120 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/packedinput.hpp"
+#include "common/ffmpeg.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// Size of the buffer FFmpeg reads through (it may reallocate this itself)
+static constexpr int PACKED_INPUT_BUFFER_SIZE{32768};
+
+Sorcery::PackedInput::PackedInput(std::span<const std::byte> data)
+	: _data{data},
+	  _position{0},
+	  _io{nullptr} {
+
+	auto *buffer{
+		static_cast<unsigned char *>(av_malloc(PACKED_INPUT_BUFFER_SIZE))};
+	if (!buffer)
+		throw std::runtime_error{"Failed to allocate packed input buffer"};
+
+	_io = avio_alloc_context(buffer, PACKED_INPUT_BUFFER_SIZE, 0, this,
+							 &PackedInput::_read, nullptr,
+							 &PackedInput::_seek);
+	if (!_io) {
+		av_free(buffer);
+		throw std::runtime_error{"Failed to allocate packed input context"};
+	}
+}
+
+Sorcery::PackedInput::~PackedInput() {
+
+	if (_io) {
+		av_freep(&_io->buffer);
+		avio_context_free(&_io);
+	}
+}
+
+// Equivalent of avformat_open_input() for the packed data
+auto Sorcery::PackedInput::open(AVFormatContext **format) -> int {
+
+	*format = avformat_alloc_context();
+	if (!*format)
+		return AVERROR(ENOMEM);
+
+	(*format)->pb = _io;
+	(*format)->flags |= AVFMT_FLAG_CUSTOM_IO;
+
+	// Note that on failure this frees the format context and nulls it
+	return avformat_open_input(format, nullptr, nullptr, nullptr);
+}
+
+auto Sorcery::PackedInput::_read(void *opaque, std::uint8_t *buffer,
+								 const int size) -> int {
+
+	auto *input{static_cast<PackedInput *>(opaque)};
+	const auto remaining{static_cast<std::int64_t>(input->_data.size()) -
+						 input->_position};
+	if (remaining <= 0)
+		return AVERROR_EOF;
+
+	const auto count{std::min<std::int64_t>(remaining, size)};
+	std::memcpy(buffer, input->_data.data() + input->_position,
+				static_cast<std::size_t>(count));
+	input->_position += count;
+
+	return static_cast<int>(count);
+}
+
+auto Sorcery::PackedInput::_seek(void *opaque, const std::int64_t offset,
+								 const int whence) -> std::int64_t {
+
+	auto *input{static_cast<PackedInput *>(opaque)};
+	const auto size{static_cast<std::int64_t>(input->_data.size())};
+
+	std::int64_t position{0};
+	switch (whence & ~AVSEEK_FORCE) {
+	case AVSEEK_SIZE:
+		return size;
+	case SEEK_SET:
+		position = offset;
+		break;
+	case SEEK_CUR:
+		position = input->_position + offset;
+		break;
+	case SEEK_END:
+		position = size + offset;
+		break;
+	default:
+		return AVERROR(EINVAL);
+	}
+
+	if (position < 0 || position > size)
+		return AVERROR(EINVAL);
+
+	input->_position = position;
+
+	return position;
+}
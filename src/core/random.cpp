@@ -98,6 +98,11 @@ auto Sorcery::Random::get(const Enums::System::Random random_type)
 	return _get(random_type);
 }
 
+auto Sorcery::Random::seed(const std::uint64_t value) -> void {
+
+	_random.seed(value);
+}
+
 auto Sorcery::Random::get_type(const int num) const -> Enums::System::Random {
 
 	return enum_cast<Enums::System::Random>(num).value_or(
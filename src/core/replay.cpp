@@ -0,0 +1,853 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "core/replay.hpp"
+#include "common/cereal.hpp"
+#include "core/context.hpp"
+#include "core/controller.hpp"
+#include "core/debug.hpp"
+#include "core/display.hpp"
+#include "core/random.hpp"
+#include "resources/define.hpp"
+#include "types/character.hpp"
+#include "types/config.hpp"
+#include "types/dice.hpp"
+#include "types/game.hpp"
+#include "types/itemtype.hpp"
+#include "types/monstertype.hpp"
+#include "types/state.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <print>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+#include <utility>
+
+namespace {
+
+constexpr std::string_view REPLAY_MAGIC{"SRPL"};
+constexpr std::uint64_t REPLAY_VERSION{2};
+constexpr auto REPLAY_SANDBOX{"sorcery-replay"};
+
+// Flush the log whenever this much has built up (as well as at checkpoints)
+constexpr std::size_t FLUSH_SIZE{64 * 1024};
+
+// One seed each for Random, Dice, ItemType and MonsterType
+using Seeds = std::array<std::uint64_t, 4>;
+
+enum class Kind : std::uint8_t {
+	QUIT,
+	WINDOW,
+	KEY,
+	TEXT,
+	MOTION,
+	BUTTON,
+	WHEEL
+};
+
+// Everything is stored as LEB128 varints (zigzagged if signed), which keeps a
+// frame without any input down to a single byte
+auto put_varint(std::string &out, std::uint64_t value) -> void {
+
+	while (value >= 0x80) {
+		out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+		value >>= 7;
+	}
+	out.push_back(static_cast<char>(value));
+}
+
+auto put_signed(std::string &out, const std::int64_t value) -> void {
+
+	put_varint(out, (static_cast<std::uint64_t>(value) << 1) ^
+						static_cast<std::uint64_t>(value >> 63));
+}
+
+auto put_byte(std::string &out, const std::uint8_t value) -> void {
+
+	out.push_back(static_cast<char>(value));
+}
+
+auto put_fixed(std::string &out, std::uint64_t value) -> void {
+
+	for (auto i = 0; i < 8; i++, value >>= 8)
+		out.push_back(static_cast<char>(value & 0xff));
+}
+
+auto put_string(std::string &out, std::string_view value) -> void {
+
+	put_varint(out, value.size());
+	out.append(value);
+}
+
+auto truncated() -> std::runtime_error {
+
+	return std::runtime_error{"Replay log is truncated"};
+}
+
+auto get_byte(std::string_view data, std::size_t &pos) -> std::uint8_t {
+
+	if (pos >= data.size())
+		throw truncated();
+
+	return static_cast<std::uint8_t>(data[pos++]);
+}
+
+auto get_varint(std::string_view data, std::size_t &pos) -> std::uint64_t {
+
+	std::uint64_t value{0};
+	for (auto shift = 0u; shift < 64; shift += 7) {
+		const auto byte{get_byte(data, pos)};
+		value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+			return value;
+	}
+
+	throw std::runtime_error{"Replay log contains an invalid number"};
+}
+
+auto get_signed(std::string_view data, std::size_t &pos) -> std::int64_t {
+
+	const auto value{get_varint(data, pos)};
+
+	return static_cast<std::int64_t>(value >> 1) ^
+		   -static_cast<std::int64_t>(value & 1);
+}
+
+auto get_fixed(std::string_view data, std::size_t &pos) -> std::uint64_t {
+
+	std::uint64_t value{0};
+	for (auto i = 0; i < 8; i++)
+		value |= static_cast<std::uint64_t>(get_byte(data, pos)) << (i * 8);
+
+	return value;
+}
+
+auto get_string(std::string_view data, std::size_t &pos) -> std::string {
+
+	const auto size{get_varint(data, pos)};
+	if (size > data.size() - pos)
+		throw truncated();
+
+	std::string value{data.substr(pos, size)};
+	pos += size;
+
+	return value;
+}
+
+auto read_file(const std::filesystem::path &path) -> std::string {
+
+	std::ifstream file{path, std::ios::binary};
+	if (!file)
+		throw std::runtime_error{
+			std::format("Unable to read {}", path.string())};
+
+	return {std::istreambuf_iterator<char>{file},
+			std::istreambuf_iterator<char>{}};
+}
+
+auto write_file(const std::filesystem::path &path, std::string_view data)
+	-> void {
+
+	std::ofstream file{path, std::ios::binary | std::ios::trunc};
+	if (!file)
+		throw std::runtime_error{
+			std::format("Unable to write {}", path.string())};
+
+	file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+// A file that may not exist: a flag, and then its contents if it does
+auto put_file(std::string &out, const std::filesystem::path &path) -> void {
+
+	std::error_code error{};
+	if (std::filesystem::is_regular_file(path, error)) {
+		put_byte(out, 1);
+		put_string(out, read_file(path));
+	} else
+		put_byte(out, 0);
+}
+
+auto get_file(std::string_view data, std::size_t &pos,
+			  const std::filesystem::path &path) -> bool {
+
+	if (!get_byte(data, pos))
+		return false;
+
+	write_file(path, get_string(data, pos));
+
+	return true;
+}
+
+// A new directory of our own each time, so that two replays running at once
+// (or anything else in the temporary directory) can't be trampled on
+auto make_sandbox() -> std::filesystem::path {
+
+	std::random_device device{};
+	const auto base{std::filesystem::temp_directory_path()};
+	while (true) {
+		auto path{base / std::format("{}-{}-{:08x}", REPLAY_SANDBOX,
+									 ::getpid(), device())};
+		if (std::filesystem::create_directory(path))
+			return path;
+	}
+}
+
+// FNV-1a, which is plenty for spotting that two states differ
+auto fnv1a(std::string_view bytes) -> std::uint64_t {
+
+	auto hash{0xcbf29ce484222325ull};
+	for (const auto byte : bytes) {
+		hash ^= static_cast<unsigned char>(byte);
+		hash *= 0x100000001b3ull;
+	}
+
+	return hash;
+}
+
+auto apply_seeds(Sorcery::Context &ctx, const Seeds &seeds) -> void {
+
+	ctx.random->seed(seeds[0]);
+	Sorcery::Dice::seed(seeds[1]);
+	Sorcery::ItemType::seed(seeds[2]);
+	Sorcery::MonsterType::seed(seeds[3]);
+}
+
+// Only the input that the game (or ImGui) acts upon is kept
+auto encode(const SDL_Event &event, std::string &out) -> bool {
+
+	const auto touch{[](const Uint32 which) -> std::uint8_t {
+		return which == SDL_TOUCH_MOUSEID ? 1 : 0;
+	}};
+
+	switch (event.type) {
+	case SDL_QUIT:
+		put_byte(out, std::to_underlying(Kind::QUIT));
+		return true;
+	case SDL_WINDOWEVENT:
+		put_byte(out, std::to_underlying(Kind::WINDOW));
+		put_byte(out, event.window.event);
+		put_signed(out, event.window.data1);
+		put_signed(out, event.window.data2);
+		return true;
+	case SDL_KEYDOWN:
+	case SDL_KEYUP:
+		put_byte(out, std::to_underlying(Kind::KEY));
+		put_byte(out, event.key.state);
+		put_byte(out, event.key.repeat);
+		put_varint(out, static_cast<std::uint64_t>(event.key.keysym.scancode));
+		put_signed(out, event.key.keysym.sym);
+		put_varint(out, event.key.keysym.mod);
+		return true;
+	case SDL_TEXTINPUT:
+		put_byte(out, std::to_underlying(Kind::TEXT));
+		put_string(out, std::string_view{event.text.text,
+										 ::strnlen(event.text.text,
+												   sizeof(event.text.text))});
+		return true;
+	case SDL_MOUSEMOTION:
+		put_byte(out, std::to_underlying(Kind::MOTION));
+		put_byte(out, touch(event.motion.which));
+		put_varint(out, event.motion.state);
+		put_signed(out, event.motion.x);
+		put_signed(out, event.motion.y);
+		put_signed(out, event.motion.xrel);
+		put_signed(out, event.motion.yrel);
+		return true;
+	case SDL_MOUSEBUTTONDOWN:
+	case SDL_MOUSEBUTTONUP:
+		put_byte(out, std::to_underlying(Kind::BUTTON));
+		put_byte(out, touch(event.button.which));
+		put_byte(out, event.button.button);
+		put_byte(out, event.button.state);
+		put_byte(out, event.button.clicks);
+		put_signed(out, event.button.x);
+		put_signed(out, event.button.y);
+		return true;
+	case SDL_MOUSEWHEEL:
+		put_byte(out, std::to_underlying(Kind::WHEEL));
+		put_byte(out, touch(event.wheel.which));
+		put_signed(out, event.wheel.x);
+		put_signed(out, event.wheel.y);
+		put_varint(out, event.wheel.direction);
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+		put_varint(out, std::bit_cast<std::uint32_t>(event.wheel.preciseX));
+		put_varint(out, std::bit_cast<std::uint32_t>(event.wheel.preciseY));
+#endif
+		return true;
+	default:
+		return false;
+	}
+}
+
+auto decode(std::string_view data, std::size_t &pos, const Uint32 timestamp)
+	-> SDL_Event {
+
+	const auto which{[&]() -> Uint32 {
+		return get_byte(data, pos) ? SDL_TOUCH_MOUSEID : 0;
+	}};
+	const auto to_int{[&]() -> Sint32 {
+		return static_cast<Sint32>(get_signed(data, pos));
+	}};
+
+	SDL_Event event{};
+	switch (static_cast<Kind>(get_byte(data, pos))) {
+	case Kind::QUIT:
+		event.type = SDL_QUIT;
+		break;
+	case Kind::WINDOW:
+		event.type = SDL_WINDOWEVENT;
+		event.window.event = get_byte(data, pos);
+		event.window.data1 = to_int();
+		event.window.data2 = to_int();
+		break;
+	case Kind::KEY:
+		event.key.state = get_byte(data, pos);
+		event.type = event.key.state == SDL_PRESSED ? SDL_KEYDOWN : SDL_KEYUP;
+		event.key.repeat = get_byte(data, pos);
+		event.key.keysym.scancode =
+			static_cast<SDL_Scancode>(get_varint(data, pos));
+		event.key.keysym.sym = static_cast<SDL_Keycode>(to_int());
+		event.key.keysym.mod = static_cast<Uint16>(get_varint(data, pos));
+		break;
+	case Kind::TEXT: {
+		event.type = SDL_TEXTINPUT;
+		const auto text{get_string(data, pos)};
+		const auto size{
+			std::min(text.size(), sizeof(event.text.text) - 1)};
+		std::memcpy(event.text.text, text.data(), size);
+		event.text.text[size] = '\0';
+	} break;
+	case Kind::MOTION:
+		event.type = SDL_MOUSEMOTION;
+		event.motion.which = which();
+		event.motion.state = static_cast<Uint32>(get_varint(data, pos));
+		event.motion.x = to_int();
+		event.motion.y = to_int();
+		event.motion.xrel = to_int();
+		event.motion.yrel = to_int();
+		break;
+	case Kind::BUTTON:
+		event.button.which = which();
+		event.button.button = get_byte(data, pos);
+		event.button.state = get_byte(data, pos);
+		event.type = event.button.state == SDL_PRESSED ? SDL_MOUSEBUTTONDOWN
+													   : SDL_MOUSEBUTTONUP;
+		event.button.clicks = get_byte(data, pos);
+		event.button.x = to_int();
+		event.button.y = to_int();
+		break;
+	case Kind::WHEEL:
+		event.type = SDL_MOUSEWHEEL;
+		event.wheel.which = which();
+		event.wheel.x = to_int();
+		event.wheel.y = to_int();
+		event.wheel.direction = static_cast<Uint32>(get_varint(data, pos));
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+		event.wheel.preciseX = std::bit_cast<float>(
+			static_cast<std::uint32_t>(get_varint(data, pos)));
+		event.wheel.preciseY = std::bit_cast<float>(
+			static_cast<std::uint32_t>(get_varint(data, pos)));
+#endif
+		break;
+	default:
+		throw std::runtime_error{"Replay log contains an unknown event"};
+	}
+
+	event.common.timestamp = timestamp;
+
+	return event;
+}
+
+}
+
+Sorcery::Replay::Replay(Context &ctx)
+	: _ctx{ctx},
+	  _mode{ReplayMode::OFF},
+	  _position{0},
+	  _frame{},
+	  _next_event{0},
+	  _pending_count{0},
+	  _frame_index{0},
+	  _event_count{0},
+	  _checkpoints{0},
+	  _elapsed{0},
+	  _last_elapsed{0},
+	  _start{clock::now()},
+	  _finished{false},
+	  _failed{false} {}
+
+Sorcery::Replay::~Replay() {
+
+	if (_mode == ReplayMode::RECORD && _out.is_open()) {
+		_flush();
+		_s_recording = nullptr;
+		DEBUG_LOGF("Recorded {} frames and {} events", _frame_index,
+				   _event_count);
+	}
+
+	if (!_sandbox.empty()) {
+		std::error_code error{};
+		std::filesystem::remove_all(_sandbox, error);
+	}
+}
+
+// Start recording; this has to happen before the saves are loaded (and before
+// anything uses an RNG), since both are captured in the header
+auto Sorcery::Replay::record(const std::filesystem::path &path,
+							 std::vector<std::string> args) -> void {
+
+	_out.open(path, std::ios::binary | std::ios::trunc);
+	if (!_out)
+		throw std::runtime_error{
+			std::format("Unable to write replay log {}", path.string())};
+
+	_args = std::move(args);
+
+	std::random_device device{};
+	Seeds seeds{};
+	for (auto &seed : seeds)
+		seed = (static_cast<std::uint64_t>(device()) << 32) | device();
+	apply_seeds(_ctx, seeds);
+
+	_buffer.append(REPLAY_MAGIC);
+	put_varint(_buffer, REPLAY_VERSION);
+	put_varint(_buffer, _args.size());
+	for (const auto &arg : _args)
+		put_string(_buffer, arg);
+	for (const auto seed : seeds)
+		put_fixed(_buffer, seed);
+
+	// The saves as they are now, so that playback starts from the same place
+	// (SaveStore can tell the older format apart by its contents)
+	auto game_file{_ctx.get_file(SAVE_GAME_FILE)};
+	std::error_code error{};
+	if (!std::filesystem::is_regular_file(game_file, error))
+		game_file = _ctx.get_file(SAVE_LEGACY_GAME_FILE);
+	put_file(_buffer, game_file);
+
+	std::vector<std::filesystem::path> characters{};
+	for (const auto &entry : std::filesystem::directory_iterator{
+			 _ctx.get_directory(SAVE_CHARACTERS_DIR), error})
+		if (entry.is_regular_file())
+			characters.emplace_back(entry.path());
+	std::ranges::sort(characters);
+	put_varint(_buffer, characters.size());
+	for (const auto &character : characters) {
+		put_string(_buffer, character.filename().string());
+		put_string(_buffer, read_file(character));
+	}
+
+	// As is the log journal (which is replayed into the log when the game is
+	// loaded) and the settings (some of which change the rules)
+	put_file(_buffer, _ctx.get_file(SAVE_GAME_FILE).parent_path() /
+						  SAVE_JOURNAL_FILE);
+	put_file(_buffer, _ctx.get_file(CONFIG_FILE));
+
+	_flush();
+
+	_mode = ReplayMode::RECORD;
+	_s_recording = this;
+	_start = clock::now();
+
+	DEBUG_LOGF("Recording session to {}", path.string());
+}
+
+// Start playing back; as with record() this needs to be done before the saves
+// are loaded, which will then come from a private copy of those recorded
+auto Sorcery::Replay::play(const std::filesystem::path &path) -> void {
+
+	_data = read_file(path);
+	if (!_data.starts_with(REPLAY_MAGIC))
+		throw std::runtime_error{
+			std::format("{} is not a replay log", path.string())};
+
+	_position = REPLAY_MAGIC.size();
+	if (get_varint(_data, _position) != REPLAY_VERSION)
+		throw std::runtime_error{std::format(
+			"{} was recorded by a different version", path.string())};
+
+	_args.resize(get_varint(_data, _position));
+	for (auto &arg : _args)
+		arg = get_string(_data, _position);
+
+	Seeds seeds{};
+	for (auto &seed : seeds)
+		seed = get_fixed(_data, _position);
+	apply_seeds(_ctx, seeds);
+
+	_sandbox = make_sandbox();
+	std::filesystem::create_directories(characters_directory());
+	get_file(_data, _position, save_file());
+
+	const auto count{get_varint(_data, _position)};
+	for (auto i = 0u; i < count; i++) {
+		const auto name{std::filesystem::path{get_string(_data, _position)}};
+		write_file(characters_directory() / name.filename(),
+				   get_string(_data, _position));
+	}
+
+	// SaveStore looks for the journal next to the game save; the settings
+	// are switched to the copy so that playback doesn't change ours either
+	get_file(_data, _position, _sandbox / SAVE_JOURNAL_FILE);
+	if (const auto config{_sandbox / CONFIG_FILE};
+		get_file(_data, _position, config))
+		_ctx.config->load(config);
+
+	_mode = ReplayMode::PLAY;
+	_start = clock::now();
+	if (!_read_frame())
+		_finish();
+
+	DEBUG_LOGF("Replaying session from {}", path.string());
+}
+
+auto Sorcery::Replay::mode() const noexcept -> ReplayMode {
+
+	return _mode;
+}
+
+auto Sorcery::Replay::hidden() const noexcept -> bool {
+
+	return _mode == ReplayMode::PLAY;
+}
+
+auto Sorcery::Replay::finished() const noexcept -> bool {
+
+	return _finished;
+}
+
+auto Sorcery::Replay::failed() const noexcept -> bool {
+
+	return _failed;
+}
+
+// The (lower-cased) command line the recording was made with
+auto Sorcery::Replay::args() const -> const std::vector<std::string> & {
+
+	return _args;
+}
+
+auto Sorcery::Replay::save_file() const -> std::filesystem::path {
+
+	return _sandbox / SAVE_GAME_FILE;
+}
+
+auto Sorcery::Replay::characters_directory() const -> std::filesystem::path {
+
+	return _sandbox / SAVE_CHARACTERS_DIR;
+}
+
+// Use in place of SDL_PollEvent()
+auto Sorcery::Replay::poll(SDL_Event &event) -> bool {
+
+	switch (_mode) {
+	case ReplayMode::RECORD:
+		if (!SDL_PollEvent(&event))
+			return false;
+		_capture(event);
+		return true;
+
+	case ReplayMode::PLAY: {
+
+		// Anything happening to the real (hidden) window is ignored
+		SDL_Event discard{};
+		while (SDL_PollEvent(&discard)) {
+		}
+
+		if (_finished || _next_event >= _frame.events.size())
+			return false;
+
+		event = _frame.events[_next_event++];
+		_deliver(event);
+		return true;
+	}
+
+	default:
+		return SDL_PollEvent(&event);
+	}
+}
+
+// Game time (only changes once a frame whilst recording or playing back)
+auto Sorcery::Replay::now() const -> clock::time_point {
+
+	if (_mode == ReplayMode::OFF)
+		return clock::now();
+
+	return _start + std::chrono::milliseconds{_elapsed};
+}
+
+// Length of the last frame in seconds, for ImGui (or 0 if not recording)
+auto Sorcery::Replay::frame_delta() const noexcept -> float {
+
+	if (_mode == ReplayMode::OFF)
+		return 0.0f;
+
+	return static_cast<float>(std::max<std::uint64_t>(_last_elapsed, 1)) /
+		   1000.0f;
+}
+
+// Called once at the end of every frame
+auto Sorcery::Replay::tick() -> void {
+
+	if (_mode == ReplayMode::RECORD) {
+
+		// Frames are stored in whole milliseconds, carrying the remainder
+		const auto total{static_cast<std::uint64_t>(
+			std::chrono::duration_cast<std::chrono::milliseconds>(
+				clock::now() - _start)
+				.count())};
+		_write_frame(total > _elapsed ? total - _elapsed : 0);
+
+	} else if (_mode == ReplayMode::PLAY && !_finished) {
+
+		// If this frame didn't poll everything that the recording did, then
+		// it must already have gone a different way
+		if (_next_event < _frame.events.size()) {
+			_fail(std::format("{} of the {} events recorded were never polled",
+							  _frame.events.size() - _next_event,
+							  _frame.events.size()));
+			return;
+		}
+
+		_elapsed += _frame.elapsed;
+		_last_elapsed = _frame.elapsed;
+
+		if (_is_checkpoint()) {
+			std::uint64_t game{};
+			std::uint64_t controller{};
+			_digest(game, controller);
+			const auto game_ok{game == _frame.game_digest};
+			const auto controller_ok{controller == _frame.controller_digest};
+			if (!game_ok || !controller_ok) {
+				const auto good{_checkpoints * CHECKPOINT_INTERVAL};
+				const auto last{_checkpoints == 0
+									? std::string{"none"}
+									: std::format("frame {}", good - 1)};
+				_fail(std::format(
+					"{} state differs from the recording (last good "
+					"checkpoint: {})",
+					!game_ok && !controller_ok ? "game and controller"
+					: !game_ok				   ? "game"
+											   : "controller",
+					last));
+				return;
+			}
+			++_checkpoints;
+		}
+
+		++_frame_index;
+		if (!_read_frame())
+			_finish();
+	}
+}
+
+auto Sorcery::Replay::_capture(const SDL_Event &event) -> void {
+
+	if (encode(event, _pending))
+		++_pending_count;
+}
+
+auto Sorcery::Replay::_deliver(SDL_Event &event) -> void {
+
+	auto *window{_ctx.display->get_SDL_window()};
+	const auto id{SDL_GetWindowID(window)};
+
+	switch (event.type) {
+	case SDL_WINDOWEVENT:
+		event.window.windowID = id;
+
+		// Mouse positions only make sense at the size that was recorded
+		if (event.window.event == SDL_WINDOWEVENT_RESIZED ||
+			event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+			SDL_SetWindowSize(window, event.window.data1, event.window.data2);
+		break;
+	case SDL_KEYDOWN:
+	case SDL_KEYUP:
+		event.key.windowID = id;
+		break;
+	case SDL_TEXTINPUT:
+		event.text.windowID = id;
+		break;
+	case SDL_MOUSEMOTION:
+		event.motion.windowID = id;
+		break;
+	case SDL_MOUSEBUTTONDOWN:
+	case SDL_MOUSEBUTTONUP:
+		event.button.windowID = id;
+		break;
+	case SDL_MOUSEWHEEL:
+		event.wheel.windowID = id;
+		break;
+	default:
+		break;
+	}
+}
+
+// The console log is left out of the game digest as it is timestamped
+auto Sorcery::Replay::_digest(std::uint64_t &game,
+							  std::uint64_t &controller) const -> void {
+
+	std::ostringstream stream{};
+	{
+		cereal::BinaryOutputArchive archive(stream);
+		if (_ctx.game) {
+			archive(_ctx.game->characters);
+			if (_ctx.game->state)
+				_ctx.game->state->checkpoint(archive);
+		}
+	}
+	game = fnv1a(stream.view());
+
+	stream.str({});
+	{
+		cereal::BinaryOutputArchive archive(stream);
+		archive(*_ctx.controller);
+	}
+	controller = fnv1a(stream.view());
+}
+
+auto Sorcery::Replay::_is_checkpoint() const noexcept -> bool {
+
+	return (_frame_index + 1) % CHECKPOINT_INTERVAL == 0;
+}
+
+auto Sorcery::Replay::_read_frame() -> bool {
+
+	if (_position >= _data.size())
+		return false;
+
+	try {
+		const auto header{get_varint(_data, _position)};
+		_frame.elapsed = header >> 1;
+		_frame.events.clear();
+		_next_event = 0;
+		if (header & 1) {
+			const auto count{get_varint(_data, _position)};
+			const auto timestamp{
+				static_cast<Uint32>(_elapsed + _frame.elapsed)};
+			for (auto i = 0u; i < count; i++)
+				_frame.events.emplace_back(decode(_data, _position, timestamp));
+		}
+		if (_is_checkpoint()) {
+			_frame.game_digest = get_fixed(_data, _position);
+			_frame.controller_digest = get_fixed(_data, _position);
+		}
+	} catch (const std::runtime_error &e) {
+		_fail(e.what());
+		return false;
+	}
+
+	_event_count += _frame.events.size();
+
+	return true;
+}
+
+auto Sorcery::Replay::_write_frame(const std::uint64_t elapsed) -> void {
+
+	// Start with the window size, since that decides where everything is
+	if (_frame_index == 0) {
+		SDL_Event resize{};
+		resize.type = SDL_WINDOWEVENT;
+		resize.window.event = SDL_WINDOWEVENT_SIZE_CHANGED;
+		SDL_GetWindowSize(_ctx.display->get_SDL_window(), &resize.window.data1,
+						  &resize.window.data2);
+		std::string first{};
+		encode(resize, first);
+		_pending.insert(0, first);
+		++_pending_count;
+	}
+
+	put_varint(_buffer, (elapsed << 1) | (_pending_count > 0 ? 1 : 0));
+	if (_pending_count > 0) {
+		put_varint(_buffer, _pending_count);
+		_buffer.append(_pending);
+	}
+
+	const auto checkpoint{_is_checkpoint()};
+	if (checkpoint) {
+		std::uint64_t game{};
+		std::uint64_t controller{};
+		_digest(game, controller);
+		put_fixed(_buffer, game);
+		put_fixed(_buffer, controller);
+		++_checkpoints;
+	}
+
+	if (checkpoint || _buffer.size() >= FLUSH_SIZE)
+		_flush();
+
+	_event_count += _pending_count;
+	_pending.clear();
+	_pending_count = 0;
+	_elapsed += elapsed;
+	_last_elapsed = elapsed;
+	++_frame_index;
+}
+
+auto Sorcery::Replay::_fail(std::string_view reason) -> void {
+
+	std::println(stderr, "Replay diverged at frame {} ({:.2f}s in): {}",
+				 _frame_index, static_cast<double>(_elapsed) / 1000.0, reason);
+
+	_failed = true;
+	_finished = true;
+}
+
+auto Sorcery::Replay::_finish() -> void {
+
+	// Having diverged, there is nothing more to say
+	if (_finished)
+		return;
+
+	const auto taken{
+		std::chrono::duration<double>(clock::now() - _start).count()};
+	const auto played{static_cast<double>(_elapsed) / 1000.0};
+
+	std::println("Replayed {} frames ({} events, {} checkpoints) covering "
+				 "{:.2f}s in {:.2f}s ({:.0f}x)",
+				 _frame_index, _event_count, _checkpoints, played, taken,
+				 taken > 0.0 ? played / taken : 0.0);
+
+	_finished = true;
+}
+
+auto Sorcery::Replay::_flush() -> void {
+
+	_out.write(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+	_out.flush();
+	_buffer.clear();
+}
+
+// Whatever has been recorded so far is still a valid log (it just ends early)
+auto Sorcery::Replay::flush_recording() -> void {
+
+	if (_s_recording)
+		_s_recording->_flush();
+}
@@ -22,23 +22,66 @@
 
 #include "core/resources.hpp"
 #include "core/context.hpp"
+#include "core/replay.hpp"
 #include "core/system.hpp"
 #include "resources/filestore.hpp"
 #include "resources/itemstore.hpp"
 #include "resources/levelstore.hpp"
 #include "resources/monsterstore.hpp"
 #include "resources/savestore.hpp"
+#include "resources/savewriter.hpp"
 #include "resources/spellstore.hpp"
 
-Sorcery::Resources::Resources(Context &ctx)
+// If deferred, the stores are left empty and the caller is responsible for
+// calling each of the loaders (which are independent of each other and so can
+// be safely run concurrently)
+Sorcery::Resources::Resources(Context &ctx, const bool deferred)
 	: _ctx{ctx} {
 
-	monsters = std::make_unique<MonsterStore>(_ctx.get_file(MONSTERS_FILE));
-	items = std::make_unique<ItemStore>(_ctx, _ctx.get_file(ITEMS_FILE));
-	levels = std::make_unique<LevelStore>(_ctx.get_file(MAPS_FILE));
+	if (deferred)
+		return;
+
+	load_monsters();
+	load_items();
+	load_levels();
+	load_spells();
+	load_saves();
+}
+
+auto Sorcery::Resources::load_items() -> void {
+
+	items = std::make_unique<ItemStore>(_ctx, _ctx.get_resource(ITEMS_FILE),
+										_ctx.baked);
+}
+
+auto Sorcery::Resources::load_levels() -> void {
+
+	levels = std::make_unique<LevelStore>(_ctx.get_resource(MAPS_FILE));
+}
+
+auto Sorcery::Resources::load_monsters() -> void {
+
+	monsters = std::make_unique<MonsterStore>(
+		_ctx.get_resource(MONSTERS_FILE), _ctx.baked);
+}
+
+auto Sorcery::Resources::load_spells() -> void {
+
 	spells = std::make_unique<SpellStore>(_ctx);
-	saves = std::make_unique<SaveStore>(
-		_ctx.get_file(SAVE_GAME_FILE), _ctx.get_directory(SAVE_CHARACTERS_DIR));
+}
+
+auto Sorcery::Resources::load_saves() -> void {
+
+	// A replay works on a private copy of the saves it was recorded from
+	if (_ctx.replay && _ctx.replay->mode() == ReplayMode::PLAY)
+		saves = std::make_unique<SaveStore>(
+			_ctx.replay->save_file(), _ctx.replay->characters_directory());
+	else
+		saves = std::make_unique<SaveStore>(
+			_ctx.get_file(SAVE_GAME_FILE),
+			_ctx.get_directory(SAVE_CHARACTERS_DIR));
+
+	writer = std::make_unique<SaveWriter>(*saves);
 }
 
 Sorcery::Resources::~Resources() {}
\ No newline at end of file
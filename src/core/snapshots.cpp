@@ -0,0 +1,361 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "core/snapshots.hpp"
+#include "common/cereal.hpp"
+#include "core/context.hpp"
+#include "core/controller.hpp"
+#include "core/debug.hpp"
+#include "resources/define.hpp"
+#include "resources/savestore.hpp"
+#include "resources/zstream.hpp"
+#include "types/game.hpp"
+#include "types/state.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <spanstream>
+#include <sstream>
+#include <utility>
+
+namespace {
+
+// Differing bytes closer together than this are kept as a single run
+constexpr std::size_t RUN_GAP{8};
+
+// Deltas never leave memory, so are in native byte order
+auto put_size(std::string &output, const std::size_t value) -> void {
+
+	const auto size{static_cast<std::uint32_t>(value)};
+	output.append(reinterpret_cast<const char *>(&size), sizeof(size));
+}
+
+auto get_size(const std::string &input, std::size_t &position)
+	-> std::size_t {
+
+	std::uint32_t size{};
+	std::memcpy(&size, input.data() + position, sizeof(size));
+	position += sizeof(size);
+
+	return size;
+}
+
+// An older snapshot as the runs of bytes that differ from a newer one - its
+// size, and then each run as its offset, length and the bytes themselves
+auto difference(const std::string &newer, const std::string &older)
+	-> std::string {
+
+	std::string delta{};
+	put_size(delta, older.size());
+
+	const auto common{std::min(newer.size(), older.size())};
+	std::size_t i{0};
+	while (i < common) {
+		if (newer[i] == older[i]) {
+			++i;
+			continue;
+		}
+
+		const auto start{i};
+		auto end{i + 1};
+		for (auto j = end; j < common && j - end < RUN_GAP; j++)
+			if (newer[j] != older[j])
+				end = j + 1;
+
+		put_size(delta, start);
+		put_size(delta, end - start);
+		delta.append(older, start, end - start);
+		i = end;
+	}
+
+	if (older.size() > common) {
+		put_size(delta, common);
+		put_size(delta, older.size() - common);
+		delta.append(older, common);
+	}
+
+	return delta;
+}
+
+auto patch(std::string newer, const std::string &delta) -> std::string {
+
+	std::size_t position{0};
+	newer.resize(get_size(delta, position));
+	while (position < delta.size()) {
+		const auto offset{get_size(delta, position)};
+		const auto size{get_size(delta, position)};
+		std::memcpy(newer.data() + offset, delta.data() + position, size);
+		position += size;
+	}
+
+	return newer;
+}
+
+// Written as a quicksave always has been, other than to a temporary file first
+// - and without the magic, as the oldest quicksaves were, if not compressing
+auto write_quicksave(const std::filesystem::path &path, const std::string &data,
+					 const bool compress) -> void {
+
+	const auto start{std::chrono::steady_clock::now()};
+	const std::filesystem::path temporary_file{path.string() + ".tmp"};
+	try {
+		std::uint64_t written{};
+		{
+			std::ofstream os(temporary_file, std::ios::binary);
+			if (!os.is_open())
+				throw std::runtime_error{"could not open " +
+										 temporary_file.string() +
+										 " for writing"};
+
+			if (compress) {
+				os.write(Sorcery::QUICKSAVE_MAGIC.data(),
+						 static_cast<std::streamsize>(
+							 Sorcery::QUICKSAVE_MAGIC.size()));
+				Sorcery::DeflateStream zs{os};
+				zs.write(data.data(),
+						 static_cast<std::streamsize>(data.size()));
+				zs.finish();
+				written = zs.produced();
+			} else {
+				os.write(data.data(),
+						 static_cast<std::streamsize>(data.size()));
+				written = data.size();
+			}
+			os.flush();
+			if (!os)
+				throw std::runtime_error{"could not write " +
+										 temporary_file.string()};
+		}
+		std::filesystem::rename(temporary_file, path);
+
+		DEBUG_LOGF("Quicksave successfully written to {} ({} bytes as {} in "
+				   "{} us)!",
+				   path.string(), data.size(), written,
+				   std::chrono::duration_cast<std::chrono::microseconds>(
+					   std::chrono::steady_clock::now() - start)
+					   .count());
+
+	} catch (const std::exception &error) {
+		std::error_code ignored_error;
+		std::filesystem::remove(temporary_file, ignored_error);
+		std::cerr << "Error: " << error.what() << ".\n";
+	}
+}
+
+}
+
+Sorcery::Snapshots::Snapshots(Context &ctx)
+	: persist{true},
+	  _ctx{ctx} {}
+
+Sorcery::Snapshots::~Snapshots() {
+
+	wait();
+}
+
+// Called at the start of each turn, so that the turn can be undone - unless
+// the last one can't be (it ended in an encounter, or on another floor, and
+// so on), in which case nothing before it can be either
+auto Sorcery::Snapshots::take() -> void {
+
+	if (!_ctx.controller->get_can_undo())
+		_ring.clear();
+
+	auto current{_serialise_turn()};
+	if (!_ring.empty()) {
+
+		// Which leaves the older one whole if it differs too much to be worth
+		// it (which is fine, as a whole one needs nothing after it to restore)
+		auto &newest{_ring.back()};
+		if (auto delta{difference(current, newest.data)};
+			delta.size() < newest.data.size())
+			newest = {.whole = false, .data = std::move(delta)};
+	}
+
+	_ring.push_back({.whole = true, .data = std::move(current)});
+	if (_ring.size() > CAPACITY)
+		_ring.pop_front();
+}
+
+// Go back to how things were at the start of a given number of turns ago,
+// forgetting the turns since
+auto Sorcery::Snapshots::rewind(const std::size_t turns) -> bool {
+
+	if (!_ctx.controller->get_can_undo() || turns == 0 ||
+		turns > _ring.size())
+		return false;
+
+	auto data{std::move(_ring.back().data)};
+	for (std::size_t i = 1; i < turns; i++) {
+		const auto &older{_ring[_ring.size() - 1 - i]};
+		data = older.whole ? older.data : patch(std::move(data), older.data);
+	}
+
+	_ring.resize(_ring.size() - turns);
+	if (!_ring.empty() && !_ring.back().whole)
+		_ring.back() = {.whole = true, .data = patch(data, _ring.back().data)};
+
+	_restore_turn(data);
+	_ctx.controller->set_can_undo(!_ring.empty());
+
+	DEBUG_LOGF("Rewound {} turns ({} left to rewind)", turns, _ring.size());
+
+	return true;
+}
+
+auto Sorcery::Snapshots::clear() -> void {
+
+	_ring.clear();
+}
+
+auto Sorcery::Snapshots::size() const noexcept -> std::size_t {
+
+	return _ring.size();
+}
+
+// Memory used by the ring
+auto Sorcery::Snapshots::bytes() const noexcept -> std::size_t {
+
+	std::size_t total{0};
+	for (const auto &snapshot : _ring)
+		total += snapshot.data.size();
+
+	return total;
+}
+
+auto Sorcery::Snapshots::save(const std::filesystem::path &path) -> bool {
+
+	wait();
+
+	if (_ctx.game && _ctx.game->state)
+		_ctx.game->state->flush_log_journal();
+	_quick = std::make_shared<const std::string>(_serialise());
+	_quick_path = path;
+	if (persist)
+		_flush = std::jthread{
+			[data = _quick, path, compress = _ctx.saves->compress.load()] {
+				write_quicksave(path, *data, compress);
+			}};
+
+	return true;
+}
+
+// Straight from memory if this was the last quicksave made, otherwise from
+// disc - where quicksaves from before they were compressed have no magic
+auto Sorcery::Snapshots::load(const std::filesystem::path &path) -> bool {
+
+	_ring.clear();
+
+	if (_quick && path == _quick_path) {
+		_restore(*_quick);
+		DEBUG_LOGF("Quicksave successfully loaded from memory!");
+		return true;
+	}
+
+	wait();
+
+	std::ifstream is(path, std::ios::binary);
+	if (!is.is_open()) {
+		std::cerr << "Error: could not open " << path.string()
+				  << " for reading.\n";
+		return false;
+	}
+
+	// Note we serialize INTO existing objects thus no need to reinject, other
+	// than into the State which is recreated (and whose floor is rebuilt)
+	std::string magic(QUICKSAVE_MAGIC.size(), '\0');
+	is.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+	if (is && magic == QUICKSAVE_MAGIC) {
+		InflateStream zs{is};
+		cereal::BinaryInputArchive archive(zs);
+		archive(*_ctx.game, *_ctx.controller);
+	} else {
+		is.clear();
+		is.seekg(0);
+		cereal::BinaryInputArchive archive(is);
+		archive(*_ctx.game, *_ctx.controller);
+	}
+	_ctx.game->state->set(&_ctx);
+
+	DEBUG_LOGF("Quicksave successfully loaded from {}!", path.string());
+
+	return true;
+}
+
+// Wait for any quicksave still being written
+auto Sorcery::Snapshots::wait() -> void {
+
+	if (_flush.joinable())
+		_flush.join();
+}
+
+auto Sorcery::Snapshots::_serialise() const -> std::string {
+
+	std::ostringstream ss{std::ios::binary};
+	{
+		cereal::BinaryOutputArchive archive(ss);
+		archive(*_ctx.game, *_ctx.controller);
+	}
+
+	return std::move(ss).str();
+}
+
+// Only the characters in the party can have changed in a turn
+auto Sorcery::Snapshots::_serialise_turn() const -> std::string {
+
+	std::ostringstream ss{std::ios::binary};
+	{
+		cereal::BinaryOutputArchive archive(ss);
+		const auto &game{*_ctx.game};
+		game.state->save_turn(archive);
+		for (const auto char_id : game.state->get_party_characters())
+			archive(game.characters.at(char_id));
+	}
+
+	return std::move(ss).str();
+}
+
+// As with loading a quicksave, the State is recreated and needs reinjecting
+auto Sorcery::Snapshots::_restore(const std::string &data) -> void {
+
+	std::ispanstream ss{std::span{data}};
+	cereal::BinaryInputArchive archive(ss);
+	archive(*_ctx.game, *_ctx.controller);
+	_ctx.game->state->set(&_ctx);
+}
+
+// Read straight into the State and party, which are never recreated by this
+auto Sorcery::Snapshots::_restore_turn(const std::string &data) -> void {
+
+	std::ispanstream ss{std::span{data}};
+	cereal::BinaryInputArchive archive(ss);
+	auto &game{*_ctx.game};
+	game.state->load_turn(archive);
+	for (const auto char_id : game.state->get_party_characters())
+		archive(game.characters.at(char_id));
+}
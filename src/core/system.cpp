@@ -26,8 +26,10 @@
 #include "common/sdl2.hpp"
 #include "core/animation.hpp"
 #include "core/audioplayer.hpp"
+#include "core/filewatcher.hpp"
 #include "core/macro.hpp"
 #include "core/random.hpp"
+#include "resources/bakedfile.hpp"
 #include "resources/define.hpp"
 #include "resources/filestore.hpp"
 #include "resources/stringstore.hpp"
@@ -46,7 +48,16 @@ Sorcery::System::System(int argc __attribute__((unused)),
 
 		// Modules
 		files = std::make_unique<FileStore>();
-		strings = std::make_unique<StringStore>(files->get(STRINGS_FILE));
+		baked = std::make_unique<BakedFile>(files->get_resource(BAKE_FILE));
+		strings = std::make_unique<StringStore>(
+			files->get_resource(STRINGS_FILE), baked.get());
+
+		// Strings can be edited whilst running (unless they are packed)
+		watcher = std::make_unique<FileWatcher>();
+		if (const auto &resource{strings->get_resource()}; !resource.packed())
+			watcher->watch(
+				resource.path, [this] { strings->reparse(); },
+				[this] { strings->commit(); });
 
 		_settings = std::make_unique<CSimpleIniA>();
 		_settings->SetUnicode();
@@ -55,7 +66,7 @@ Sorcery::System::System(int argc __attribute__((unused)),
 		config =
 			std::make_unique<Config>(_settings.get(), files->get(CONFIG_FILE));
 		random = std::make_unique<Random>();
-		animation = std::make_unique<Animation>(random.get());
+		animation = std::make_unique<Animation>();
 		audio = std::make_unique<AudioPlayer>();
 	}
 }
@@ -37,8 +37,10 @@
 #include "core/debug.hpp"
 #include "core/display.hpp"
 #include "core/enum.hpp"
+#include "core/filewatcher.hpp"
 #include "core/macro.hpp"
 #include "core/render.hpp"
+#include "core/replay.hpp"
 #include "core/resources.hpp"
 #include "core/system.hpp"
 #include "core/ui.hpp"
@@ -51,6 +53,7 @@
 #include "gui/menubuilder.hpp"
 #include "gui/message.hpp"
 #include "gui/modal.hpp"
+#include "gui/overlay.hpp"
 #include "gui/popup.hpp"
 #include "gui/uistyle.hpp"
 #include "gui/videoplayer.hpp"
@@ -61,10 +64,13 @@
 #include "resources/itemstore.hpp"
 #include "resources/levelstore.hpp"
 #include "resources/monsterstore.hpp"
+#include "resources/savewriter.hpp"
 #include "resources/spellstore.hpp"
+#include "resources/stringkeys.hpp"
 #include "resources/stringstore.hpp"
 #include "types/component.hpp"
 #include "types/config.hpp"
+#include "types/diceodds.hpp"
 #include "types/enum.hpp"
 #include "types/error.hpp"
 #include "types/game.hpp"
@@ -73,14 +79,26 @@
 #include "types/state.hpp"
 #include "types/tile.hpp"
 
-Sorcery::UI::UI(Context &ctx)
+Sorcery::UI::UI(Context &ctx, std::unique_ptr<ComponentStore> layout)
 	: _ctx{ctx} {
 
 	// Storage
-	components = std::make_unique<ComponentStore>(_ctx.get_file(LAYOUT_FILE));
+	components = layout ? std::move(layout)
+						: std::make_unique<ComponentStore>(
+							  _ctx.get_resource(LAYOUT_FILE));
+
+	// Pick up any edits to the layout whilst running (unless it is packed)
+	if (const auto &resource{components->get_resource()}; !resource.packed())
+		_ctx.system->watcher->watch(
+			resource.path, [this] { components->reparse(); },
+			[this] { components->commit(); });
 	images = std::make_unique<ImageStore>(_ctx);
 	menubuilder = std::make_unique<MenuBuilder>(_ctx);
 
+	// Every widget below registers itself with this as it is created
+	overlays = std::make_unique<OverlayStack>();
+	_ctx.overlays = overlays.get();
+
 	// Can't create fontstore just yet as it needs IMGUI initialised
 
 	// VFX and SFX players
@@ -89,8 +107,7 @@ Sorcery::UI::UI(Context &ctx)
 	// Initialise main menu background vfx
 	try {
 
-		auto bg_vfx_path{_ctx.get_file(MAINMENU_VIDEO).string()};
-		vfx_player->load(bg_vfx_path.c_str());
+		vfx_player->load(_ctx.get_resource(MAINMENU_VIDEO));
 
 	} catch (std::exception &e) {
 
@@ -101,94 +118,96 @@ Sorcery::UI::UI(Context &ctx)
 	}
 
 	// Custom components
-	dialog_exit =
-		std::make_unique<Dialog>(_ctx, components->get("main_menu:dialog_exit"),
-								 Enums::Layout::DialogType::CONFIRM);
-	dialog_new =
-		std::make_unique<Dialog>(_ctx, components->get("main_menu:dialog_new"),
-								 Enums::Layout::DialogType::CONFIRM);
+	dialog_exit = std::make_unique<Dialog>(
+		_ctx, components->get(COMPONENT("main_menu:dialog_exit")),
+		Enums::Layout::DialogType::CONFIRM);
+	dialog_new = std::make_unique<Dialog>(
+		_ctx, components->get(COMPONENT("main_menu:dialog_new")),
+		Enums::Layout::DialogType::CONFIRM);
 	dialog_leave = std::make_unique<Dialog>(
-		_ctx, components->get("main_menu:dialog_leave"),
+		_ctx, components->get(COMPONENT("main_menu:dialog_leave")),
+		Enums::Layout::DialogType::CONFIRM);
+	dialog_rite = std::make_unique<Dialog>(
+		_ctx, components->get(COMPONENT("rite:dialog_rite")),
 		Enums::Layout::DialogType::CONFIRM);
-	dialog_rite =
-		std::make_unique<Dialog>(_ctx, components->get("rite:dialog_rite"),
-								 Enums::Layout::DialogType::CONFIRM);
 	dialog_search = std::make_unique<Dialog>(
-		_ctx, components->get("engine_base_ui:dialog_search"),
+		_ctx, components->get(COMPONENT("engine_base_ui:dialog_search")),
 		Enums::Layout::DialogType::CONFIRM);
-	dialog_delete =
-		std::make_unique<Dialog>(_ctx, components->get("delete:dialog_delete"),
-								 Enums::Layout::DialogType::CONFIRM);
-	notice_divvy =
-		std::make_unique<Dialog>(_ctx, components->get("global:notice_divvy"),
-								 Enums::Layout::DialogType::OK);
+	dialog_delete = std::make_unique<Dialog>(
+		_ctx, components->get(COMPONENT("delete:dialog_delete")),
+		Enums::Layout::DialogType::CONFIRM);
+	notice_divvy = std::make_unique<Dialog>(
+		_ctx, components->get(COMPONENT("global:notice_divvy")),
+		Enums::Layout::DialogType::OK);
 	notice_renamed_ok = std::make_unique<Dialog>(
-		_ctx, components->get("global:notice_renamed_ok"),
+		_ctx, components->get(COMPONENT("global:notice_renamed_ok")),
 		Enums::Layout::DialogType::OK);
 	notice_reclassed_ok = std::make_unique<Dialog>(
-		_ctx, components->get("global:notice_reclassed_ok"),
+		_ctx, components->get(COMPONENT("global:notice_reclassed_ok")),
 		Enums::Layout::DialogType::OK);
 	notice_pool_gold = std::make_unique<Dialog>(
-		_ctx, components->get("global:notice_pool_gold"),
+		_ctx, components->get(COMPONENT("global:notice_pool_gold")),
 		Enums::Layout::DialogType::OK);
 	notice_cannot_donate = std::make_unique<Dialog>(
-		_ctx, components->get("global:notice_cannot_donate"),
+		_ctx, components->get(COMPONENT("global:notice_cannot_donate")),
 		Enums::Layout::DialogType::OK);
 	notice_donated_ok = std::make_unique<Dialog>(
-		_ctx, components->get("global:notice_donated_ok"),
+		_ctx, components->get(COMPONENT("global:notice_donated_ok")),
 		Enums::Layout::DialogType::OK);
 	notice_not_enough_gold = std::make_unique<Dialog>(
-		_ctx, components->get("global:notice_not_enough_gold"),
+		_ctx, components->get(COMPONENT("global:notice_not_enough_gold")),
 		Enums::Layout::DialogType::OK);
 	modal_camp = std::make_unique<Modal>(
-		_ctx, components->get("engine_base_ui:modal_camp"));
+		_ctx, components->get(COMPONENT("engine_base_ui:modal_camp")));
 
 	modal_elevator_top = std::make_unique<Modal>(
-		_ctx, components->get("global:modal_elevator_top"));
+		_ctx, components->get(COMPONENT("global:modal_elevator_top")));
 	modal_elevator_bottom = std::make_unique<Modal>(
-		_ctx, components->get("global:modal_elevator_bottom"));
-
-	modal_drop =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_drop"));
-	modal_inspect =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_inspect"));
-	modal_identify =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_identify"));
-	modal_equip =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_equip"));
+		_ctx, components->get(COMPONENT("global:modal_elevator_bottom")));
+
+	modal_drop = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_drop")));
+	modal_inspect = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_inspect")));
+	modal_identify = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_identify")));
+	modal_equip = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_equip")));
 	modal_remove = std::make_unique<Modal>(
-		_ctx, components->get("global:modal_remove_item"));
-	modal_trade =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_trade"));
-	modal_give =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_give"));
-	modal_use =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_use"));
-	modal_invoke =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_invoke"));
-	modal_spell =
-		std::make_unique<Modal>(_ctx, components->get("global:modal_spell"));
-
-	input_donate =
-		std::make_unique<Input>(_ctx, components->get("global:input_donate"));
-	input_name =
-		std::make_unique<Input>(_ctx, components->get("global:input_name"));
+		_ctx, components->get(COMPONENT("global:modal_remove_item")));
+	modal_trade = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_trade")));
+	modal_give = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_give")));
+	modal_use = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_use")));
+	modal_invoke = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_invoke")));
+	modal_spell = std::make_unique<Modal>(
+		_ctx, components->get(COMPONENT("global:modal_spell")));
+
+	input_donate = std::make_unique<Input>(
+		_ctx, components->get(COMPONENT("global:input_donate")));
+	input_name = std::make_unique<Input>(
+		_ctx, components->get(COMPONENT("global:input_name")));
 
 	dialog_stairs_up = std::make_unique<Dialog>(
-		_ctx, components->get("engine_base_ui:dialog_stairs_up"),
+		_ctx, components->get(COMPONENT("engine_base_ui:dialog_stairs_up")),
 		Enums::Layout::DialogType::CONFIRM);
 	dialog_stairs_down = std::make_unique<Dialog>(
-		_ctx, components->get("engine_base_ui:dialog_stairs_down"),
+		_ctx, components->get(COMPONENT("engine_base_ui:dialog_stairs_down")),
 		Enums::Layout::DialogType::CONFIRM);
 
 	message_tile = std::make_unique<Message>(
-		_ctx, components->get("engine_base_ui:message_tile"));
+		_ctx, components->get(COMPONENT("engine_base_ui:message_tile")));
+	_bind_overlays();
 
 	// Window, Font, and Display Settings
 	frame_rd = std::stoi(_ctx.get_config("Frame", "rounding"));
 	ui_rd = std::stoi(_ctx.get_config("UI", "rounding"));
 
 	// Updates _font_sz, _adj_grid_w, _adj_grid_h, and _grid_sz
+	_strings_generation = 0;
 	_ctx.display->update_display_metrics();
 	update_grid_metrics(_ctx.display->get_display_metrics());
 
@@ -425,6 +444,66 @@ auto Sorcery::UI::update_grid_metrics(const DisplayMetrics &metrics) noexcept
 	_grid_sz = std::min(_adj_grid_w, _adj_grid_h);
 	_base_font_sz = _base_width / static_cast<float>(_columns);
 	_font_sz = _base_font_sz * metrics.scale;
+
+	// Every placement depends on the above, so they need redoing
+	_layout_cache.invalidate();
+}
+
+// Where a component is drawn at the current resolution; this is resolved for
+// the whole layout at once (after a resize or a layout reload) so the draw
+// code only has to read it. Components that aren't part of the current layout
+// are worked out on demand instead
+auto Sorcery::UI::placement(const Component *component) -> Placement {
+
+	if (!_layout_cache.is_current(components->generation())) {
+		const auto &metrics{_ctx.display->get_display_metrics()};
+		_layout_cache.resolve(
+			components->all(),
+			LayoutMetrics{
+				.origin = ImVec2{metrics.offset_x, metrics.offset_y},
+				.cell = ImVec2{_adj_grid_w, _adj_grid_h},
+				.viewport = ImVec2{static_cast<float>(metrics.window_w),
+								   static_cast<float>(metrics.window_h)},
+				.font_sz = _font_sz},
+			components->generation());
+	}
+
+	// Any text measured for centring may have changed with the strings
+	if (_ctx.strings->generation() != _strings_generation) {
+		_layout_cache.forget_content();
+		_strings_generation = _ctx.strings->generation();
+	}
+
+	if (const auto *placement{_layout_cache.find(component)}; placement)
+		return *placement;
+
+	return _layout_cache.place(component);
+}
+
+auto Sorcery::UI::layout_origin(const Placement &placement,
+								const ImVec2 content) const -> ImVec2 {
+
+	return _layout_cache.origin(placement, content);
+}
+
+// Text is only measured if it is centred, and then only the first time (the
+// measurement is kept in the cache, if the component is in it); note that the
+// font must have been set beforehand
+auto Sorcery::UI::_text_origin(const Component *component,
+							   Placement &placement, std::string_view text)
+	-> ImVec2 {
+
+	if ((placement.centre_x || placement.centre_y) && !placement.measured) {
+		placement.content =
+			ImGui::CalcTextSize(text.data(), text.data() + text.size());
+		placement.measured = true;
+		if (auto *cached{_layout_cache.find(component)}; cached) {
+			cached->content = placement.content;
+			cached->measured = true;
+		}
+	}
+
+	return _layout_cache.origin(placement, placement.content);
 }
 
 // Create a Modal on Demand (used whenever data items on it aren't fixed - for
@@ -438,194 +517,82 @@ auto Sorcery::UI::create_dynamic_modal(const std::string name) -> void {
 		if (modal_inspect.get())
 			modal_inspect.reset();
 		modal_inspect = std::make_unique<Modal>(
-			_ctx, components->get("global:modal_inspect"));
+			_ctx, components->get(COMPONENT("global:modal_inspect")));
 		modal_inspect->regenerate();
 	} else if (name == "modal_help") {
 		if (modal_help.get())
 			modal_help.reset();
-		modal_help =
-			std::make_unique<Modal>(_ctx, components->get("global:modal_help"));
+		modal_help = std::make_unique<Modal>(
+			_ctx, components->get(COMPONENT("global:modal_help")));
 		modal_help->regenerate();
 	} else if (name == "modal_tithe") {
 		if (modal_tithe.get())
 			modal_tithe.reset();
 		modal_tithe = std::make_unique<Modal>(
-			_ctx, components->get("global:modal_tithe"));
+			_ctx, components->get(COMPONENT("global:modal_tithe")));
 		modal_tithe->regenerate();
 	} else if (name == "modal_identify") {
 		if (modal_identify.get())
 			modal_identify.reset();
 		modal_identify = std::make_unique<Modal>(
-			_ctx, components->get("global:modal_identify"));
+			_ctx, components->get(COMPONENT("global:modal_identify")));
 		modal_identify->regenerate();
 	} else if (name == "modal_equip") {
 		if (modal_equip.get())
 			modal_equip.reset();
 		modal_equip = std::make_unique<Modal>(
-			_ctx, components->get("global:modal_equip"));
+			_ctx, components->get(COMPONENT("global:modal_equip")));
 		modal_equip->regenerate();
 	} else if (name == "modal_remove") {
 		if (modal_remove.get())
 			modal_remove.reset();
 		modal_remove = std::make_unique<Modal>(
-			_ctx, components->get("global:modal_remove_item"));
+			_ctx, components->get(COMPONENT("global:modal_remove_item")));
 		modal_remove->regenerate();
 	} else if (name == "modal_spell") {
 		if (modal_spell.get())
 			modal_spell.reset();
 		modal_spell = std::make_unique<Modal>(
-			_ctx, components->get("global:modal_spell"));
+			_ctx, components->get(COMPONENT("global:modal_spell")));
 		modal_spell->regenerate();
 	} else if (name == "modal_drop") {
 		if (modal_drop.get())
 			modal_drop.reset();
-		modal_drop =
-			std::make_unique<Modal>(_ctx, components->get("global:modal_drop"));
+		modal_drop = std::make_unique<Modal>(
+			_ctx, components->get(COMPONENT("global:modal_drop")));
 		modal_drop->regenerate();
 	} else if (name == "modal_trade") {
 		if (modal_trade.get())
 			modal_trade.reset();
 		modal_trade = std::make_unique<Modal>(
-			_ctx, components->get("global:modal_trade"));
+			_ctx, components->get(COMPONENT("global:modal_trade")));
 		modal_trade->regenerate();
 	} else if (name == "modal_give") {
 		if (modal_give.get())
 			modal_give.reset();
-		modal_give =
-			std::make_unique<Modal>(_ctx, components->get("global:modal_give"));
+		modal_give = std::make_unique<Modal>(
+			_ctx, components->get(COMPONENT("global:modal_give")));
 		modal_give->regenerate();
 	} else if (name == "modal_use") {
 		if (modal_use.get())
 			modal_use.reset();
-		modal_use =
-			std::make_unique<Modal>(_ctx, components->get("global:modal_use"));
+		modal_use = std::make_unique<Modal>(
+			_ctx, components->get(COMPONENT("global:modal_use")));
 		modal_use->regenerate();
 	} else if (name == "modal_invoke") {
 		if (modal_invoke.get())
 			modal_invoke.reset();
 		modal_invoke = std::make_unique<Modal>(
-			_ctx, components->get("global:modal_invoke"));
+			_ctx, components->get(COMPONENT("global:modal_invoke")));
 		modal_invoke->regenerate();
 	}
 
 	// Note that modal_camp is not dynamic and thus isn't handled here
+	_bind_overlays();
 }
 
 auto Sorcery::UI::_draw_window_menu() -> void {}
 
-// Not an ideal function, really need to maintain a pointer status map instead
-auto Sorcery::UI::_get_popups() const -> std::string {
-
-	auto get_popup_status{[](void *component, std::string type) -> std::string {
-		if (component != nullptr) {
-			if (type == "modal") {
-				auto casted{(Modal *)component};
-				auto name{casted->name()};
-				return std::format("{:>26}: {}\n", name, casted->show);
-			} else if (type == "dialog") {
-				auto casted{(Dialog *)component};
-				auto name{casted->name()};
-				return std::format("{:>26}: {}\n", name, casted->show);
-			} else if (type == "message") {
-				auto casted{(Message *)component};
-				auto name{casted->name()};
-				return std::format("{:>26}: {}\n", name, casted->show);
-			} else if (type == "popup") {
-				auto casted{(Popup *)component};
-				auto name{casted->name()};
-				return std::format("{:>26}: {}\n", name, casted->show);
-			} else if (type == "input") {
-				auto casted{(Input *)component};
-				auto name{casted->name()};
-				return std::format("{:>26}: {}\n", name, casted->show);
-			}
-		}
-
-		return "";
-	}};
-
-	std::string output{};
-	if (dialog_exit)
-		output.append(get_popup_status((void *)dialog_exit.get(), "dialog"));
-	if (dialog_leave)
-		output.append(get_popup_status((void *)dialog_leave.get(), "dialog"));
-	if (dialog_new)
-		output.append(get_popup_status((void *)dialog_new.get(), "dialog"));
-	if (dialog_rite)
-		output.append(get_popup_status((void *)dialog_rite.get(), "dialog"));
-	if (dialog_search)
-		output.append(get_popup_status((void *)dialog_search.get(), "dialog"));
-	if (dialog_delete)
-		output.append(get_popup_status((void *)dialog_delete.get(), "dialog"));
-	if (dialog_stairs_down)
-		output.append(
-			get_popup_status((void *)dialog_stairs_down.get(), "dialog"));
-	if (dialog_stairs_up)
-		output.append(
-			get_popup_status((void *)dialog_stairs_up.get(), "dialog"));
-	if (input_donate)
-		output.append(get_popup_status((void *)input_donate.get(), "input"));
-	if (input_name)
-		output.append(get_popup_status((void *)input_name.get(), "input"));
-	if (message_tile)
-		output.append(get_popup_status((void *)message_tile.get(), "message"));
-	if (modal_camp)
-		output.append(get_popup_status((void *)modal_camp.get(), "modal"));
-	if (modal_elevator_bottom)
-		output.append(
-			get_popup_status((void *)modal_elevator_bottom.get(), "modal"));
-	if (modal_elevator_top)
-		output.append(
-			get_popup_status((void *)modal_elevator_top.get(), "modal"));
-	if (modal_drop)
-		output.append(get_popup_status((void *)modal_drop.get(), "modal"));
-	if (modal_equip)
-		output.append(get_popup_status((void *)modal_equip.get(), "modal"));
-	if (modal_give)
-		output.append(get_popup_status((void *)modal_give.get(), "modal"));
-	if (modal_help)
-		output.append(get_popup_status((void *)modal_help.get(), "modal"));
-	if (modal_identify)
-		output.append(get_popup_status((void *)modal_identify.get(), "modal"));
-	if (modal_inspect)
-		output.append(get_popup_status((void *)modal_inspect.get(), "modal"));
-	if (modal_invoke)
-		output.append(get_popup_status((void *)modal_invoke.get(), "modal"));
-	if (modal_remove)
-		output.append(get_popup_status((void *)modal_remove.get(), "modal"));
-	if (modal_spell)
-		output.append(get_popup_status((void *)modal_spell.get(), "modal"));
-	if (modal_tithe)
-		output.append(get_popup_status((void *)modal_tithe.get(), "modal"));
-	if (modal_trade)
-		output.append(get_popup_status((void *)modal_trade.get(), "modal"));
-	if (modal_use)
-		output.append(get_popup_status((void *)modal_use.get(), "modal"));
-
-	if (notice_cannot_donate)
-		output.append(
-			get_popup_status((void *)notice_cannot_donate.get(), "dialog"));
-	if (notice_divvy)
-		output.append(get_popup_status((void *)notice_divvy.get(), "dialog"));
-	if (notice_donated_ok)
-		output.append(
-			get_popup_status((void *)notice_donated_ok.get(), "dialog"));
-	if (notice_not_enough_gold)
-		output.append(
-			get_popup_status((void *)notice_not_enough_gold.get(), "dialog"));
-	if (notice_pool_gold)
-		output.append(
-			get_popup_status((void *)notice_pool_gold.get(), "dialog"));
-	if (notice_renamed_ok)
-		output.append(
-			get_popup_status((void *)notice_renamed_ok.get(), "dialog"));
-	if (notice_reclassed_ok)
-		output.append(
-			get_popup_status((void *)notice_reclassed_ok.get(), "dialog"));
-
-	return output;
-}
-
 auto Sorcery::UI::start() -> void {
 
 	DEBUG_LOG("Starting UI...");
@@ -673,24 +640,12 @@ auto Sorcery::UI::start() -> void {
 	style.TabRounding = ui_rd;
 	style.ChildBorderSize = ui_rd;
 
-	selected.clear();
-	highlighted.clear();
-
-	selected["main_menu"] = 0;
-	highlighted["main_menu"] = 0;
-	selected["compendium_menu"] = 0;
-	highlighted["compendium_menu"] = 0;
-
-	selected["bestiary"] = 0;
-	highlighted["bestiary"] = 0;
-	selected["museum"] = 0;
-	highlighted["museum"] = 0;
-	selected["spellbook"] = 0;
-	highlighted["spellbook"] = 0;
-	selected["atlas"] = 0;
-	highlighted["atlas"] = 0;
-	selected["class_menu"] = 8;
-	highlighted["class_menu"] = 8;
+	selected.fill(0);
+	highlighted.fill(0);
+
+	const MenuKey class_menu{"class_menu"};
+	selected[class_menu.id()] = 8;
+	highlighted[class_menu.id()] = 8;
 
 	ms_selected.fill(false);
 	ps_selected.fill(false);
@@ -752,6 +707,8 @@ auto Sorcery::UI::display_engine() -> void {
 	// Start a new Rendering Frame
 	ImGui_ImplOpenGL3_NewFrame();
 	ImGui_ImplSDL2_NewFrame();
+	if (const auto delta{_ctx.replay->frame_delta()}; delta > 0.0f)
+		ImGui::GetIO().DeltaTime = delta;
 	ImGui::NewFrame();
 
 	_setup_windows();
@@ -761,48 +718,18 @@ auto Sorcery::UI::display_engine() -> void {
 	_draw_components("engine_base_ui");
 
 	if (!_ctx.controller->get_monochrome()) {
-		auto bg_c{components->get("engine_base_ui:background_image")};
+		auto bg_c{
+			components->get(COMPONENT("engine_base_ui:background_image"))};
 		_draw_tiled_bg(&bg_c);
 	}
 
-	dialog_leave->display(_ctx.controller->want_to_leave_game());
-	dialog_stairs_up->display(_ctx.get_flag_ref("want_take_stairs_up"));
-	dialog_stairs_down->display(_ctx.get_flag_ref("want_take_stairs_down"));
-	message_tile->display(_ctx.get_flag_ref("after_tile_message"));
-	if (modal_camp->show)
-		modal_camp->display(_ctx.get_flag_ref("want_camp"));
-	if (modal_elevator_top->show)
-		modal_elevator_top->display(_ctx.get_flag_ref("want_elevator_top"));
-	if (modal_elevator_bottom->show)
-		modal_elevator_bottom->display(
-			_ctx.get_flag_ref("want_elevator_bottom"));
-	if (modal_inspect->show)
-		modal_inspect->display(_ctx.get_flag_ref("want_inspect"));
-	if (dialog_search->show)
-		dialog_search->display(_ctx.get_flag_ref("want_search"));
-	if (modal_identify->show)
-		modal_identify->display(_ctx.get_flag_ref("want_identify"));
-	if (modal_equip->show)
-		modal_equip->display(_ctx.get_flag_ref("want_equip"));
-	if (modal_remove->show)
-		modal_remove->display(_ctx.get_flag_ref("want_remove"));
-	if (modal_drop->show)
-		modal_drop->display(_ctx.get_flag_ref("want_drop"));
-	if (modal_trade->show)
-		modal_trade->display(_ctx.get_flag_ref("want_trade"));
-	if (modal_give->show)
-		modal_give->display(_ctx.get_flag_ref("want_give"));
-	if (modal_use->show)
-		modal_use->display(_ctx.get_flag_ref("want_use"));
-	if (modal_invoke->show)
-		modal_invoke->display(_ctx.get_flag_ref("want_invoke"));
-	if (modal_spell->show)
-		modal_spell->display(_ctx.get_flag_ref("want_spell"));
-	if (notice_pool_gold->show)
-		notice_pool_gold->display(_ctx.get_flag_ref("want_pool_gold"));
-	if (_ctx.get_flag("interface_ui") && _ctx.get_flag("interface_party_panel"))
+	// Only whatever is actually open is drawn, in the order it was opened
+	overlays->draw();
+
+	if (_ctx.get_flag(CONTROL("interface_ui")) &&
+		_ctx.get_flag(CONTROL("interface_party_panel")))
 		_draw_party_panel();
-	if (_ctx.get_flag("interface_ui")) {
+	if (_ctx.get_flag(CONTROL("interface_ui"))) {
 		_draw_compass();
 		_draw_buffbar();
 		_draw_icons();
@@ -810,7 +737,8 @@ auto Sorcery::UI::display_engine() -> void {
 	}
 
 	// Dungeon View
-	auto component{components->get("engine_base_ui:wire_frame_view")};
+	auto component{
+		components->get(COMPONENT("engine_base_ui:wire_frame_view"))};
 	_render->draw(&component);
 
 	// Transient overlay
@@ -839,6 +767,8 @@ auto Sorcery::UI::display(Enums::Screen screen, std::any payload) -> void {
 	// Start a new Rendering Frame
 	ImGui_ImplOpenGL3_NewFrame();
 	ImGui_ImplSDL2_NewFrame();
+	if (const auto delta{_ctx.replay->frame_delta()}; delta > 0.0f)
+		ImGui::GetIO().DeltaTime = delta;
 	ImGui::NewFrame();
 
 	_setup_windows();
@@ -1042,7 +972,7 @@ auto Sorcery::UI::_draw_fg_image_with_idx(std::string_view source,
 							tint);
 }
 
-auto Sorcery::UI::_draw_fg_image(Component *component) -> void {
+auto Sorcery::UI::_draw_fg_image(const Component *component) -> void {
 
 	if (!images->show_images) {
 
@@ -1074,9 +1004,9 @@ auto Sorcery::UI::_draw_fg_image(Component *component) -> void {
 		return;
 	}
 
-	if (component->get("source")) {
-		const auto source{component->get("source").value()};
-		const auto scale{component->get_float("scale")};
+	if (component->get(PROPERTY("source"))) {
+		const auto source{component->get(PROPERTY("source")).value()};
+		const auto scale{component->get_float(PROPERTY("scale"))};
 
 		// Load the image if necessary
 		if (!images->has_loaded(source))
@@ -1089,25 +1019,14 @@ auto Sorcery::UI::_draw_fg_image(Component *component) -> void {
 								(intptr_t)src_image.height * scale * scaling}};
 
 		// Work out where to draw the image
-		const auto x{std::invoke([&] {
-			if (component->x == -1) {
-				const auto viewport{ImGui::GetMainViewport()};
-				return (viewport->Size.x - resized.w) / 2;
-			} else
-				return grid_pos(component->x, component->y).x;
-		})};
-		const auto y{std::invoke([&] {
-			if (component->y == -1) {
-				const auto viewport{ImGui::GetMainViewport()};
-				return (viewport->Size.y - resized.h) / 2;
-			} else
-				return grid_pos(component->x, component->y).y;
-		})};
+		const auto pos{layout_origin(
+			placement(component), ImVec2{static_cast<float>(resized.w),
+										 static_cast<float>(resized.h)})};
 
 		// Draw the Image
 		with_Window(WINDOW_LAYER_IMAGES, nullptr,
 					ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
-			ImGui::SetCursorPos(ImVec2{x, y});
+			ImGui::SetCursorPos(pos);
 			ImVec4 tint_col{ImVec4(1.0f, 1.0f, 1.0f, _ctx.animation->fade)};
 			ImGui::ImageWithBg(_to_imgui(src_image.texture),
 							   ImVec2{static_cast<float>(resized.w),
@@ -1118,7 +1037,7 @@ auto Sorcery::UI::_draw_fg_image(Component *component) -> void {
 	}
 }
 
-auto Sorcery::UI::_draw_tiled_bg(Component *component) -> void {
+auto Sorcery::UI::_draw_tiled_bg(const Component *component) -> void {
 
 	if (!images->show_images) {
 
@@ -1185,10 +1104,10 @@ auto Sorcery::UI::_draw_bg_image(Component *component) -> void {
 		}
 	}
 
-	if (component->get("source")) {
+	if (component->get(PROPERTY("source"))) {
 
 		// Load the image if necessary
-		const auto source{component->get("source").value()};
+		const auto source{component->get(PROPERTY("source")).value()};
 		if (!images->has_loaded(source))
 			images->load_image(source);
 
@@ -1306,7 +1225,7 @@ auto Sorcery::UI::_draw_cursor() -> void {
 }
 
 // Draw a Frame
-auto Sorcery::UI::_draw_frame(Component *component) -> void {
+auto Sorcery::UI::_draw_frame(const Component *component) -> void {
 
 	// Note the Frame class calls Gui::->draw_frame() below
 	auto frame{std::make_shared<Frame>(_ctx, component)};
@@ -1314,7 +1233,7 @@ auto Sorcery::UI::_draw_frame(Component *component) -> void {
 }
 
 // Draw a Menu
-auto Sorcery::UI::_draw_menu(Component *component) -> void {
+auto Sorcery::UI::_draw_menu(const Component *component) -> void {
 
 	auto menu{std::make_shared<Menu>(_ctx, component, _ctx.game)};
 	menu->regenerate();
@@ -1334,7 +1253,7 @@ auto Sorcery::UI::base_font_sz() const noexcept -> float {
 
 auto Sorcery::UI::_draw_debug() -> void {
 
-	if (!_ctx.controller->get_flag("debug_ui"))
+	if (!_ctx.controller->get_flag(CONTROL("debug_ui")))
 		return;
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr,
@@ -1346,7 +1265,7 @@ auto Sorcery::UI::_draw_debug() -> void {
 		ImGui::TextUnformatted(_ctx.controller->get_flags().c_str());
 
 		ImGui::SetCursorPos(ImVec2{1000, 400});
-		ImGui::TextUnformatted(_get_popups().c_str());
+		ImGui::TextUnformatted(overlays->describe().c_str());
 
 		ImGui::SetCursorPos(ImVec2{8, 700});
 		ImGui::TextUnformatted(_ctx.controller->get_characters().c_str());
@@ -1361,21 +1280,22 @@ auto Sorcery::UI::_draw_debug() -> void {
 }
 
 // Draw a Paragraph (Wrapped Multiline Text)
-auto Sorcery::UI::_draw_paragraph(Component *component) -> void {
+auto Sorcery::UI::_draw_paragraph(const Component *component) -> void {
 
 	with_Window(WINDOW_LAYER_TEXTS, nullptr,
 				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
 
+		const auto place{placement(component)};
 		set_Font(fontstore->get_current_font(component->font).value(),
-				 font_sz());
-		const auto wrap{component->get_float("width") * font_sz()};
-		auto p_min{grid_pos(component->x, component->y)};
+				 place.font_sz);
+		const auto wrap{place.wrap};
+		const auto p_min{place.pos};
 
 		ImGui::SetCursorPos(p_min);
 		with_TextWrapPos(p_min.x + wrap) {
 			set_StyleColor(ImGuiCol_Text, component->colour);
 			ImGui::TextUnformatted(
-				_ctx.get_string(component->string_key).c_str());
+				_ctx.get_text(component->string_key).data());
 		}
 	}
 }
@@ -1446,37 +1366,20 @@ auto Sorcery::UI::_draw_button_click(Component *component, bool &flag,
 
 	// Need to push font first before calculating size else it will
 	// assume monospace font size!
-	set_Font(fontstore->get_current_font(component->font).value(), font_sz());
+	auto place{placement(component)};
+	set_Font(fontstore->get_current_font(component->font).value(),
+			 place.font_sz);
 	const auto name{component->name};
 	const auto col{get_hl_colour(_ctx.animation->lerp)};
-	auto x{std::invoke([&] {
-		if (component->x == -1) {
-			const auto viewport{ImGui::GetMainViewport()};
-			const auto width{ImGui::CalcTextSize(
-				CSTR(_ctx.get_string(component->string_key)))};
-			return (viewport->Size.x - width.x) / 2;
-		} else
-			return grid_pos(component->x, component->y).x;
-	})};
-	auto y{std::invoke([&] {
-		if (component->y == -1) {
-			const auto viewport{ImGui::GetMainViewport()};
-			const auto height{ImGui::CalcTextSize(
-				CSTR(_ctx.get_string(component->string_key)))};
-			return (viewport->Size.y - height.y) / 2;
-		} else
-			return grid_pos(component->x, component->y).y;
-	})};
+	const auto text{_ctx.get_text(component->string_key)};
+	const auto pos{_text_origin(component, place, text)};
 
-	if (component->get("adjust_x"))
-		x += component->get_float("adjust_x");
-	if (component->get("adjust_y"))
-		y += component->get_float("adjust_y");
 	UIStyle::set_faded(_ctx);
 	set_StyleColor(ImGuiCol_ButtonHovered, (ImVec4)col);
-	ImGui::SetCursorPos(ImVec2{x, y});
+	ImGui::SetCursorPos(
+		ImVec2{pos.x + place.adjust.x, pos.y + place.adjust.y});
 	with_ID(name.c_str()) {
-		if (ImGui::Button(CSTR(_ctx.get_string(component->string_key)))) {
+		if (ImGui::Button(text.data())) {
 			// Handle buttons being used to switch on AND off the flag
 			flag = !reverse;
 			_ctx.controller->handle_button_click(component->name, this, -1);
@@ -1485,46 +1388,28 @@ auto Sorcery::UI::_draw_button_click(Component *component, bool &flag,
 }
 
 // Draw a Button
-auto Sorcery::UI::_draw_button(Component *component,
+auto Sorcery::UI::_draw_button(const Component *component,
 							   std::optional<bool *> is_clicked) -> void {
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoDecoration) {
 
 		// Need to push font first before calculating size else it will
 		// assume monospace font size!
+		auto place{placement(component)};
 		set_Font(fontstore->get_current_font(component->font).value(),
-				 font_sz());
+				 place.font_sz);
 		const auto name{component->name};
 		const auto col{get_hl_colour(_ctx.animation->lerp)};
-		auto x{std::invoke([&] {
-			if (component->x == -1) {
-				const auto viewport{ImGui::GetMainViewport()};
-				const auto width{ImGui::CalcTextSize(
-					CSTR(_ctx.get_string(component->string_key)))};
-				return (viewport->Size.x - width.x) / 2;
-			} else
-				return grid_pos(component->x, component->y).x;
-		})};
-		auto y{std::invoke([&] {
-			if (component->y == -1) {
-				const auto viewport{ImGui::GetMainViewport()};
-				const auto height{ImGui::CalcTextSize(
-					CSTR(_ctx.get_string(component->string_key)))};
-				return (viewport->Size.y - height.y) / 2;
-			} else
-				return grid_pos(component->x, component->y).y;
-		})};
-		if (component->get("adjust_x"))
-			x += component->get_float("adjust_x");
-		if (component->get("adjust_y"))
-			y += component->get_float("adjust_y");
+		const auto text{_ctx.get_text(component->string_key)};
+		const auto pos{_text_origin(component, place, text)};
 
 		UIStyle::set_faded(_ctx);
 		set_StyleColor(ImGuiCol_ButtonHovered, (ImVec4)col);
 		set_StyleColor(ImGuiCol_ButtonActive, (ImVec4)col);
-		ImGui::SetCursorPos(ImVec2{x, y});
+		ImGui::SetCursorPos(
+			ImVec2{pos.x + place.adjust.x, pos.y + place.adjust.y});
 		with_ID(name.c_str()) {
-			if (ImGui::Button(CSTR(_ctx.get_string(component->string_key)))) {
+			if (ImGui::Button(text.data())) {
 				if (is_clicked)
 					*is_clicked.value() = true;
 
@@ -2073,7 +1958,8 @@ auto Sorcery::UI::_draw_character_summary(Component *component,
 auto Sorcery::UI::_draw_create_alignment([[maybe_unused]] const int mode)
 	-> void {
 
-	auto cmp_summary{components->get("create_alignment:summary_text")};
+	auto cmp_summary{
+		components->get(COMPONENT("create_alignment:summary_text"))};
 	auto summary_text{
 		_ctx.controller->get_candidate_character()->summary_text()};
 	_draw_text(&cmp_summary, summary_text);
@@ -2082,12 +1968,12 @@ auto Sorcery::UI::_draw_create_alignment([[maybe_unused]] const int mode)
 auto Sorcery::UI::_draw_create_confirm([[maybe_unused]] const int mode)
 	-> void {
 
-	auto cmp_summary{components->get("create_confirm:summary_text")};
+	auto cmp_summary{components->get(COMPONENT("create_confirm:summary_text"))};
 	auto summary_text{
 		_ctx.controller->get_candidate_character()->summary_text()};
 	_draw_text(&cmp_summary, summary_text);
 
-	auto cmp_char{components->get("create_confirm:character_data")};
+	auto cmp_char{components->get(COMPONENT("create_confirm:character_data"))};
 	with_Window(WINDOW_LAYER_TEXTS, nullptr,
 				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
 		set_Font(fontstore->get_current_font(cmp_char.font).value(), font_sz());
@@ -2098,12 +1984,13 @@ auto Sorcery::UI::_draw_create_confirm([[maybe_unused]] const int mode)
 
 auto Sorcery::UI::_draw_create_class([[maybe_unused]] const int mode) -> void {
 
-	auto cmp_summary{components->get("create_class:summary_text")};
+	auto cmp_summary{components->get(COMPONENT("create_class:summary_text"))};
 	auto summary_text{
 		_ctx.controller->get_candidate_character()->summary_text()};
 	_draw_text(&cmp_summary, summary_text);
 
-	auto cmp_points_left{components->get("create_class:points_left_text")};
+	auto cmp_points_left{
+		components->get(COMPONENT("create_class:points_left_text"))};
 	const auto points_left_text{std::format(
 		"{:>2}",
 		_ctx.controller->get_candidate_character()->get_points_left())};
@@ -2111,7 +1998,8 @@ auto Sorcery::UI::_draw_create_class([[maybe_unused]] const int mode) -> void {
 
 	// Now draw the class buttons
 	using enum Enums::Character::Attribute;
-	auto cmp_attribute{components->get("create_class:current_stats")};
+	auto cmp_attribute{
+		components->get(COMPONENT("create_class:current_stats"))};
 	for (auto i = std::to_underlying(STRENGTH); i <= std::to_underlying(LUCK);
 		 ++i) {
 		auto attribute{_ctx.controller->get_candidate_character()->get_attr_ptr(
@@ -2124,7 +2012,7 @@ auto Sorcery::UI::_draw_create_class([[maybe_unused]] const int mode) -> void {
 
 auto Sorcery::UI::_draw_create_race([[maybe_unused]] const int mode) -> void {
 
-	auto cmp_summary{components->get("create_race:summary_text")};
+	auto cmp_summary{components->get(COMPONENT("create_race:summary_text"))};
 	auto summary_text{
 		_ctx.controller->get_candidate_character()->summary_text()};
 	_draw_text(&cmp_summary, summary_text);
@@ -2132,7 +2020,7 @@ auto Sorcery::UI::_draw_create_race([[maybe_unused]] const int mode) -> void {
 
 auto Sorcery::UI::_draw_create_name([[maybe_unused]] const int mode) -> void {
 
-	auto cmp_summary{components->get("create_name:summary_text")};
+	auto cmp_summary{components->get(COMPONENT("create_name:summary_text"))};
 	auto summary_text{
 		_ctx.controller->get_candidate_character()->summary_text()};
 	_draw_text(&cmp_summary, summary_text);
@@ -2143,13 +2031,13 @@ auto Sorcery::UI::_draw_create_name([[maybe_unused]] const int mode) -> void {
 		first_frame = false;
 	}
 
-	auto cmp_name{components->get("create_name:name_input")};
+	auto cmp_name{components->get(COMPONENT("create_name:name_input"))};
 	_draw_input(&cmp_name, &_ctx.controller->get_input_buffer());
 }
 
 auto Sorcery::UI::_draw_reclass() -> void {
 
-	auto cmp_summary{components->get("change_class:summary_text")};
+	auto cmp_summary{components->get(COMPONENT("change_class:summary_text"))};
 	auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::EDIT))};
 	auto summary_text{character.summary_text()};
@@ -2158,7 +2046,7 @@ auto Sorcery::UI::_draw_reclass() -> void {
 
 auto Sorcery::UI::_draw_rename() -> void {
 
-	auto cmp_summary{components->get("rename:summary_text")};
+	auto cmp_summary{components->get(COMPONENT("rename:summary_text"))};
 	auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::EDIT))};
 	auto summary_text{character.summary_text()};
@@ -2170,7 +2058,7 @@ auto Sorcery::UI::_draw_rename() -> void {
 		first_frame = false;
 	}
 
-	auto cmp_name{components->get("rename:rename_input")};
+	auto cmp_name{components->get(COMPONENT("rename:rename_input"))};
 	_draw_input(&cmp_name, &_ctx.controller->get_input_buffer());
 }
 
@@ -2213,7 +2101,7 @@ auto Sorcery::UI::_draw_choose(const int mode) -> void {
 
 	if (mode & CHOOSE_MODE_STAY) {
 
-		auto cmp{components->get("choose:choose_stay")};
+		auto cmp{components->get(COMPONENT("choose:choose_stay"))};
 		_draw_text(&cmp);
 		_draw_party_panel();
 	}
@@ -2227,16 +2115,16 @@ auto Sorcery::UI::_draw_level_up(const int mode) -> void {
 	if (mode & RECOVERY_BIRTHDAY) {
 
 		const auto birth_text{_ctx.get_string("REST_BIRTHDAY_YOU")};
-		auto cmp{components->get("levelup:levelup_birthday")};
+		auto cmp{components->get(COMPONENT("levelup:levelup_birthday"))};
 		_draw_text(&cmp, birth_text);
-		cmp = components->get("levelup:levelup_results");
+		cmp = components->get(COMPONENT("levelup:levelup_results"));
 		for (const auto &result : character.level_up_results) {
 			_draw_text(&cmp, result);
 			cmp.y += grid_delta(0, 1).y;
 		}
 	} else {
 
-		auto cmp{components->get("levelup:levelup_birthday")};
+		auto cmp{components->get(COMPONENT("levelup:levelup_birthday"))};
 		for (const auto &result : character.level_up_results) {
 			_draw_text(&cmp, result);
 			++cmp.y;
@@ -2244,8 +2132,9 @@ auto Sorcery::UI::_draw_level_up(const int mode) -> void {
 	}
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoTitleBar) {
-		auto leave{components->get("levelup:levelup_leave")};
-		_draw_button_click(&leave, _ctx.get_flag_ref("show_levelup"), true);
+		auto leave{components->get(COMPONENT("levelup:levelup_leave"))};
+		_draw_button_click(&leave, _ctx.get_flag_ref(CONTROL("show_levelup")),
+						   true);
 	}
 }
 
@@ -2258,7 +2147,7 @@ auto Sorcery::UI::_draw_pay_info() -> void {
 	const auto cost_text{std::format("{} {} {}",
 									 _ctx.get_string("PAY_COST_PREFIX"), cost,
 									 _ctx.get_string("PAY_COST_SUFFIX"))};
-	auto cmp{components->get("pay:pay_cost")};
+	auto cmp{components->get(COMPONENT("pay:pay_cost"))};
 	_draw_text(&cmp, cost_text);
 }
 
@@ -2274,29 +2163,30 @@ auto Sorcery::UI::_draw_no_level_up(const int mode) -> void {
 
 	if (mode & RECOVERY_BIRTHDAY) {
 
-		auto cmp{components->get("nolevelup:nolevelup_birthday")};
+		auto cmp{components->get(COMPONENT("nolevelup:nolevelup_birthday"))};
 		_draw_text(&cmp, birth_text);
-		cmp = components->get("nolevelup:nolevelup_need_1");
+		cmp = components->get(COMPONENT("nolevelup:nolevelup_need_1"));
 		_draw_text(&cmp, need_text);
-		cmp = components->get("nolevelup:nolevelup_need_2");
+		cmp = components->get(COMPONENT("nolevelup:nolevelup_need_2"));
 		_draw_text(&cmp, make_text);
 	} else {
 
-		auto cmp{components->get("nolevelup:nolevelup_birthday")};
+		auto cmp{components->get(COMPONENT("nolevelup:nolevelup_birthday"))};
 		_draw_text(&cmp, need_text);
-		cmp = components->get("nolevelup:nolevelup_need_1");
+		cmp = components->get(COMPONENT("nolevelup:nolevelup_need_1"));
 		_draw_text(&cmp, make_text);
 	}
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoTitleBar) {
-		auto leave{components->get("nolevelup:nolevelup_leave")};
-		_draw_button_click(&leave, _ctx.get_flag_ref("show_nolevelup"), true);
+		auto leave{components->get(COMPONENT("nolevelup:nolevelup_leave"))};
+		_draw_button_click(&leave, _ctx.get_flag_ref(CONTROL("show_nolevelup")),
+						   true);
 	}
 }
 
 auto Sorcery::UI::_draw_rite(const int stage) -> void {
 
-	auto cmp_summary{components->get("rite:summary_text")};
+	auto cmp_summary{components->get(COMPONENT("rite:summary_text"))};
 	auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::EDIT))};
 	auto summary_text{character.summary_text()};
@@ -2305,10 +2195,10 @@ auto Sorcery::UI::_draw_rite(const int stage) -> void {
 	if (stage == 0)
 		return;
 
-	auto cmp_progress{components->get("rite:progress_text")};
+	auto cmp_progress{components->get(COMPONENT("rite:progress_text"))};
 	auto progress_text{_ctx.get_string("RITE_PROGRESS")};
 
-	auto cmp{components->get("rite:rite_stage")};
+	auto cmp{components->get(COMPONENT("rite:rite_stage"))};
 
 	std::string text;
 
@@ -2346,7 +2236,7 @@ auto Sorcery::UI::_draw_rite(const int stage) -> void {
 
 auto Sorcery::UI::_draw_heal(int stage) -> void {
 
-	auto cmp{components->get("heal:heal_status")};
+	auto cmp{components->get(COMPONENT("heal:heal_status"))};
 	auto text{""s};
 
 	switch (stage) {
@@ -2373,16 +2263,17 @@ auto Sorcery::UI::_draw_heal(int stage) -> void {
 	if (!text.empty())
 		_draw_text(&cmp, text);
 
-	if (_ctx.controller->has_flag("heal_finished") &&
-		_ctx.controller->has_text("heal_results")) {
+	if (_ctx.controller->has_flag(CONTROL("heal_finished")) &&
+		_ctx.controller->has_text(CONTROL("heal_results"))) {
 
-		auto summary{components->get("heal:heal_results")};
-		const auto results{_ctx.controller->get_text("heal_results")};
+		auto summary{components->get(COMPONENT("heal:heal_results"))};
+		const auto results{_ctx.controller->get_text(CONTROL("heal_results"))};
 		_draw_text(&summary, results);
 		with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoTitleBar) {
 
-			auto leave{components->get("heal:button_heal_return")};
-			_draw_button_click(&leave, _ctx.get_flag_ref("heal_return"), true);
+			auto leave{components->get(COMPONENT("heal:button_heal_return"))};
+			_draw_button_click(&leave,
+							   _ctx.get_flag_ref(CONTROL("heal_return")), true);
 		}
 	}
 }
@@ -2393,31 +2284,32 @@ auto Sorcery::UI::_draw_recovery(const int mode) -> void {
 		_ctx.controller->get_character(Enums::CharacterSlot::STAY))};
 	if (mode == RECOVERY_MODE_FREE) {
 
-		auto cmp{components->get("recovery:recovery_napping")};
+		auto cmp{components->get(COMPONENT("recovery:recovery_napping"))};
 		auto text{std::format("{}{}", character.get_name(),
 							  _ctx.get_string("RECOVERY_NAPPING"))};
 		_draw_text(&cmp, text);
 
 	} else {
 
-		auto cmp{components->get("recovery:recovery_recuperating")};
+		auto cmp{components->get(COMPONENT("recovery:recovery_recuperating"))};
 		auto text{std::format("{} {}", character.get_name(),
 							  _ctx.get_string("REST_RECUPERATING"))};
 		_draw_text(&cmp, text);
 
-		cmp = components->get("recovery:recovery_recuperating_hp");
+		cmp = components->get(COMPONENT("recovery:recovery_recuperating_hp"));
 		text = std::format("{} ({:>5}/{:>5})", _ctx.get_string("REST_HP"),
 						   character.get_current_hp(), character.get_max_hp());
 		_draw_text(&cmp, text);
 
-		cmp = components->get("recovery:recovery_recuperating_gold");
+		cmp = components->get(COMPONENT("recovery:recovery_recuperating_gold"));
 		text = std::format("{} {:>7}", _ctx.get_string("REST_GOLD"),
 						   character.get_gold());
 		_draw_text(&cmp, text);
 
 		with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoTitleBar) {
-			auto stop{components->get("recovery:recovery_stop")};
-			_draw_button_click(&stop, _ctx.get_flag_ref("show_recovery"), true);
+			auto stop{components->get(COMPONENT("recovery:recovery_stop"))};
+			_draw_button_click(
+				&stop, _ctx.get_flag_ref(CONTROL("show_recovery")), true);
 		}
 	}
 }
@@ -2427,13 +2319,13 @@ auto Sorcery::UI::_draw_stay() -> void {
 	const auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::STAY))};
 
-	auto cmp_welcome{components->get("stay:stay_welcome")};
+	auto cmp_welcome{components->get(COMPONENT("stay:stay_welcome"))};
 	auto welcome_text{std::format("{}{}{}", _ctx.get_string("STAY_WELCOME_P"),
 								  character.get_name(),
 								  _ctx.get_string("STAY_WELCOME_S"))};
 	_draw_text(&cmp_welcome, welcome_text);
 
-	auto cmp_gold{components->get("stay:stay_gold")};
+	auto cmp_gold{components->get(COMPONENT("stay:stay_gold"))};
 	auto gold_text{std::format("{}{}{}", _ctx.get_string("STAY_GOLD_P"),
 							   character.get_gold(),
 							   _ctx.get_string("STAY_GOLD_S"))};
@@ -2445,13 +2337,13 @@ auto Sorcery::UI::_draw_buy() -> void {
 	const auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::STORE))};
 
-	auto cmp_welcome{components->get("buy:buy_welcome")};
+	auto cmp_welcome{components->get(COMPONENT("buy:buy_welcome"))};
 	auto welcome_text{std::format("{}{}{}", _ctx.get_string("BUY_WELCOME_P"),
 								  character.get_name(),
 								  _ctx.get_string("BUY_WELCOME_S"))};
 	_draw_text(&cmp_welcome, welcome_text);
 
-	auto cmp_gold{components->get("buy:buy_gold")};
+	auto cmp_gold{components->get(COMPONENT("buy:buy_gold"))};
 	auto gold_text{std::format("{}{}{}", _ctx.get_string("BUY_GOLD_P"),
 							   character.get_gold(),
 							   _ctx.get_string("BUY_GOLD_S"))};
@@ -2463,13 +2355,13 @@ auto Sorcery::UI::_draw_sell() -> void {
 	const auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::STORE))};
 
-	auto cmp_welcome{components->get("sell:sell_welcome")};
+	auto cmp_welcome{components->get(COMPONENT("sell:sell_welcome"))};
 	auto welcome_text{std::format("{}{}{}", _ctx.get_string("SELL_WELCOME_P"),
 								  character.get_name(),
 								  _ctx.get_string("SELL_WELCOME_S"))};
 	_draw_text(&cmp_welcome, welcome_text);
 
-	auto cmp_gold{components->get("sell:sell_gold")};
+	auto cmp_gold{components->get(COMPONENT("sell:sell_gold"))};
 	auto gold_text{std::format("{}{}{}", _ctx.get_string("SELL_GOLD_P"),
 							   character.get_gold(),
 							   _ctx.get_string("SELL_GOLD_S"))};
@@ -2484,13 +2376,13 @@ auto Sorcery::UI::_draw_identify() -> void {
 	const auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::STORE))};
 
-	auto cmp_welcome{components->get("identify:identify_welcome")};
+	auto cmp_welcome{components->get(COMPONENT("identify:identify_welcome"))};
 	auto welcome_text{std::format(
 		"{}{}{}", _ctx.get_string("IDENTIFY_WELCOME_P"), character.get_name(),
 		_ctx.get_string("IDENTIFY_WELCOME_S"))};
 	_draw_text(&cmp_welcome, welcome_text);
 
-	auto cmp_gold{components->get("identify:identify_gold")};
+	auto cmp_gold{components->get(COMPONENT("identify:identify_gold"))};
 	auto gold_text{std::format("{}{}{}", _ctx.get_string("IDENTIFY_GOLD_P"),
 							   character.get_gold(),
 							   _ctx.get_string("IDENTIFY_GOLD_S"))};
@@ -2505,13 +2397,13 @@ auto Sorcery::UI::_draw_uncurse() -> void {
 	const auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::STORE))};
 
-	auto cmp_welcome{components->get("uncurse:uncurse_welcome")};
+	auto cmp_welcome{components->get(COMPONENT("uncurse:uncurse_welcome"))};
 	auto welcome_text{std::format(
 		"{}{}{}", _ctx.get_string("UNCURSE_WELCOME_P"), character.get_name(),
 		_ctx.get_string("UNCURSE_WELCOME_S"))};
 	_draw_text(&cmp_welcome, welcome_text);
 
-	auto cmp_gold{components->get("uncurse:uncurse_gold")};
+	auto cmp_gold{components->get(COMPONENT("uncurse:uncurse_gold"))};
 	auto gold_text{std::format("{}{}{}", _ctx.get_string("UNCURSE_GOLD_P"),
 							   character.get_gold(),
 							   _ctx.get_string("UNCURSE_GOLD_S"))};
@@ -2526,13 +2418,13 @@ auto Sorcery::UI::_draw_store() -> void {
 	const auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::STORE))};
 
-	auto cmp_welcome{components->get("store:store_welcome")};
+	auto cmp_welcome{components->get(COMPONENT("store:store_welcome"))};
 	auto welcome_text{std::format("{}{}{}", _ctx.get_string("STORE_WELCOME_P"),
 								  character.get_name(),
 								  _ctx.get_string("STORE_WELCOME_S"))};
 	_draw_text(&cmp_welcome, welcome_text);
 
-	auto cmp_gold{components->get("store:store_gold")};
+	auto cmp_gold{components->get(COMPONENT("store:store_gold"))};
 	auto gold_text{std::format("{}{}{}", _ctx.get_string("STORE_GOLD_P"),
 							   character.get_gold(),
 							   _ctx.get_string("STORE_GOLD_S"))};
@@ -2545,17 +2437,18 @@ auto Sorcery::UI::_draw_current_character([[maybe_unused]] const int mode)
 	auto character{_ctx.game->characters.at(
 		_ctx.controller->get_character(Enums::CharacterSlot::INSPECT))};
 
-	auto title{components->get("inspect:character_title")};
+	auto title{components->get(COMPONENT("inspect:character_title"))};
 	_draw_text(&title, character.summary_text());
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoTitleBar) {
-		auto prev{components->get("inspect:character_previous")};
-		_draw_button_click(&prev,
-						   _ctx.get_flag_ref("select_previous_character"));
-		auto next{components->get("inspect:character_next")};
-		_draw_button_click(&next, _ctx.get_flag_ref("select_next_character"));
-
-		auto cmp{components->get("inspect:character_data")};
+		auto prev{components->get(COMPONENT("inspect:character_previous"))};
+		_draw_button_click(
+			&prev, _ctx.get_flag_ref(CONTROL("select_previous_character")));
+		auto next{components->get(COMPONENT("inspect:character_next"))};
+		_draw_button_click(
+			&next, _ctx.get_flag_ref(CONTROL("select_next_character")));
+
+		auto cmp{components->get(COMPONENT("inspect:character_data"))};
 		auto pos{grid_pos(cmp.x, cmp.y)};
 
 		ImGuiTabBarFlags tb_flags{ImGuiTabBarFlags_None};
@@ -2563,7 +2456,8 @@ auto Sorcery::UI::_draw_current_character([[maybe_unused]] const int mode)
 		with_Child("character_tab_bar_child",
 				   ImVec2(grid_sz() * cmp.w, grid_sz() * cmp.h)) {
 			UIStyle::set_tab_black(_ctx);
-			auto char_cmp{components->get("inspect:character_tab_data")};
+			auto char_cmp{
+				components->get(COMPONENT("inspect:character_tab_data"))};
 			set_Font(fontstore->get_current_font(cmp.font).value(), font_sz());
 			with_TabBar("character_tab_bar", tb_flags) {
 				with_TabItem("Info") {
@@ -2708,58 +2602,47 @@ auto Sorcery::UI::_draw_input(Component *component, std::string *input)
 	}
 }
 
-auto Sorcery::UI::_draw_text(Component *component, const std::string &string)
-	-> void {
+auto Sorcery::UI::_draw_text(const Component *component,
+							 const std::string &string) -> void {
 
 	with_Window(WINDOW_LAYER_TEXTS, nullptr,
 				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
 
 		// Need to push font first before calculating size else it will
-		// assume monospace font size!
+		// assume monospace font size! (the text here can change from frame to
+		// frame, so if it is centred it has to be measured every time)
+		const auto place{placement(component)};
 		set_Font(fontstore->get_current_font(component->font).value(),
-				 font_sz());
-
-		const auto x{std::invoke([&] {
-			if (component->x == -1) {
-				const auto viewport{ImGui::GetMainViewport()};
-				const auto width{ImGui::CalcTextSize(CSTR(string))};
-				return (viewport->Size.x - width.x) / 2;
-			} else
-				return grid_pos(component->x, component->y).x;
-		})};
-		const auto y{std::invoke([&] {
-			if (component->y == -1) {
-				const auto viewport{ImGui::GetMainViewport()};
-				const auto height{ImGui::CalcTextSize(CSTR(string))};
-				return (viewport->Size.y - height.y) / 2;
-			} else
-				return grid_pos(component->x, component->y).y;
-		})};
+				 place.font_sz);
+		const auto content{place.centre_x || place.centre_y
+							   ? ImGui::CalcTextSize(CSTR(string))
+							   : ImVec2{0.0f, 0.0f}};
 
 		// Adjust Alpha of Text
 		ImVec4 alpha_col{ImGui::ColorConvertU32ToFloat4(component->colour)};
 		alpha_col.w = _ctx.animation->fade;
 
 		set_StyleColor(ImGuiCol_Text, alpha_col);
-		ImGui::SetCursorPos(ImVec2{x, y});
+		ImGui::SetCursorPos(layout_origin(place, content));
 		ImGui::TextUnformatted(string.c_str());
 	}
 }
 
 auto Sorcery::UI::_draw_party_wipe() -> void {
 
-	const auto grave_cmp{components->get("graveyard:gravestone")};
-	const auto text_cmp{components->get("graveyard:party_members")};
+	const auto grave_cmp{components->get(COMPONENT("graveyard:gravestone"))};
+	const auto text_cmp{components->get(COMPONENT("graveyard:party_members"))};
 
 	constexpr auto max_cols{3};
 
 	const auto grave_idx{GRAVESTONE_GFX_ID};
 	const auto scale{_ctx.display->get_display_metrics().scale};
-	const auto grave_w{grave_cmp.get_float("tile_width") * scale};
-	const auto grave_h{grave_cmp.get_float("tile_height") * scale};
+	const auto grave_w{grave_cmp.get_float(PROPERTY("tile_width")) * scale};
+	const auto grave_h{grave_cmp.get_float(PROPERTY("tile_height")) * scale};
 
-	const auto gap{grid_delta(grave_cmp.get_float("spacing_x") * scale,
-							  grave_cmp.get_float("spacing_y") * scale)};
+	const auto gap{
+		grid_delta(grave_cmp.get_float(PROPERTY("spacing_x")) * scale,
+				   grave_cmp.get_float(PROPERTY("spacing_y")) * scale)};
 
 	std::vector<std::string> names;
 
@@ -2857,8 +2740,8 @@ auto Sorcery::UI::_draw_automap_legend(Component *component) -> void {
 	};
 
 	const auto scale{_ctx.display->get_display_metrics().scale};
-	const auto icon_size{component->get_int("tile_size") * scale};
-	const auto row_gap{component->get_int("row_gap") * scale};
+	const auto icon_size{component->get_int(PROPERTY("tile_size")) * scale};
+	const auto row_gap{component->get_int(PROPERTY("row_gap")) * scale};
 
 	auto pos{grid_pos(component->x, component->y)};
 
@@ -2867,7 +2750,7 @@ auto Sorcery::UI::_draw_automap_legend(Component *component) -> void {
 		set_Font(fontstore->get_current_font(component->font).value(),
 				 font_sz());
 
-		auto cmp_level{components->get("automap:automap_level")};
+		auto cmp_level{components->get(COMPONENT("automap:automap_level"))};
 		_draw_text(&cmp_level, _ctx.game->state->level->name());
 
 		for (const auto &item : legend) {
@@ -2886,47 +2769,31 @@ auto Sorcery::UI::_draw_automap_legend(Component *component) -> void {
 	}
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoTitleBar) {
-		auto leave{components->get("automap:automap_return")};
-		_draw_button_click(&leave, _ctx.get_flag_ref("show_automap"), true);
+		auto leave{components->get(COMPONENT("automap:automap_return"))};
+		_draw_button_click(&leave, _ctx.get_flag_ref(CONTROL("show_automap")),
+						   true);
 	}
 }
 
 // Draw a Text (String)
-auto Sorcery::UI::_draw_text(Component *component) -> void {
+auto Sorcery::UI::_draw_text(const Component *component) -> void {
 	with_Window(WINDOW_LAYER_TEXTS, nullptr,
 				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
 
 		// Need to push font first before calculating size else it will
 		// assume monospace font size!
+		auto place{placement(component)};
 		set_Font(fontstore->get_current_font(component->font).value(),
-				 font_sz());
-
-		const auto x{std::invoke([&] {
-			if (component->x == -1) {
-				const auto viewport{ImGui::GetMainViewport()};
-				const auto width{ImGui::CalcTextSize(
-					CSTR(_ctx.get_string(component->string_key)))};
-				return (viewport->Size.x - width.x) / 2;
-			} else
-				return grid_pos(component->x, component->y).x;
-		})};
-		const auto y{std::invoke([&] {
-			if (component->y == -1) {
-				const auto viewport{ImGui::GetMainViewport()};
-				const auto height{ImGui::CalcTextSize(
-					CSTR(_ctx.get_string(component->string_key)))};
-				return (viewport->Size.y - height.y) / 2;
-			} else
-				return grid_pos(component->x, component->y).y;
-		})};
+				 place.font_sz);
+		const auto text{_ctx.get_text(component->string_key)};
 
 		// Adjust Alpha of Text
 		ImVec4 alpha_col{ImGui::ColorConvertU32ToFloat4(component->colour)};
 		alpha_col.w = _ctx.animation->fade;
 
 		set_StyleColor(ImGuiCol_Text, alpha_col);
-		ImGui::SetCursorPos(ImVec2{x, y});
-		ImGui::TextUnformatted(_ctx.get_string(component->string_key).c_str());
+		ImGui::SetCursorPos(_text_origin(component, place, text));
+		ImGui::TextUnformatted(text.data(), text.data() + text.size());
 	}
 }
 
@@ -2936,8 +2803,9 @@ auto Sorcery::UI::_draw_components(std::string_view screen,
 	_frames.clear();
 	_menus.clear();
 
-	// Draw every component specified in order
-	for (auto cmps{(*components)(screen)}; auto c : cmps.value()) {
+	// Draw every component specified in order (straight from the store, as
+	// the list for each screen is already built and sorted at load)
+	for (const auto &c : (*components)(screen)) {
 		using enum Enums::Layout::ComponentType;
 		if (c.type == IMAGE_BG)
 			_draw_tiled_bg(&c);
@@ -2970,19 +2838,19 @@ auto Sorcery::UI::_display_splash() -> void {
 
 auto Sorcery::UI::_draw_item_info() -> void {
 	// Custom Rendering
-	const auto idx{_ctx.get_selected("museum_selected")};
+	const auto idx{_ctx.get_selected(CONTROL("museum_selected"))};
 	if (idx >= 100)
 		return;
 
-	const auto item{_ctx.resources->items->get(idx + 1)};
-	auto item_c{components->get("museum:item_graphic")};
+	const auto &item{_ctx.resources->items->get(idx + 1)};
+	auto item_c{components->get(COMPONENT("museum:item_graphic"))};
 	auto item_pos{grid_pos(item_c.x, item_c.y)};
 	const auto scale{_ctx.display->get_display_metrics().scale};
+	const auto item_w{item_c.get_float(PROPERTY("tile_width")) * scale};
 	_draw_fg_image_with_idx(ITEMS_TEXTURE, idx, item_pos,
-							ImVec2{item_c.get_float("tile_width") * scale,
-								   item_c.get_float("tile_width") * scale});
+							ImVec2{item_w, item_w});
 
-	auto cmp{components->get("museum:item_data")};
+	auto cmp{components->get(COMPONENT("museum:item_data"))};
 	auto pos{grid_pos(cmp.x, cmp.y)};
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoDecoration) {
@@ -3097,7 +2965,8 @@ auto Sorcery::UI::_draw_license(Component *component, const std::string &string)
 
 		// To adjust for Window Resizing etc
 		const auto x{std::invoke([&] {
-			const auto width{grid_sz() * component->get_float("grid_width")};
+			const auto width{grid_sz() *
+							 component->get_float(PROPERTY("grid_width"))};
 			const auto viewport{ImGui::GetMainViewport()};
 			return (viewport->Size.x - width) / 2;
 		})};
@@ -3118,8 +2987,9 @@ auto Sorcery::UI::_draw_license(Component *component, const std::string &string)
 		}
 
 		// Special Handling for Return Button
-		Component cmp{components->get("license:license_return")};
-		_draw_button_click(&cmp, _ctx.get_flag_ref("show_license"), true);
+		Component cmp{components->get(COMPONENT("license:license_return"))};
+		_draw_button_click(&cmp, _ctx.get_flag_ref(CONTROL("show_license")),
+						   true);
 	}
 }
 
@@ -3390,7 +3260,7 @@ auto Sorcery::UI::load_message(const Enums::Map::Event event)
 }
 
 auto Sorcery::UI::_draw_options() -> void {
-	const auto component{components->get("options:options_info")};
+	const auto component{components->get(COMPONENT("options:options_info"))};
 
 	std::vector<std::string> summary_opts{"OPT_RECOMMENDED_MODE",
 										  "OPT_STRICT_MODE", "OPT_CHEAT_MODE",
@@ -3416,7 +3286,8 @@ auto Sorcery::UI::_draw_options() -> void {
 
 		// To adjust for Window Resizing etc
 		const auto x{std::invoke([&] {
-			const auto width{grid_sz() * component.get_float("grid_width")};
+			const auto width{grid_sz() *
+							 component.get_float(PROPERTY("grid_width"))};
 			const auto viewport{ImGui::GetMainViewport()};
 			return (viewport->Size.x - width) / 2;
 		})};
@@ -3524,6 +3395,7 @@ auto Sorcery::UI::_draw_options() -> void {
 												  is_selected)) {
 								fontstore->set_current_font(
 									Enums::Layout::Font::MONOSPACE, font.name);
+								_layout_cache.forget_content();
 							}
 							++font_idx;
 						}
@@ -3548,7 +3420,7 @@ auto Sorcery::UI::_draw_options() -> void {
 
 			// Save and Cancel Buttons
 			const auto centre{(tabs_width / 2)};
-			const auto button_y{std::stoi(component.get("button_y").value())};
+			const auto button_y{component.get_int(PROPERTY("button_y"))};
 			ImVec2 btn_size{ImGui::GetFontSize() * 7.0f, 0.0f};
 
 			UIStyle::set_faded(_ctx);
@@ -3560,30 +3432,30 @@ auto Sorcery::UI::_draw_options() -> void {
 			if (ImGui::Button(save_lbl.c_str(), btn_size)) {
 				_ctx.system->config->save();
 
-				if (_ctx.get_flag("in_engine"))
+				if (_ctx.get_flag(CONTROL("in_engine")))
 					_ctx.controller->go_to(Enums::Screen::ENGINE);
 				else
 					_ctx.controller->go_to(Enums::Screen::MAINMENU);
 
-				//_ctx.controller->unset_flag("show_options");
+				//_ctx.controller->unset_flag(CONTROL("show_options"));
 			}
 			ImGui::SetCursorPos(
 				ImVec2{centre + grid_sz(), button_y * grid_sz()});
 			if (ImGui::Button(cancel_lbl.c_str(), btn_size)) {
 				_ctx.system->config->load();
 
-				if (_ctx.get_flag("in_engine"))
+				if (_ctx.get_flag(CONTROL("in_engine")))
 					_ctx.controller->go_to(Enums::Screen::ENGINE);
 				else
 					_ctx.controller->go_to(Enums::Screen::MAINMENU);
-				//_ctx.controller->unset_flag("show_options");
+				//_ctx.controller->unset_flag(CONTROL("show_options"));
 			}
 		}
 	}
 }
 auto Sorcery::UI::_draw_buffbar() -> void {
-	auto cmp{components->get("engine_base_ui:buffbar")};
-	auto frame_cmp{components->get("engine_base_ui:buffbar_frame")};
+	auto cmp{components->get(COMPONENT("engine_base_ui:buffbar"))};
+	auto frame_cmp{components->get(COMPONENT("engine_base_ui:buffbar_frame"))};
 
 	const auto x{grid_x(cmp.x)};
 	auto y{grid_y(cmp.y)};
@@ -3612,8 +3484,8 @@ auto Sorcery::UI::_draw_buffbar() -> void {
 
 auto Sorcery::UI::_draw_icons() -> void {
 
-	auto cmp{components->get("engine_base_ui:icons")};
-	auto frame_cmp{components->get("engine_base_ui:icons_frame")};
+	auto cmp{components->get(COMPONENT("engine_base_ui:icons"))};
+	auto frame_cmp{components->get(COMPONENT("engine_base_ui:icons_frame"))};
 
 	constexpr std::array icons{
 		ICON_CAMP, ICON_PARTY, ICON_MAP, ICON_LOOK, ICON_CAST, ICON_USE,
@@ -3635,6 +3507,13 @@ auto Sorcery::UI::_draw_icons() -> void {
 
 	const auto hovered_tint{ImVec4{get_hl_colour(_ctx.animation->lerp)}};
 
+	// Whilst a save is still being written the icon pulses, and if writing
+	// one failed it stays red until a later save succeeds
+	const auto status{_ctx.writer->status()};
+	const auto saving{status == SaveStatus::PENDING ||
+					  status == SaveStatus::WRITING};
+	const auto failed_tint{ImVec4{1.0f, 0.33f, 0.33f, _ctx.animation->fade}};
+
 	// Passive frame.
 	with_Window(WINDOW_LAYER_TEXTS, nullptr,
 				ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs) {
@@ -3674,8 +3553,8 @@ auto Sorcery::UI::_draw_icons() -> void {
 
 auto Sorcery::UI::_draw_save() -> void {
 
-	auto cmp{components->get("engine_base_ui:save")};
-	auto frame_cmp{components->get("engine_base_ui:save_frame")};
+	auto cmp{components->get(COMPONENT("engine_base_ui:save"))};
+	auto frame_cmp{components->get(COMPONENT("engine_base_ui:save_frame"))};
 
 	const auto x{grid_x(cmp.x)};
 	const auto y{grid_y(cmp.y)};
@@ -3710,7 +3589,9 @@ auto Sorcery::UI::_draw_save() -> void {
 			ImGui::InvisibleButton("##save_and_quit", save_size)};
 
 		const auto hovered{ImGui::IsItemHovered()};
-		const auto tint{hovered ? hovered_tint : normal_tint};
+		const auto tint{hovered || saving			 ? hovered_tint
+						: status == SaveStatus::FAILED ? failed_tint
+													   : normal_tint};
 
 		_draw_fg_image_with_idx(WINDOW_LAYER_MENUS, ICONS_TEXTURE,
 								ICON_SAVE_AND_QUIT, save_pos, save_size, tint);
@@ -3722,8 +3603,8 @@ auto Sorcery::UI::_draw_save() -> void {
 
 auto Sorcery::UI::_draw_compass() -> void {
 
-	auto cmp{components->get("engine_base_ui:compass")};
-	auto frame_cmp{components->get("engine_base_ui:compass_frame")};
+	auto cmp{components->get(COMPONENT("engine_base_ui:compass"))};
+	auto frame_cmp{components->get(COMPONENT("engine_base_ui:compass_frame"))};
 
 	auto tint{_ctx.controller->get_monochrome()
 				  ? ImVec4{1.0f, 1.0f, 1.0f, _ctx.animation->fade}
@@ -3768,8 +3649,8 @@ auto Sorcery::UI::_draw_compass() -> void {
 
 auto Sorcery::UI::_draw_party_panel() -> void {
 
-	auto cmp{components->get("global:party_panel")};
-	auto frame_cmp{components->get("engine_base_ui:party_frame")};
+	auto cmp{components->get(COMPONENT("global:party_panel"))};
+	auto frame_cmp{components->get(COMPONENT("engine_base_ui:party_frame"))};
 
 	const auto width{static_cast<float>(cmp.w * grid_sz())};
 	const auto height{static_cast<float>(cmp.h * grid_sz())};
@@ -3805,7 +3686,7 @@ auto Sorcery::UI::_draw_party_panel() -> void {
 			UIStyle::set_text_bright(_ctx);
 
 			ImGui::TextUnformatted(
-				_ctx.get_string("PARTY_PANEL_LEGEND").c_str());
+				_ctx.get_text(StringID::PARTY_PANEL_LEGEND).data());
 
 			if (!_ctx.game->state->party_has_members())
 				return;
@@ -3914,18 +3795,18 @@ auto Sorcery::UI::_get_status_color(Character *character) const -> ImVec4 {
 
 auto Sorcery::UI::_draw_spell_info() -> void {
 
-	const auto idx{_ctx.get_selected("spellbook_selected")};
+	const auto idx{_ctx.get_selected(CONTROL("spellbook_selected"))};
 	if (idx == 50)
 		return;
 
-	auto cmp{components->get("spellbook:spell_data")};
+	auto cmp{components->get(COMPONENT("spellbook:spell_data"))};
 	auto pos{grid_pos(cmp.x, cmp.y)};
 	ImGui::SetNextWindowPos(pos);
 	with_Window(WINDOW_LAYER_TEXTS, nullptr, ImGuiWindowFlags_NoDecoration) {
 		with_Child("spell_child",
 				   ImVec2(grid_sz() * cmp.w, grid_sz() * cmp.h)) {
 
-			auto spell{_ctx.resources->spells->get(
+			const auto &spell{_ctx.resources->spells->get(
 				enum_cast<Enums::Magic::SpellID>(idx).value())};
 
 			const auto spell_name{
@@ -3963,23 +3844,23 @@ auto Sorcery::UI::_draw_spell_info() -> void {
 
 auto Sorcery::UI::_draw_monster_info() -> void {
 	// Custom Rendering
-	const auto idx{_ctx.get_selected("bestiary_selected")};
-	const auto mon{_ctx.resources->monsters->get(idx)};
+	const auto idx{_ctx.get_selected(CONTROL("bestiary_selected"))};
+	const auto &mon{_ctx.resources->monsters->get(idx)};
 	const auto k_gfx{mon.get_known_gfx()};
 	const auto u_gfx{mon.get_unknown_gfx()};
-	auto k_mg_c{components->get("bestiary:known_monster_graphic")};
-	auto u_mg_c{components->get("bestiary:unknown_monster_graphic")};
+	auto k_mg_c{components->get(COMPONENT("bestiary:known_monster_graphic"))};
+	auto u_mg_c{components->get(COMPONENT("bestiary:unknown_monster_graphic"))};
 	auto k_mg_pos{grid_pos(k_mg_c.x, k_mg_c.y)};
 	auto u_mg_pos{grid_pos(u_mg_c.x, u_mg_c.y)};
 	const auto scale{_ctx.display->get_display_metrics().scale};
+	const auto k_mg_w{k_mg_c.get_float(PROPERTY("tile_width")) * scale};
+	const auto u_mg_w{u_mg_c.get_float(PROPERTY("tile_width")) * scale};
 	_draw_fg_image_with_idx(KNOWN_CREATURES_TEXTURE, k_gfx, k_mg_pos,
-							ImVec2{k_mg_c.get_float("tile_width") * scale,
-								   k_mg_c.get_float("tile_width") * scale});
+							ImVec2{k_mg_w, k_mg_w});
 	_draw_fg_image_with_idx(UNKNOWN_CREATURES_TEXTURE, u_gfx, u_mg_pos,
-							ImVec2{u_mg_c.get_float("tile_width") * scale,
-								   u_mg_c.get_float("tile_width") * scale});
+							ImVec2{u_mg_w, u_mg_w});
 
-	auto cmp{components->get("bestiary:monster_data")};
+	auto cmp{components->get(COMPONENT("bestiary:monster_data"))};
 	auto pos{grid_pos(cmp.x, cmp.y)};
 
 	with_Window(WINDOW_LAYER_MENUS, nullptr, ImGuiWindowFlags_NoDecoration) {
@@ -4014,8 +3895,9 @@ auto Sorcery::UI::_draw_monster_info() -> void {
 						type = std::format(" Type:{}", mon_t);
 					const auto level{std::format("Level:{}", mon.get_level())};
 					const auto xp{std::format("   XP:{}", mon.get_xp())};
-					const auto group{
-						std::format("Group:{}", mon.get_group_size().str())};
+					const auto group{std::format(
+						"Group:{} (avg {:.1f})", mon.get_group_size().str(),
+						mon.get_group_size().mean())};
 					ImGui::TextUnformatted(type.c_str());
 					ImGui::TextUnformatted(level.c_str());
 					ImGui::TextUnformatted(xp.c_str());
@@ -4036,10 +3918,19 @@ auto Sorcery::UI::_draw_monster_info() -> void {
 						std::format("   Ac:{}", mon.get_armour_class())};
 					const auto sr{
 						std::format("   SR:{}%", mon.get_spell_resistance())};
-					const auto hd{
-						std::format("   HD:{}", mon.get_hit_dice().str())};
+					const auto hd{std::format("   HD:{} (avg {:.1f})",
+											  mon.get_hit_dice().str(),
+											  mon.get_hit_dice().mean())};
+
+					// Exact damage a round, if every attack hits
+					const auto attacks{mon.get_attacks()};
+					const DiceOdds odds{attacks};
+					const auto dmg{std::format("  Dmg:{}-{} (avg {:.1f})",
+											   odds.min(), odds.max(),
+											   odds.mean())};
 
 					ImGui::TextUnformatted(atks.c_str());
+					ImGui::TextUnformatted(dmg.c_str());
 					ImGui::TextUnformatted(ac.c_str());
 					ImGui::TextUnformatted(hd.c_str());
 					ImGui::TextUnformatted(sr.c_str());
@@ -4133,14 +4024,15 @@ auto Sorcery::UI::_display_edit() -> void {
 auto Sorcery::UI::_display_reclass() -> void {
 	_draw_components("change_class");
 	_draw_reclass();
-	notice_reclassed_ok->display(_ctx.get_flag_ref("want_reclassed_ok"));
+	notice_reclassed_ok->display(
+		_ctx.get_flag_ref(CONTROL("want_reclassed_ok")));
 	_draw_cursor();
 }
 
 auto Sorcery::UI::_display_rename() -> void {
 	_draw_components("rename");
 	_draw_rename();
-	notice_renamed_ok->display(_ctx.get_flag_ref("want_renamed_ok"));
+	notice_renamed_ok->display(_ctx.get_flag_ref(CONTROL("want_renamed_ok")));
 	_draw_cursor();
 }
 
@@ -4162,7 +4054,7 @@ auto Sorcery::UI::_display_retrain() -> void {
 auto Sorcery::UI::_display_delete() -> void {
 	_draw_components("delete");
 	if (dialog_delete->show)
-		dialog_delete->display(_ctx.get_flag_ref("want_delete_ok"));
+		dialog_delete->display(_ctx.get_flag_ref(CONTROL("want_delete_ok")));
 	_draw_cursor();
 }
 
@@ -4189,25 +4081,25 @@ auto Sorcery::UI::_display_inspect(const int mode) -> void {
 		_draw_components("inspect_actions", mode);
 	_draw_current_character(mode);
 	if (modal_identify->show)
-		modal_identify->display(_ctx.get_flag_ref("want_identify"));
+		modal_identify->display(_ctx.get_flag_ref(CONTROL("want_identify")));
 	if (modal_equip->show)
-		modal_equip->display(_ctx.get_flag_ref("want_equip"));
+		modal_equip->display(_ctx.get_flag_ref(CONTROL("want_equip")));
 	if (modal_remove->show)
-		modal_remove->display(_ctx.get_flag_ref("want_remove"));
+		modal_remove->display(_ctx.get_flag_ref(CONTROL("want_remove")));
 	if (modal_spell->show)
-		modal_spell->display(_ctx.get_flag_ref("want_spell"));
+		modal_spell->display(_ctx.get_flag_ref(CONTROL("want_spell")));
 	if (modal_drop->show)
-		modal_drop->display(_ctx.get_flag_ref("want_drop"));
+		modal_drop->display(_ctx.get_flag_ref(CONTROL("want_drop")));
 	if (modal_trade->show)
-		modal_trade->display(_ctx.get_flag_ref("want_trade"));
+		modal_trade->display(_ctx.get_flag_ref(CONTROL("want_trade")));
 	if (modal_give->show)
-		modal_give->display(_ctx.get_flag_ref("want_give"));
+		modal_give->display(_ctx.get_flag_ref(CONTROL("want_give")));
 	if (modal_use->show)
-		modal_use->display(_ctx.get_flag_ref("want_use"));
+		modal_use->display(_ctx.get_flag_ref(CONTROL("want_use")));
 	if (modal_invoke->show)
-		modal_invoke->display(_ctx.get_flag_ref("want_invoke"));
+		modal_invoke->display(_ctx.get_flag_ref(CONTROL("want_invoke")));
 	if (notice_pool_gold->show)
-		notice_pool_gold->display(_ctx.get_flag_ref("want_pool_gold"));
+		notice_pool_gold->display(_ctx.get_flag_ref(CONTROL("want_pool_gold")));
 	_draw_debug();
 	_draw_cursor();
 }
@@ -4232,7 +4124,7 @@ auto Sorcery::UI::_display_automap() -> void {
 	_draw_components("automap");
 	_draw_current_level_map();
 
-	auto legend{components->get("automap:automap_legend")};
+	auto legend{components->get(COMPONENT("automap:automap_legend"))};
 	_draw_automap_legend(&legend);
 
 	_draw_cursor();
@@ -4257,17 +4149,17 @@ auto Sorcery::UI::_display_museum() -> void {
 auto Sorcery::UI::_display_inn() -> void {
 	_draw_components("inn");
 	_draw_party_panel();
-	modal_inspect->display(_ctx.get_flag_ref("want_inspect"));
-	modal_equip->display(_ctx.get_flag_ref("want_equip"));
-	modal_remove->display(_ctx.get_flag_ref("want_remove"));
-	modal_spell->display(_ctx.get_flag_ref("want_spell"));
-	modal_identify->display(_ctx.get_flag_ref("want_identify"));
-	modal_drop->display(_ctx.get_flag_ref("want_drop"));
-	modal_give->display(_ctx.get_flag_ref("want_give"));
-	modal_trade->display(_ctx.get_flag_ref("want_trade"));
-	modal_use->display(_ctx.get_flag_ref("want_use"));
-	modal_invoke->display(_ctx.get_flag_ref("want_invoke"));
-	notice_pool_gold->display(_ctx.get_flag_ref("want_pool_gold"));
+	modal_inspect->display(_ctx.get_flag_ref(CONTROL("want_inspect")));
+	modal_equip->display(_ctx.get_flag_ref(CONTROL("want_equip")));
+	modal_remove->display(_ctx.get_flag_ref(CONTROL("want_remove")));
+	modal_spell->display(_ctx.get_flag_ref(CONTROL("want_spell")));
+	modal_identify->display(_ctx.get_flag_ref(CONTROL("want_identify")));
+	modal_drop->display(_ctx.get_flag_ref(CONTROL("want_drop")));
+	modal_give->display(_ctx.get_flag_ref(CONTROL("want_give")));
+	modal_trade->display(_ctx.get_flag_ref(CONTROL("want_trade")));
+	modal_use->display(_ctx.get_flag_ref(CONTROL("want_use")));
+	modal_invoke->display(_ctx.get_flag_ref(CONTROL("want_invoke")));
+	notice_pool_gold->display(_ctx.get_flag_ref(CONTROL("want_pool_gold")));
 	_draw_debug();
 	_draw_cursor();
 }
@@ -4323,7 +4215,7 @@ auto Sorcery::UI::_display_store() -> void {
 	_draw_components("store");
 	_draw_store();
 	_draw_party_panel();
-	notice_pool_gold->display(_ctx.get_flag_ref("want_pool_gold"));
+	notice_pool_gold->display(_ctx.get_flag_ref(CONTROL("want_pool_gold")));
 	_draw_debug();
 	_draw_cursor();
 }
@@ -4347,7 +4239,7 @@ auto Sorcery::UI::_display_heal(int stage) -> void {
 auto Sorcery::UI::_display_rite(int stage) -> void {
 	_draw_components("rite");
 	if (dialog_rite->show)
-		dialog_rite->display(_ctx.get_flag_ref("want_rite_ok"));
+		dialog_rite->display(_ctx.get_flag_ref(CONTROL("want_rite_ok")));
 	_draw_rite(stage);
 	_draw_cursor();
 }
@@ -4372,18 +4264,18 @@ auto Sorcery::UI::_display_level_up(const int mode) -> void {
 auto Sorcery::UI::_display_tavern() -> void {
 
 	_draw_components("tavern");
-	notice_divvy->display(_ctx.get_flag_ref("want_divvy_gold"));
-	notice_pool_gold->display(_ctx.get_flag_ref("want_pool_gold"));
-	modal_inspect->display(_ctx.get_flag_ref("want_inspect"));
-	modal_equip->display(_ctx.get_flag_ref("want_equip"));
-	modal_remove->display(_ctx.get_flag_ref("want_remove"));
-	modal_spell->display(_ctx.get_flag_ref("want_spell"));
-	modal_identify->display(_ctx.get_flag_ref("want_identify"));
-	modal_drop->display(_ctx.get_flag_ref("want_drop"));
-	modal_use->display(_ctx.get_flag_ref("want_use"));
-	modal_give->display(_ctx.get_flag_ref("want_give"));
-	modal_trade->display(_ctx.get_flag_ref("want_trade"));
-	modal_invoke->display(_ctx.get_flag_ref("want_invoke"));
+	notice_divvy->display(_ctx.get_flag_ref(CONTROL("want_divvy_gold")));
+	notice_pool_gold->display(_ctx.get_flag_ref(CONTROL("want_pool_gold")));
+	modal_inspect->display(_ctx.get_flag_ref(CONTROL("want_inspect")));
+	modal_equip->display(_ctx.get_flag_ref(CONTROL("want_equip")));
+	modal_remove->display(_ctx.get_flag_ref(CONTROL("want_remove")));
+	modal_spell->display(_ctx.get_flag_ref(CONTROL("want_spell")));
+	modal_identify->display(_ctx.get_flag_ref(CONTROL("want_identify")));
+	modal_drop->display(_ctx.get_flag_ref(CONTROL("want_drop")));
+	modal_use->display(_ctx.get_flag_ref(CONTROL("want_use")));
+	modal_give->display(_ctx.get_flag_ref(CONTROL("want_give")));
+	modal_trade->display(_ctx.get_flag_ref(CONTROL("want_trade")));
+	modal_invoke->display(_ctx.get_flag_ref(CONTROL("want_invoke")));
 	_draw_party_panel();
 	_draw_debug();
 	_draw_cursor();
@@ -4434,7 +4326,7 @@ auto Sorcery::UI::_display_license(const std::string &string) -> void {
 	_draw_components("license");
 	_draw_bg_video();
 
-	auto component{components->get("license:license_info")};
+	auto component{components->get(COMPONENT("license:license_info"))};
 	_draw_license(&component, string);
 	_draw_cursor();
 }
@@ -4453,13 +4345,13 @@ auto Sorcery::UI::_draw_current_level_map() -> void {
 	const auto &explored{explored_it->second};
 
 	constexpr auto tc{20};
-	const auto map_c{components->get("automap:map_graphic")};
+	const auto map_c{components->get(COMPONENT("automap:map_graphic"))};
 	const ImVec2 top_left_pos{grid_pos(map_c.x, map_c.y)};
 
 	const auto scale{_ctx.display->get_display_metrics().scale};
-	const auto spacing{map_c.get_int("tile_spacing") * scale};
-	const ImVec2 tile_sz{map_c.get_int("tile_size") * scale,
-						 map_c.get_int("tile_size") * scale};
+	const auto spacing{map_c.get_int(PROPERTY("tile_spacing")) * scale};
+	const ImVec2 tile_sz{map_c.get_int(PROPERTY("tile_size")) * scale,
+						 map_c.get_int(PROPERTY("tile_size")) * scale};
 
 	// Remember to flip in Y-direction as (0,0) is at bottom left of map
 	const auto reverse_y{(tile_sz.x * tc) + ((tc - 1) * spacing) + 2};
@@ -4521,20 +4413,20 @@ auto Sorcery::UI::_draw_level_no_player() -> void {
 
 	// Menu Selection for B1F to B10F is 0 to 0, thus convert it into -1 to
 	// -10 for depth
-	if (_ctx.get_selected("atlas_selected") == 10)
+	if (_ctx.get_selected(CONTROL("atlas_selected")) == 10)
 		return;
 
-	const auto depth{-1 - _ctx.get_selected("atlas_selected")};
+	const auto depth{-1 - _ctx.get_selected(CONTROL("atlas_selected"))};
 	Level level{_ctx.resources->levels->get(depth).value()};
 
 	// Work out where and how to draw the grid
 	auto tc{20};
-	const auto map_c{components->get("atlas:map_graphic")};
+	const auto map_c{components->get(COMPONENT("atlas:map_graphic"))};
 	ImVec2 top_left_pos{grid_pos(map_c.x, map_c.y)};
-	const auto spacing{map_c.get_int("tile_spacing")};
+	const auto spacing{map_c.get_int(PROPERTY("tile_spacing"))};
 	const auto scale{_ctx.display->get_display_metrics().scale};
-	ImVec2 tile_sz{map_c.get_int("tile_size") * scale,
-				   map_c.get_int("tile_size") * scale};
+	ImVec2 tile_sz{map_c.get_int(PROPERTY("tile_size")) * scale,
+				   map_c.get_int(PROPERTY("tile_size")) * scale};
 
 	// Remember to flip in Y-direction as (0,0) is at bottom left of map
 	const auto reverse_y{(tile_sz.x * tc) + ((tc - 1) * spacing) + 2};
@@ -4559,7 +4451,7 @@ auto Sorcery::UI::_draw_level_no_player() -> void {
 
 auto Sorcery::UI::_draw_loading_progress() -> void {
 
-	auto pb_c{components->get("splash:progress_bar")};
+	auto pb_c{components->get(COMPONENT("splash:progress_bar"))};
 
 	const auto width{pb_c.w * grid_sz()};
 	const float progress{static_cast<float>(images->progress - 1) /
@@ -4597,8 +4489,8 @@ auto Sorcery::UI::_display_main_menu() -> void {
 	_draw_attract_mode();
 	_draw_bg_video();
 
-	dialog_exit->display(_ctx.get_flag_ref("want_exit_game"));
-	dialog_new->display(_ctx.get_flag_ref("want_new_game"));
+	dialog_exit->display(_ctx.get_flag_ref(CONTROL("want_exit_game")));
+	dialog_new->display(_ctx.get_flag_ref(CONTROL("want_new_game")));
 	dialog_leave->display(_ctx.controller->want_to_leave_game());
 
 	_draw_cursor();
@@ -4615,15 +4507,15 @@ auto Sorcery::UI::_display_main_menu() -> void {
 auto Sorcery::UI::_draw_attract_mode() -> void {
 
 	// Get the Attract Data
-	const auto attract{components->get("main_menu:attract_mode")};
+	const auto attract{components->get(COMPONENT("main_menu:attract_mode"))};
 	_attract_data = _ctx.animation->get_attract_data();
 
 	// Work out the size and this where to draw it- (as its centred)!
 	const auto scale{_ctx.display->get_display_metrics().scale};
 	auto am_size{_attract_data.size() *
-				 std::stoi(attract.get("tile_width").value()) * scale};
+				 attract.get_int(PROPERTY("tile_width")) * scale};
 	am_size += (_attract_data.size() - 1) *
-			   std::stoi(attract.get("tile_spacing").value()) * scale;
+			   attract.get_int(PROPERTY("tile_spacing")) * scale;
 	const auto viewport{ImGui::GetMainViewport()};
 	auto tile_pos{ImVec2{(viewport->Size.x - am_size) / 2, grid_y(attract.y)}};
 
@@ -4632,10 +4524,10 @@ auto Sorcery::UI::_draw_attract_mode() -> void {
 
 		_draw_fg_image_with_idx(
 			KNOWN_CREATURES_TEXTURE, idx, tile_pos,
-			ImVec2{attract.get_float("tile_width") * scale,
-				   attract.get_float("tile_width") * scale});
-		tile_pos.x += (attract.get_float("tile_width") * scale +
-					   attract.get_float("tile_spacing") * scale);
+			ImVec2{attract.get_float(PROPERTY("tile_width")) * scale,
+				   attract.get_float(PROPERTY("tile_width")) * scale});
+		tile_pos.x += (attract.get_float(PROPERTY("tile_width")) * scale +
+					   attract.get_float(PROPERTY("tile_spacing")) * scale);
 	}
 }
 
@@ -4658,9 +4550,9 @@ auto Sorcery::UI::draw_frame(const ImVec2 p_min, const ImVec2 p_max,
 }
 
 auto Sorcery::UI::_get_legacy_menu_ui_flags(const std::string_view name)
-	-> std::vector<std::reference_wrapper<bool>> {
+	-> std::vector<std::reference_wrapper<Overlay>> {
 
-	using Flags = std::vector<std::reference_wrapper<bool>>;
+	using Flags = std::vector<std::reference_wrapper<Overlay>>;
 
 	constexpr auto UI_FLAGS_COUNT{21};
 
@@ -4739,7 +4631,7 @@ auto Sorcery::UI::_handle_menu_reordering(const std::string_view name,
 		for (const auto character_id : data)
 			_ctx.controller->add_to_candidate_party(character_id);
 
-		_ctx.controller->set_flag("party_order_changed");
+		_ctx.controller->set_flag(CONTROL("party_order_changed"));
 	}
 }
 
@@ -4761,7 +4653,7 @@ auto Sorcery::UI::_activate_menu_item(const std::string_view name,
 	_ctx.controller->handle_standard_menu(name, items, data_item, selection);
 }
 
-auto Sorcery::UI::draw_menu(const std::string name, const ImColor sel_color,
+auto Sorcery::UI::draw_menu(const MenuKey &key, const ImColor sel_color,
 							const ImVec2 pos, const ImVec2 sz,
 							const Enums::Layout::Font font,
 							std::vector<std::string> &items,
@@ -4772,6 +4664,7 @@ auto Sorcery::UI::draw_menu(const std::string name, const ImColor sel_color,
 
 	// Work out size and positon of the menu, and the display name (which is
 	// used for the ImGui ID)
+	const std::string name{key.key()};
 	const std::string display_name{"##" + name};
 
 	// Note that pos is in grid units, whereas sz is in pixels.
@@ -4800,11 +4693,16 @@ auto Sorcery::UI::draw_menu(const std::string name, const ImColor sel_color,
 		numeric_shortcuts ? _ctx.controller->consume_menu_key(items.size())
 						  : std::nullopt};
 
+	// The selection is a plain array read, as the menu's name was interned
+	// when the menu was created
+	auto &current{selected[key.id()]};
+	auto &current_hl{highlighted[key.id()]};
+
 	// Draw the Menu (as a ListBox)
 	with_ListBox(display_name.c_str(), sz) {
 		for (std::size_t i{0}; i < items.size(); ++i) {
 			const auto index{static_cast<int>(i)};
-			const auto is_selected{selected[name] == index};
+			const auto is_selected{current == index};
 
 			const auto flags{is_selected ? ImGuiSelectableFlags_Highlight
 										 : ImGuiSelectableFlags_None};
@@ -4833,8 +4731,8 @@ auto Sorcery::UI::draw_menu(const std::string name, const ImColor sel_color,
 			}
 
 			if (ImGui::IsItemHovered()) {
-				selected[name] = index;
-				highlighted[name] = index;
+				current = index;
+				current_hl = index;
 			}
 
 			if (is_selected)
@@ -4965,74 +4863,52 @@ auto Sorcery::UI::_priest_spell_index(Enums::Magic::SpellID id) -> std::size_t {
 
 auto Sorcery::UI::in_popup() const -> bool {
 
-	return active_popup_count() > 0;
+	return !overlays->empty();
 }
 
 auto Sorcery::UI::close_all_popups() -> void {
 
-	for (auto *show : _popup_states())
-		*show = false;
+	overlays->close_all();
 }
 
 auto Sorcery::UI::active_popup_count() const -> int {
 
-	const auto states{_popup_states()};
-
-	return std::count_if(states.begin(), states.end(), [](const bool *show) {
-		return *show;
-	});
+	return static_cast<int>(overlays->size());
 }
 
-auto Sorcery::UI::_popup_states() const -> std::vector<bool *> {
-
-	std::vector<bool *> states;
+// Give each overlay shown in the engine a fixed way of drawing itself, so that
+// display_engine() only has to walk whatever is open (note that dynamic modals
+// are recreated, so this needs redoing each time one is)
+auto Sorcery::UI::_bind_overlays() -> void {
 
-	auto add = [&](const auto &ptr, const std::string_view name) {
-		if (ptr) {
-			// DEBUG_LOGF("Popup state: {:<24} {}", name, ptr->show);
-			states.emplace_back(&ptr->show);
-		}
-	};
+	const auto bind{[this](auto &widget, const ControlKey &flag) {
+		if (widget)
+			widget->show.set_draw([this, &widget, &flag] {
+				widget->display(_ctx.get_flag_ref(flag));
+			});
+	}};
 
-#define ADD_POPUP(popup) add(popup, #popup)
-
-	ADD_POPUP(dialog_exit);
-	ADD_POPUP(dialog_new);
-	ADD_POPUP(dialog_leave);
-	ADD_POPUP(dialog_rite);
-	ADD_POPUP(dialog_search);
-	ADD_POPUP(dialog_delete);
-	ADD_POPUP(notice_cannot_donate);
-	ADD_POPUP(notice_donated_ok);
-	ADD_POPUP(notice_not_enough_gold);
-	ADD_POPUP(notice_divvy);
-	ADD_POPUP(notice_pool_gold);
-	ADD_POPUP(notice_renamed_ok);
-	ADD_POPUP(notice_reclassed_ok);
-	ADD_POPUP(dialog_stairs_up);
-	ADD_POPUP(dialog_stairs_down);
-	ADD_POPUP(input_donate);
-	ADD_POPUP(input_name);
-	ADD_POPUP(modal_camp);
-	ADD_POPUP(modal_elevator_top);
-	ADD_POPUP(modal_elevator_bottom);
-	ADD_POPUP(message_tile);
-	ADD_POPUP(modal_inspect);
-	ADD_POPUP(modal_help);
-	ADD_POPUP(modal_tithe);
-	ADD_POPUP(modal_identify);
-	ADD_POPUP(modal_equip);
-	ADD_POPUP(modal_remove);
-	ADD_POPUP(modal_spell);
-	ADD_POPUP(modal_drop);
-	ADD_POPUP(modal_trade);
-	ADD_POPUP(modal_give);
-	ADD_POPUP(modal_use);
-	ADD_POPUP(modal_invoke);
-
-#undef ADD_POPUP
-
-	return states;
+	dialog_leave->show.set_draw([this] {
+		dialog_leave->display(_ctx.controller->want_to_leave_game());
+	});
+	bind(dialog_stairs_up, CONTROL("want_take_stairs_up"));
+	bind(dialog_stairs_down, CONTROL("want_take_stairs_down"));
+	bind(message_tile, CONTROL("after_tile_message"));
+	bind(modal_camp, CONTROL("want_camp"));
+	bind(modal_elevator_top, CONTROL("want_elevator_top"));
+	bind(modal_elevator_bottom, CONTROL("want_elevator_bottom"));
+	bind(modal_inspect, CONTROL("want_inspect"));
+	bind(dialog_search, CONTROL("want_search"));
+	bind(modal_identify, CONTROL("want_identify"));
+	bind(modal_equip, CONTROL("want_equip"));
+	bind(modal_remove, CONTROL("want_remove"));
+	bind(modal_drop, CONTROL("want_drop"));
+	bind(modal_trade, CONTROL("want_trade"));
+	bind(modal_give, CONTROL("want_give"));
+	bind(modal_use, CONTROL("want_use"));
+	bind(modal_invoke, CONTROL("want_invoke"));
+	bind(modal_spell, CONTROL("want_spell"));
+	bind(notice_pool_gold, CONTROL("want_pool_gold"));
 }
 
 auto Sorcery::UI::show_transient(std::string text,
@@ -5042,7 +4918,7 @@ auto Sorcery::UI::show_transient(std::string text,
 
 	_transient_message =
 		TransientMessage{.text = std::move(text),
-						 .expires = std::chrono::steady_clock::now() + duration,
+						 .expires = _ctx.now() + duration,
 						 .width = width,
 						 .mode = mode};
 }
@@ -5082,14 +4958,15 @@ auto Sorcery::UI::_draw_transient() -> void {
 	if (!_transient_message)
 		return;
 
-	if (std::chrono::steady_clock::now() >= _transient_message->expires) {
+	if (_ctx.now() >= _transient_message->expires) {
 		_transient_message.reset();
 		return;
 	}
 
 	const auto &message{*_transient_message};
 
-	const auto component{components->get("engine_base_ui:transient_message")};
+	const auto component{
+		components->get(COMPONENT("engine_base_ui:transient_message"))};
 
 	set_Font(fontstore->get_current_font(component.font).value(), font_sz());
 
@@ -29,6 +29,7 @@
 #include "core/debug.hpp"
 #include "core/define.hpp"
 #include "core/resources.hpp"
+#include "core/snapshots.hpp"
 #include "core/ui.hpp"
 #include "engine/automap.hpp"
 #include "engine/graveyard.hpp"
@@ -76,7 +77,7 @@ auto Sorcery::Engine::start(const int mode) -> int {
 	using namespace std::chrono_literals;
 
 	_ctx.controller->initialise();
-	_ctx.controller->set_flag("in_engine");
+	_ctx.controller->set_flag(CONTROL("in_engine"));
 	_ctx.controller->go_to(Enums::Screen::ENGINE);
 
 	if (_ctx.game->state->get_party_size() > 0)
@@ -100,7 +101,7 @@ auto Sorcery::Engine::start(const int mode) -> int {
 
 		SDL_Event event{};
 
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(event)) {
 
@@ -132,7 +133,7 @@ auto Sorcery::Engine::start(const int mode) -> int {
 				} else {
 
 					_ctx.ui->modal_camp->show = true;
-					_ctx.controller->set_flag("want_camp");
+					_ctx.controller->set_flag(CONTROL("want_camp"));
 				}
 
 				continue;
@@ -175,12 +176,27 @@ auto Sorcery::Engine::start(const int mode) -> int {
 			if (old_monochrome != _ctx.controller->get_monochrome())
 				_ctx.ui->set_monochrome(_ctx.controller->get_monochrome());
 
+			// Check for undoing the last turn
+			if (_ctx.controller->check_for_undo(event)) {
+
+				if (_ctx.snapshots->rewind()) {
+					_pending_elevator.reset();
+					_pending_chute.reset();
+					_ctx.ui->clear_transient();
+				}
+
+				continue;
+			}
+
 			// Check for movement
 			if (const auto movement{_ctx.controller->check_for_movement(event)};
 				movement != MOVE_NONE) {
 
 				_ctx.ui->clear_transient_on_action();
 
+				// Each movement is a turn that can be undone
+				_ctx.snapshots->take();
+
 				switch (movement) {
 
 				case MOVE_FORWARD:
@@ -246,8 +262,7 @@ auto Sorcery::Engine::start(const int mode) -> int {
 		//
 		// Complete pending timed transitions
 		//
-		if (_pending_elevator &&
-			std::chrono::steady_clock::now() >= _pending_elevator->execute_at) {
+		if (_pending_elevator && _ctx.now() >= _pending_elevator->execute_at) {
 
 			const auto depth{_pending_elevator->depth};
 
@@ -258,8 +273,7 @@ auto Sorcery::Engine::start(const int mode) -> int {
 			_take_elevator(depth);
 		}
 
-		if (_pending_chute &&
-			std::chrono::steady_clock::now() >= _pending_chute->execute_at) {
+		if (_pending_chute && _ctx.now() >= _pending_chute->execute_at) {
 
 			const auto depth{_pending_chute->depth};
 			const auto loc{_pending_chute->loc};
@@ -285,8 +299,8 @@ auto Sorcery::Engine::start(const int mode) -> int {
 		if (!_ctx.ui->in_popup()) {
 
 			// Check for return-to-town teleport
-			if (_ctx.controller->has_flag("want_return_to_town")) {
-				_ctx.controller->unset_flag("want_return_to_town");
+			if (_ctx.controller->has_flag(CONTROL("want_return_to_town"))) {
+				_ctx.controller->unset_flag(CONTROL("want_return_to_town"));
 
 				return _go_back_to_town();
 			}
@@ -365,25 +379,26 @@ auto Sorcery::Engine::start(const int mode) -> int {
 			}
 
 			// Check for stairs
-			if (_ctx.controller->has_flag("want_take_stairs_up")) {
+			if (_ctx.controller->has_flag(CONTROL("want_take_stairs_up"))) {
 
 				if (_ctx.game->state->get_depth() == -1)
 					return _go_back_to_town();
 
 				_go_up_a_level();
 
-			} else if (_ctx.controller->has_flag("want_take_stairs_down")) {
+			} else if (_ctx.controller->has_flag(
+						   CONTROL("want_take_stairs_down"))) {
 
 				_go_down_a_level();
 			}
 
 			// Check for Elevator
-			if (_ctx.controller->has_flag("want_take_elevator")) {
+			if (_ctx.controller->has_flag(CONTROL("want_take_elevator"))) {
 
-				const auto depth{
-					_ctx.controller->get_selected("elevator_selected")};
+				const auto depth{_ctx.controller->get_selected(
+					CONTROL("elevator_selected"))};
 
-				_ctx.controller->unset_flag("want_take_elevator");
+				_ctx.controller->unset_flag(CONTROL("want_take_elevator"));
 
 				_ctx.ui->show_transient(_ctx.get_string("POP_UP_ELEVATOR"), 1s,
 										TransientWidth::FIT_TEXT,
@@ -391,17 +406,17 @@ auto Sorcery::Engine::start(const int mode) -> int {
 
 				_pending_elevator = PendingElevator{
 					.depth = depth,
-					.execute_at = std::chrono::steady_clock::now() + 1s};
+					.execute_at = _ctx.now() + 1s};
 			}
 
-			if (_ctx.controller->has_flag("after_event_search") &&
+			if (_ctx.controller->has_flag(CONTROL("after_event_search")) &&
 				!_ctx.ui->dialog_search->show) {
 
-				_ctx.controller->unset_flag("after_event_search");
+				_ctx.controller->unset_flag(CONTROL("after_event_search"));
 
-				if (_ctx.controller->has_flag("want_search")) {
+				if (_ctx.controller->has_flag(CONTROL("want_search"))) {
 
-					_ctx.controller->unset_flag("want_search");
+					_ctx.controller->unset_flag(CONTROL("want_search"));
 
 					if (_search_event()) {
 
@@ -419,7 +434,7 @@ auto Sorcery::Engine::start(const int mode) -> int {
 			}
 
 			// Handle quitting expedition
-			if (_ctx.controller->has_flag("want_quit_expedition")) {
+			if (_ctx.controller->has_flag(CONTROL("want_quit_expedition"))) {
 
 				auto party{_ctx.game->state->get_party_characters()};
 
@@ -444,10 +459,10 @@ auto Sorcery::Engine::start(const int mode) -> int {
 		}
 
 		// Clear completed tile message state
-		if (_ctx.controller->has_flag("after_tile_message") &&
+		if (_ctx.controller->has_flag(CONTROL("after_tile_message")) &&
 			!_ctx.ui->message_tile->show) {
 
-			_ctx.controller->unset_flag("after_tile_message");
+			_ctx.controller->unset_flag(CONTROL("after_tile_message"));
 
 			if (const auto result{_handle_completed_tile_event()})
 				return *result;
@@ -466,7 +481,7 @@ auto Sorcery::Engine::start(const int mode) -> int {
 
 auto Sorcery::Engine::stop() -> int {
 
-	_ctx.controller->unset_flag("in_engine");
+	_ctx.controller->unset_flag(CONTROL("in_engine"));
 
 	return 0;
 }
@@ -505,13 +520,14 @@ auto Sorcery::Engine::_start_expedition(const int mode) -> void {
 	_ctx.controller->set_last_dir(Enums::Map::Direction::NO_DIRECTION);
 	_ctx.controller->set_last_event(Enums::Map::Event::NO_EVENT);
 	_ctx.controller->set_can_undo(false);
+	_ctx.snapshots->clear();
 	_ctx.controller->set_monochrome(
 		_ctx.get_config(Enums::Config::COLOURED_WIREFRAME));
 	_ctx.ui->set_monochrome(_ctx.get_config(Enums::Config::COLOURED_WIREFRAME));
 
-	//_ctx.controller->set_flag("show_automap");
-	_ctx.controller->set_flag("interface_party_panel");
-	_ctx.controller->set_flag("interface_ui");
+	//_ctx.controller->set_flag(CONTROL("show_automap"));
+	_ctx.controller->set_flag(CONTROL("interface_party_panel"));
+	_ctx.controller->set_flag(CONTROL("interface_ui"));
 
 	if (!_tile_explored(_ctx.game->state->get_player_pos()))
 		_set_tile_explored(_ctx.game->state->get_player_pos());
@@ -696,8 +712,7 @@ auto Sorcery::Engine::_move_forward() -> bool {
 		_pending_chute =
 			PendingChute{.depth = destination->to_level,
 						 .loc = destination->to_loc,
-						 .execute_at = std::chrono::steady_clock::now() +
-									   std::chrono::seconds{2}};
+						 .execute_at = _ctx.now() + std::chrono::seconds{2}};
 
 		return true;
 	} else if (const auto destination{next_tile.has_teleport()}) {
@@ -708,7 +723,7 @@ auto Sorcery::Engine::_move_forward() -> bool {
 
 			// Special case of teleporting back to castle
 			_ctx.controller->set_last_event(Enums::Map::Event::NO_EVENT);
-			_ctx.controller->set_flag("want_return_to_town");
+			_ctx.controller->set_flag(CONTROL("want_return_to_town"));
 			return true;
 
 		} else if (destination->to_level == _ctx.game->state->get_depth()) {
@@ -820,7 +835,7 @@ auto Sorcery::Engine::_go_down_a_level() -> void {
 			_ctx.game->state->set_depth(to_level);
 			_set_tile_explored(_ctx.game->state->get_player_pos());
 
-			_ctx.controller->unset_flag("want_take_stairs_down");
+			_ctx.controller->unset_flag(CONTROL("want_take_stairs_down"));
 		}
 	}
 }
@@ -844,11 +859,11 @@ auto Sorcery::Engine::_go_up_a_level() -> void {
 			_ctx.game->state->set_depth(to_level);
 			_set_tile_explored(_ctx.game->state->get_player_pos());
 
-			_ctx.controller->unset_flag("want_take_stairs_down");
+			_ctx.controller->unset_flag(CONTROL("want_take_stairs_down"));
 		}
 	}
 
-	_ctx.controller->unset_flag("want_take_stairs_up");
+	_ctx.controller->unset_flag(CONTROL("want_take_stairs_up"));
 }
 auto Sorcery::Engine::_move_backward() -> bool {
 
@@ -1184,7 +1199,7 @@ auto Sorcery::Engine::_handle_completed_tile_event() -> std::optional<int> {
 	if (event.search_after) {
 
 		_ctx.ui->dialog_search->show = true;
-		_ctx.controller->set_flag("after_event_search");
+		_ctx.controller->set_flag(CONTROL("after_event_search"));
 
 		return std::nullopt;
 	}
@@ -1291,7 +1306,7 @@ auto Sorcery::Engine::_show_tile_message(const Enums::Map::Event event)
 
 	_ctx.ui->message_tile->set(_ctx.ui->load_message(event), event);
 
-	_ctx.controller->set_flag("after_tile_message");
+	_ctx.controller->set_flag(CONTROL("after_tile_message"));
 	_ctx.controller->set_last_event(event);
 	_ctx.ui->message_tile->show = true;
 }
@@ -62,7 +62,7 @@ auto Sorcery::Graveyard::start(void) -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
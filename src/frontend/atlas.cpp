@@ -36,7 +36,7 @@ Sorcery::Atlas::Atlas(Context &ctx)
 
 auto Sorcery::Atlas::_initialise() -> bool {
 
-	_ctx.controller->set_selected("atlas_selected", 0);
+	_ctx.controller->set_selected(CONTROL("atlas_selected"), 0);
 
 	return true;
 }
@@ -53,7 +53,7 @@ auto Sorcery::Atlas::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
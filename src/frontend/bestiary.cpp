@@ -36,7 +36,8 @@ Sorcery::Bestiary::Bestiary(Context &ctx)
 
 auto Sorcery::Bestiary::_initialise() -> bool {
 
-	_ctx.controller->set_selected("bestiary_selected", 0); // Bubbly Slime
+	_ctx.controller->set_selected(CONTROL("bestiary_selected"),
+								  0); // Bubbly Slime
 
 	return true;
 }
@@ -53,7 +54,7 @@ auto Sorcery::Bestiary::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
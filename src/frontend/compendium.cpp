@@ -48,7 +48,7 @@ Sorcery::Compendium::~Compendium() {}
 
 auto Sorcery::Compendium::_initialise() -> bool {
 
-	_ctx.controller->set_selected("compendium_selected", 0);
+	_ctx.controller->set_selected(CONTROL("compendium_selected"), 0);
 
 	return true;
 }
@@ -65,7 +65,7 @@ auto Sorcery::Compendium::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -28,8 +28,8 @@
 #include "core/ui.hpp"
 #include "gui/define.hpp"
 #include "resources/define.hpp"
+#include "resources/filestore.hpp"
 
-#include <fstream>
 #include <string>
 
 Sorcery::License::License(Context &ctx)
@@ -40,12 +40,9 @@ Sorcery::License::License(Context &ctx)
 
 auto Sorcery::License::_initialise() -> bool {
 
-	auto file_path{_ctx.get_file(LICENSE_FILE).string()};
+	if (auto file{_ctx.get_resource(LICENSE_FILE).stream()}; file->good()) {
 
-	if (std::ifstream file{(file_path.c_str()), std::ifstream::in};
-		file.good()) {
-
-		_license_text.assign((std::istreambuf_iterator<char>(file)),
+		_license_text.assign((std::istreambuf_iterator<char>(*file)),
 							 (std::istreambuf_iterator<char>()));
 	}
 
@@ -64,7 +61,7 @@ auto Sorcery::License::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -74,7 +74,7 @@ auto Sorcery::MainMenu::start() -> int {
 	while (!done) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -101,13 +101,13 @@ auto Sorcery::MainMenu::start() -> int {
 			_ctx.ui->display(Enums::Screen::MAINMENU);
 
 			// Check for the results of a Popup Dialog
-			if (_ctx.controller->has_flag("want_exit_game"))
+			if (_ctx.controller->has_flag(CONTROL("want_exit_game")))
 				return MAIN_MENU_EXIT_GAME;
-			else if (_ctx.controller->has_flag("want_new_game"))
+			else if (_ctx.controller->has_flag(CONTROL("want_new_game")))
 				return MAIN_MENU_NEW_GAME;
 			else if (_ctx.controller->want_to_abort())
 				return ABORT_GAME;
-			else if (_ctx.controller->has_flag("want_continue_game"))
+			else if (_ctx.controller->has_flag(CONTROL("want_continue_game")))
 				return MAIN_MENU_CONTINUE_GAME;
 
 			// Check for the results of something being selected from a menu
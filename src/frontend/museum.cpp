@@ -36,7 +36,7 @@ Sorcery::Museum::Museum(Context &ctx)
 
 auto Sorcery::Museum::_initialise() -> bool {
 
-	_ctx.controller->set_selected("museum_selected", 1); // Long Sword
+	_ctx.controller->set_selected(CONTROL("museum_selected"), 1); // Long Sword
 
 	return true;
 }
@@ -53,7 +53,7 @@ auto Sorcery::Museum::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -56,7 +56,7 @@ auto Sorcery::Options::start(const bool is_in_game) -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -40,7 +40,7 @@ Sorcery::SpellBook::SpellBook(Context &ctx)
 auto Sorcery::SpellBook::_initialise() -> bool {
 
 	_ctx.controller->set_selected(
-		"spellbook_selected",
+		CONTROL("spellbook_selected"),
 		std::to_underlying(Enums::Magic::SpellID::DUMAPIC));
 
 	return true;
@@ -58,7 +58,7 @@ auto Sorcery::SpellBook::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
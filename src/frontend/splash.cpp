@@ -61,7 +61,7 @@ auto Sorcery::Splash::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 		}
 
 		_ctx.ui->display(Enums::Screen::SPLASH);
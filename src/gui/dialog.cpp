@@ -27,16 +27,17 @@
 #include "core/ui.hpp"
 #include "gui/uistyle.hpp"
 #include "resources/fontstore.hpp"
+#include "resources/stringkeys.hpp"
 #include "resources/stringstore.hpp"
 #include "types/component.hpp"
 
 Sorcery::Dialog::Dialog(Context &ctx, Component &component,
 						const Enums::Layout::DialogType type)
-	: _ctx{ctx},
+	: show{ctx.overlays, component.name},
+	  _ctx{ctx},
 	  _component{component},
 	  _type{type} {
 
-	show = false;
 	_name = _component.name;
 }
 
@@ -53,14 +54,14 @@ auto Sorcery::Dialog::name() const -> std::string {
 auto Sorcery::Dialog::display(bool &is_yes) -> void {
 
 	_id = _component.name + "##outer";
-	const auto yes_lbl{_ctx.get_string("DIALOG_YES")};
-	const auto no_lbl{_ctx.get_string("DIALOG_NO")};
-	const auto ok_lbl{_ctx.get_string("DIALOG_OK")};
+	const auto yes_lbl{_ctx.get_text(StringID::DIALOG_YES)};
+	const auto no_lbl{_ctx.get_text(StringID::DIALOG_NO)};
+	const auto ok_lbl{_ctx.get_text(StringID::DIALOG_OK)};
 	const auto rounding{_ctx.ui->frame_rd};
 	set_Font(_ctx.ui->fontstore->get_current_font(_component.font).value(),
 			 _ctx.ui->font_sz());
 	const auto width{
-		ImGui::CalcTextSize(_ctx.get_string(_component.string_key).c_str()).x +
+		ImGui::CalcTextSize(_ctx.get_text(_component.string_key).data()).x +
 		(_ctx.ui->grid_sz() * 4)};
 	const auto height{_component.h * _ctx.ui->grid_sz()};
 
@@ -94,7 +95,7 @@ auto Sorcery::Dialog::display(bool &is_yes) -> void {
 #pragma GCC diagnostic ignored "-Wformat-security"
 		ImGui::SetCursorPos(
 			ImVec2{_ctx.ui->grid_sz() * 2, _ctx.ui->grid_sz() * 2});
-		ImGui::TextWrapped(_ctx.get_string(_component.string_key).c_str());
+		ImGui::TextWrapped(_ctx.get_text(_component.string_key).data());
 #pragma GCC diagnostic pop
 
 		ImVec2 btn_size{ImGui::GetFontSize() * 7.0f, 0.0f};
@@ -105,21 +106,21 @@ auto Sorcery::Dialog::display(bool &is_yes) -> void {
 			ImGui::SetCursorPos(
 				ImVec2{centre - (btn_size.x + _ctx.ui->grid_sz()),
 					   _ctx.ui->grid_sz() * 4});
-			if (ImGui::Button(yes_lbl.c_str(), btn_size)) {
+			if (ImGui::Button(yes_lbl.data(), btn_size)) {
 				is_yes = true;
 				show = false;
 				ImGui::CloseCurrentPopup();
 			}
 			ImGui::SetCursorPos(
 				ImVec2{centre + _ctx.ui->grid_sz(), _ctx.ui->grid_sz() * 4});
-			if (ImGui::Button(no_lbl.c_str(), btn_size)) {
+			if (ImGui::Button(no_lbl.data(), btn_size)) {
 				show = false;
 				ImGui::CloseCurrentPopup();
 			}
 		} else if (_type == OK) {
 			ImGui::SetCursorPos(
 				ImVec2{centre - (btn_size.x / 2), _ctx.ui->grid_sz() * 4});
-			if (ImGui::Button(ok_lbl.c_str(), btn_size)) {
+			if (ImGui::Button(ok_lbl.data(), btn_size)) {
 				is_yes = true;
 				show = false;
 				ImGui::CloseCurrentPopup();
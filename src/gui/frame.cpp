@@ -31,7 +31,7 @@
 #include "resources/stringstore.hpp"
 #include "types/component.hpp"
 
-Sorcery::Frame::Frame(Context &ctx, Component *component)
+Sorcery::Frame::Frame(Context &ctx, const Component *component)
 	: _ctx{ctx},
 	  _component{component} {
 
@@ -41,17 +41,17 @@ Sorcery::Frame::Frame(Context &ctx, Component *component)
 	_bg_colour = _component->background;
 	_name = _component->name;
 
-	if (_component->get("background"))
-		_bg_image = _component->get("background").value();
+	if (_component->get(PROPERTY("background")))
+		_bg_image = _component->get(PROPERTY("background")).value();
 	else
 		_bg_image = std::nullopt;
-	if (_component->get("title"))
-		_title = _component->get("title");
+	if (_component->get(PROPERTY("title")))
+		_title = _component->get(PROPERTY("title"));
 	else
 		_title = std::nullopt;
 
-	if (_component->get("foreground")) {
-		if (_component->get("foreground").value() == "yes")
+	if (_component->get(PROPERTY("foreground"))) {
+		if (_component->get(PROPERTY("foreground")).value() == "yes")
 			_draw(true);
 		else
 			_draw(false);
@@ -63,6 +63,7 @@ Sorcery::Frame::Frame(Context &ctx, std::string_view name, const ImVec2 pos,
 					  const Size size, const ImU32 colour,
 					  const ImU32 bg_colour)
 	: _ctx{ctx},
+	  _component{nullptr},
 	  _name{name},
 	  _pos{pos},
 	  _size{size},
@@ -77,26 +78,24 @@ Sorcery::Frame::Frame(Context &ctx, std::string_view name, const ImVec2 pos,
 auto Sorcery::Frame::_draw(const bool foreground) -> void {
 
 	const auto rounding{_ctx.ui->frame_rd};
-	const auto size{_ctx.ui->grid_delta(static_cast<float>(_size.w),
-										static_cast<float>(_size.h))};
-
-	const auto x{std::invoke([&] {
-		if (_pos.x == -1) {
-			const auto viewport{ImGui::GetMainViewport()};
-			return (viewport->Size.x - size.x) / 2.0f;
-		}
-
-		return _ctx.ui->grid_pos(_pos.x, 0.0f).x;
-	})};
-
-	const auto y{std::invoke([&] {
-		if (_pos.y == -1) {
-			const auto viewport{ImGui::GetMainViewport()};
-			return (viewport->Size.y - size.y) / 2.0f;
+	// Frames from the layout have their geometry worked out in advance
+	const auto [x, y, size] = std::invoke([&] {
+		if (_component) {
+			const auto place{_ctx.ui->placement(_component)};
+			const auto pos{_ctx.ui->layout_origin(place, place.size)};
+			return std::tuple{pos.x, pos.y, place.size};
 		}
 
-		return _ctx.ui->grid_pos(0.0f, _pos.y).y;
-	})};
+		const auto size{_ctx.ui->grid_delta(static_cast<float>(_size.w),
+											static_cast<float>(_size.h))};
+		const auto viewport{ImGui::GetMainViewport()};
+		return std::tuple{
+			_pos.x == -1 ? (viewport->Size.x - size.x) / 2.0f
+						 : _ctx.ui->grid_pos(_pos.x, 0.0f).x,
+			_pos.y == -1 ? (viewport->Size.y - size.y) / 2.0f
+						 : _ctx.ui->grid_pos(0.0f, _pos.y).y,
+			size};
+	});
 
 	const auto layer{foreground ? WINDOW_LAYER_TEXTS : WINDOW_LAYER_FRAMES};
 
@@ -31,25 +31,25 @@
 #include "gui/frame.hpp"
 #include "gui/modal.hpp"
 #include "resources/fontstore.hpp"
+#include "resources/stringkeys.hpp"
 #include "resources/stringstore.hpp"
 #include "types/component.hpp"
 #include "types/game.hpp"
 
 Sorcery::Input::Input(Context &ctx, Component &component)
-	: _ctx{ctx},
+	: show{ctx.overlays, component.name},
+	  _ctx{ctx},
 	  _component{component} {
 
-	show = false;
-
 	_width = _component.w;
 	_height = _component.h;
 	_colour = _component.colour;
 	_bg_colour = _component.background;
-	_hi_colour = _component.get_float("highlight");
+	_hi_colour = _component.get_float(PROPERTY("highlight"));
 	_font = _component.font;
 	_title = _ctx.get_string(_component.string_key);
 	_input = "";
-	_input_width = std::stoi(_component.get("input_width").value());
+	_input_width = _component.get_int(PROPERTY("input_width"));
 	_game = nullptr;
 	_name = _component.name;
 }
@@ -141,10 +141,10 @@ auto Sorcery::Input::display([[maybe_unused]] bool &is_yes) -> void {
 		ImVec2 btn_size{ImGui::GetFontSize() * 7.0f, 0.0f};
 		const auto centre{(width / 2)};
 
-		const auto ok_lbl{_ctx.get_string("INPUT_OK")};
+		const auto ok_lbl{_ctx.get_text(StringID::INPUT_OK)};
 		ImGui::SetCursorPos(
 			ImVec2{centre - (btn_size.x / 2), _ctx.ui->grid_sz() * 5});
-		if (ImGui::Button(ok_lbl.c_str(), btn_size)) {
+		if (ImGui::Button(ok_lbl.data(), btn_size)) {
 			is_yes = true;
 			show = false;
 			if (_input.length() == 0) {
@@ -163,17 +163,18 @@ auto Sorcery::Input::display([[maybe_unused]] bool &is_yes) -> void {
 					if (amount > character.get_gold()) {
 
 						// Too much!
-						_ctx.controller->unset_flag("want_tithe");
-						_ctx.controller->unset_flag("want_gold");
-						_ctx.controller->set_flag("want_not_enough_gold");
+						_ctx.controller->unset_flag(CONTROL("want_tithe"));
+						_ctx.controller->unset_flag(CONTROL("want_gold"));
+						_ctx.controller->set_flag(
+							CONTROL("want_not_enough_gold"));
 						_ctx.ui->notice_not_enough_gold->show = true;
 						_ctx.controller->clear_character(
 							Enums::CharacterSlot::TITHE);
 					} else {
 
-						_ctx.controller->unset_flag("want_tithe");
-						_ctx.controller->unset_flag("want_gold");
-						_ctx.controller->set_flag("want_donated_ok");
+						_ctx.controller->unset_flag(CONTROL("want_tithe"));
+						_ctx.controller->unset_flag(CONTROL("want_gold"));
+						_ctx.controller->set_flag(CONTROL("want_donated_ok"));
 						_ctx.controller->clear_character(
 							Enums::CharacterSlot::TITHE);
 						character.grant_xp(amount);
@@ -42,31 +42,29 @@
 #include "types/game.hpp"
 #include "types/state.hpp"
 
-Sorcery::Menu::Menu(Context &ctx, Component *component, Game *game)
+Sorcery::Menu::Menu(Context &ctx, const Component *component, Game *game)
 	: _ctx{ctx},
 	  _component{component},
-	  _game{game} {
+	  _game{game},
+	  _key{component->name} {
 
 	_name = _component->name;
 	_pos = ImVec2{_component->x, _component->y};
-	_width = _component->get_int("width");
-	_height = _component->get_int("height");
+	_width = _component->get_int(PROPERTY("width"));
+	_height = _component->get_int(PROPERTY("height"));
 	_colour = _component->colour;
 	_bg_colour = _component->background;
-	_hi_colour = _component->get_float("highlight");
+	_hi_colour = _component->get_float(PROPERTY("highlight"));
 	_font = _component->font;
-	if (component->get("reorder"))
-		_reorder = component->get("reorder").value() == "yes";
+	if (component->get(PROPERTY("reorder")))
+		_reorder = component->get(PROPERTY("reorder")).value() == "yes";
 	else
 		_reorder = false;
-	if (component->get("across"))
-		_across = component->get("across").value() == "yes";
+	if (component->get(PROPERTY("across")))
+		_across = component->get(PROPERTY("across")).value() == "yes";
 	else
 		_across = false;
-	if (component->get("numeric_input"))
-		_numeric_input = component->get("numeric_input").value() == "true";
-	else
-		_numeric_input = false;
+	_numeric_input = component->get_bool(PROPERTY("numeric_input"));
 }
 
 Sorcery::Menu::~Menu() {}
@@ -92,16 +90,16 @@ auto Sorcery::Menu::draw() -> void {
 					   (_height * ImGui::GetTextLineHeightWithSpacing()) + 2)}};
 
 		// Note that _pos is in grid units whereas sz is in pixels!
-		_ctx.ui->draw_menu(_name, col, _pos, sz, _font, _items, _data, _reorder,
+		_ctx.ui->draw_menu(_key, col, _pos, sz, _font, _items, _data, _reorder,
 						   _across, _numeric_input);
 
 		// Handle SpecialEvents such as Reordering Party Menu
-		if (_ctx.controller->has_flag("party_order_changed")) {
+		if (_ctx.controller->has_flag(CONTROL("party_order_changed"))) {
 
 			_game->state->reorder_party(_ctx.controller->get_candidate_party());
 			regenerate();
 			_ctx.controller->clear_candidate_party();
-			_ctx.controller->unset_flag("party_order_changed");
+			_ctx.controller->unset_flag(CONTROL("party_order_changed"));
 		}
 	}
 }
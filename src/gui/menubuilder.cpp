@@ -31,6 +31,7 @@
 #include "resources/itemstore.hpp"
 #include "resources/monsterstore.hpp"
 #include "resources/spellstore.hpp"
+#include "resources/stringkeys.hpp"
 #include "resources/stringstore.hpp"
 #include "types/game.hpp"
 #include "types/meta.hpp"
@@ -328,20 +329,22 @@ auto Sorcery::MenuBuilder::_load_bestiary_menu(unsigned int width,
 	}
 
 	items.emplace_back(
-		std::format("{:^{}}", _ctx.get_string("BESTIARY_RETURN"), width));
+		std::format("{:^{}}", _ctx.get_text(StringID::BESTIARY_RETURN), width));
 }
 
 auto Sorcery::MenuBuilder::_load_spellbook_menu(unsigned int width,
 												std::vector<std::string> &items)
 	-> void {
 
-	for (const auto &spell : _ctx.resources->spells->get_all()) {
+	const auto spells{_ctx.resources->spells->get_all()};
+	items.reserve(spells.size() + 1);
+	for (const auto &spell : spells) {
 
 		items.emplace_back(std::format("{:^{}}", spell.name, width));
 	}
 
-	items.emplace_back(
-		std::format("{:^{}}", _ctx.get_string("SPELLBOOK_RETURN"), width));
+	items.emplace_back(std::format(
+		"{:^{}}", _ctx.get_text(StringID::SPELLBOOK_RETURN), width));
 }
 
 auto Sorcery::MenuBuilder::_load_buy_menu(unsigned int width,
@@ -351,27 +354,42 @@ auto Sorcery::MenuBuilder::_load_buy_menu(unsigned int width,
 	const auto char_id{
 		_ctx.controller->get_character(Enums::CharacterSlot::STORE)};
 	auto &character{_ctx.game->characters.at(char_id)};
+	const auto &store{*_ctx.resources->items};
+	const auto all_types{store.get_all_types()};
+	items.reserve(all_types.size());
+	data.reserve(all_types.size());
+	_format_buy_rows();
 
-	for (const auto &item_type : _ctx.resources->items->get_all_types()) {
+	for (const auto &item_type : all_types) {
 
 		// Either has a fixed amount (> 0) or endless supply (-1)
-		const auto in_stock{
-			_ctx.game->state->check_shop_stock(item_type.get_type_id()) != 0};
-		const auto will_sell{
-			_ctx.game->state->check_shop_will_sell(item_type.get_type_id())};
+		const auto id{item_type.get_type_id()};
+		const auto in_stock{_ctx.game->state->check_shop_stock(id) != 0};
+		const auto will_sell{_ctx.game->state->check_shop_will_sell(id)};
 		if (in_stock && will_sell) {
+			const auto usable{store.is_usable(id, character.get_class())};
+			items.emplace_back(
+				_buy_rows.at(std::to_underlying(id))[usable ? 0 : 1]);
+			data.emplace_back(std::to_underlying(id));
+		}
+	}
+}
 
-			const auto suffix{item_type.is_class_usable(character.get_class())
-								  ? enum_name(item_type.get_category())
-								  : " (Not Usable)"};
-			const auto price{item_type.get_value()};
-			const auto entry{std::format("{:<20} {:>6} {:<13}",
-										 item_type.get_known_name(), price,
-										 suffix)};
+auto Sorcery::MenuBuilder::_format_buy_rows() -> void {
 
-			items.emplace_back(entry);
-			data.emplace_back(std::to_underlying(item_type.get_type_id()));
-		}
+	if (!_buy_rows.empty())
+		return;
+
+	const auto all_types{_ctx.resources->items->get_all_types()};
+	_buy_rows.reserve(all_types.size());
+	for (const auto &item_type : all_types) {
+		const auto name{item_type.get_known_name()};
+		const auto price{item_type.get_value()};
+		_buy_rows.push_back(
+			{std::format("{:<20} {:>6} {:<13}", name, price,
+						 enum_name(item_type.get_category())),
+			 std::format("{:<20} {:>6} {:<13}", name, price,
+						 " (Not Usable)")});
 	}
 }
 
@@ -392,7 +410,7 @@ auto Sorcery::MenuBuilder::_load_museum_menu(unsigned int width,
 	}
 
 	items.emplace_back(
-		std::format("{:^{}}", _ctx.get_string("MUSEUM_RETURN"), width));
+		std::format("{:^{}}", _ctx.get_text(StringID::MUSEUM_RETURN), width));
 }
 
 auto Sorcery::MenuBuilder::build(const std::string &menu_name,
@@ -516,7 +534,7 @@ auto Sorcery::MenuBuilder::_load_fixed_menu(const std::string &menu_name,
 		return;
 
 	for (const auto &key : it->second) {
-		items.emplace_back(std::format("{:^{}}", _ctx.get_string(key), width));
+		items.emplace_back(std::format("{:^{}}", _ctx.get_text(key), width));
 	}
 }
 
@@ -569,34 +587,35 @@ auto Sorcery::MenuBuilder::_load_character_spells(
 	const auto char_id{
 		_ctx.controller->get_character(Enums::CharacterSlot::INSPECT)};
 	auto &character{_ctx.game->characters.at(char_id)};
-
-	// Work out castable spells for the character, filtering out as above.
-	auto castable_spells{
-		character.spells() |
-		std::views::filter([&character](const Spell &spell) {
-			return (spell.known &&
-					(spell.category != Enums::Magic::SpellCategory::HEALING ||
-					 spell.category != Enums::Magic::SpellCategory::FIELD));
-		})};
+	_format_spell_rows();
 
 	// Build up the spell list (note that spells that are unable to be
 	// currently cast due to lack of spell points are also included here,
-	// but are disabled)
-	for (const auto &spell : castable_spells) {
+	// but are disabled) - every known spell is listed, whatever its category
+	for (const auto &spell : character.spells()) {
 
-		const auto spell_type{enum_name(spell.type)};
-		const auto spell_level{spell.level};
-		const auto spell_english{spell.translated_name};
-		const auto spell_name{spell.name};
+		if (!spell.known)
+			continue;
 
-		const auto spell_desc{
-			std::format("{} ({})", spell_name, spell_english)};
+		const auto index{
+			static_cast<std::size_t>(std::to_underlying(spell.id))};
+		items.emplace_back(_spell_rows.at(index));
+		data.emplace_back(std::to_underlying(spell.id));
+	}
+}
 
-		std::string line{
-			std::format("{:<22} {} {}", spell_desc, spell_type, spell_level)};
+auto Sorcery::MenuBuilder::_format_spell_rows() -> void {
 
-		items.emplace_back(std::move(line));
-		data.emplace_back(std::to_underlying(spell.id));
+	if (!_spell_rows.empty())
+		return;
+
+	const auto spells{_ctx.resources->spells->get_all()};
+	_spell_rows.reserve(spells.size());
+	for (const auto &spell : spells) {
+		const auto spell_desc{
+			std::format("{} ({})", spell.name, spell.translated_name)};
+		_spell_rows.emplace_back(std::format(
+			"{:<22} {} {}", spell_desc, enum_name(spell.type), spell.level));
 	}
 }
 
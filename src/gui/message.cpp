@@ -28,14 +28,15 @@
 #include "core/ui.hpp"
 #include "gui/uistyle.hpp"
 #include "resources/fontstore.hpp"
+#include "resources/stringkeys.hpp"
 #include "resources/stringstore.hpp"
 #include "types/component.hpp"
 
 Sorcery::Message::Message(Context &ctx, Component &component)
-	: _ctx{ctx},
+	: show{ctx.overlays, component.name},
+	  _ctx{ctx},
 	  _component{component} {
 
-	show = false;
 	_str = "NONE";
 	_event_id = Enums::Map::Event::NO_EVENT;
 	_name = _component.name;
@@ -63,7 +64,7 @@ auto Sorcery::Message::display(bool &is_yes) -> void {
 	if (!show)
 		return;
 
-	const auto continue_lbl{_ctx.get_string("MESSAGE_CONTINUE")};
+	const auto continue_lbl{_ctx.get_text(StringID::MESSAGE_CONTINUE)};
 	const auto rounding{_ctx.ui->frame_rd};
 	const auto grid{_ctx.ui->grid_sz()};
 
@@ -77,9 +78,9 @@ auto Sorcery::Message::display(bool &is_yes) -> void {
 
 	for (const auto &key : _strings) {
 
-		const auto text{_ctx.get_string(key)};
+		const auto text{_ctx.get_text(key)};
 
-		text_width = std::max(text_width, ImGui::CalcTextSize(text.c_str()).x);
+		text_width = std::max(text_width, ImGui::CalcTextSize(text.data()).x);
 	}
 
 	const auto text_padding{grid * 2.0f};
@@ -93,7 +94,7 @@ auto Sorcery::Message::display(bool &is_yes) -> void {
 	//
 	// Continue button/frame
 	//
-	const auto label_size{ImGui::CalcTextSize(continue_lbl.c_str())};
+	const auto label_size{ImGui::CalcTextSize(continue_lbl.data())};
 
 	const auto actual_button_size{
 		ImVec2{label_size.x + (ImGui::GetStyle().FramePadding.x * 2.0f),
@@ -187,13 +188,13 @@ auto Sorcery::Message::display(bool &is_yes) -> void {
 
 		for (const auto &key : _strings) {
 
-			const auto text{_ctx.get_string(key)};
-			const auto size{ImGui::CalcTextSize(text.c_str())};
+			const auto text{_ctx.get_text(key)};
+			const auto size{ImGui::CalcTextSize(text.data())};
 
 			ImGui::SetCursorPos(
 				ImVec2{std::round((total_width - size.x) * 0.5f), y_pos});
 
-			ImGui::TextUnformatted(text.c_str());
+			ImGui::TextUnformatted(text.data());
 
 			y_pos += grid;
 		}
@@ -227,7 +228,7 @@ auto Sorcery::Message::display(bool &is_yes) -> void {
 
 		ImGui::SetCursorPos(ImVec2{actual_button_x, actual_button_y});
 
-		if (ImGui::Button(continue_lbl.c_str(), actual_button_size)) {
+		if (ImGui::Button(continue_lbl.data(), actual_button_size)) {
 
 			is_yes = true;
 			show = false;
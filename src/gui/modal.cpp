@@ -36,17 +36,17 @@
 #include "types/game.hpp"
 
 Sorcery::Modal::Modal(Context &ctx, Component &component)
-	: _ctx{ctx},
-	  _component{component} {
+	: show{ctx.overlays, component.name},
+	  _ctx{ctx},
+	  _component{component},
+	  _menu_name{component.get(PROPERTY("menu_name")).value()},
+	  _menu_key{_menu_name} {
 
-	show = false;
-
-	_menu_name = component.get("menu_name").value();
 	_width = _component.w;
 	_height = _component.h;
 	_colour = _component.colour;
 	_bg_colour = _component.background;
-	_hi_colour = _component.get_float("highlight");
+	_hi_colour = _component.get_float(PROPERTY("highlight"));
 	_font = _component.font;
 	_has_title = _ctx.get_string(_component.string_key).length() > 0;
 	_name = _component.name;
@@ -73,7 +73,7 @@ auto Sorcery::Modal::display([[maybe_unused]] bool &is_yes) -> void {
 
 	_id = _component.name + "##modal";
 
-	if (_component.get_bool("dynamic")) {
+	if (_component.get_bool(PROPERTY("dynamic"))) {
 
 		const auto frame_rows{3};
 		const auto title_rows{_has_title ? 2 : 0};
@@ -130,7 +130,7 @@ auto Sorcery::Modal::display([[maybe_unused]] bool &is_yes) -> void {
 		}
 
 		// Note that pos is in grid units whereas sz is in pixels!
-		_ctx.ui->draw_menu(_menu_name, col, ImVec2{1, top}, sz, _font, _items,
+		_ctx.ui->draw_menu(_menu_key, col, ImVec2{1, top}, sz, _font, _items,
 						   _data, false, false, false);
 
 		// DEBUG_LOGF("Displaying modal menu: {}", _menu_name);
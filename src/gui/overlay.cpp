@@ -0,0 +1,177 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "gui/overlay.hpp"
+
+#include <format>
+
+Sorcery::Overlay::Overlay(OverlayStack *stack, std::string_view name)
+	: _stack{stack},
+	  _prev{nullptr},
+	  _next{nullptr},
+	  _active{false},
+	  _name{name},
+	  _draw{} {}
+
+Sorcery::Overlay::~Overlay() {
+
+	if (_active && _stack)
+		_stack->remove(*this);
+}
+
+auto Sorcery::Overlay::operator=(const bool value) -> Overlay & {
+
+	if (value == _active)
+		return *this;
+
+	if (_stack == nullptr)
+		_active = value;
+	else if (value)
+		_stack->push(*this);
+	else
+		_stack->remove(*this);
+
+	return *this;
+}
+
+Sorcery::Overlay::operator bool() const noexcept {
+
+	return _active;
+}
+
+auto Sorcery::Overlay::name() const -> const std::string & {
+
+	return _name;
+}
+
+auto Sorcery::Overlay::set_draw(std::function<void()> draw) -> void {
+
+	_draw = std::move(draw);
+}
+
+Sorcery::OverlayStack::OverlayStack()
+	: _head{nullptr},
+	  _tail{nullptr},
+	  _cursor{nullptr},
+	  _size{0},
+	  _drawing{false} {}
+
+// Anything still open is simply detached (its owner may outlive the stack)
+Sorcery::OverlayStack::~OverlayStack() {
+
+	for (auto *overlay{_head}; overlay != nullptr;) {
+		auto *next{overlay->_next};
+		overlay->_prev = overlay->_next = nullptr;
+		overlay->_active = false;
+		overlay = next;
+	}
+}
+
+auto Sorcery::OverlayStack::push(Overlay &overlay) -> void {
+
+	if (overlay._active)
+		return;
+
+	overlay._prev = _tail;
+	overlay._next = nullptr;
+	if (_tail)
+		_tail->_next = &overlay;
+	else
+		_head = &overlay;
+	_tail = &overlay;
+	overlay._active = true;
+	++_size;
+
+	// Anything opened by the last overlay in a draw() is still drawn by it
+	if (_drawing && _cursor == nullptr)
+		_cursor = &overlay;
+}
+
+auto Sorcery::OverlayStack::remove(Overlay &overlay) -> void {
+
+	if (!overlay._active)
+		return;
+
+	// Keep any draw() in progress pointing at a node that is still linked
+	if (_cursor == &overlay)
+		_cursor = overlay._next;
+
+	if (overlay._prev)
+		overlay._prev->_next = overlay._next;
+	else
+		_head = overlay._next;
+	if (overlay._next)
+		overlay._next->_prev = overlay._prev;
+	else
+		_tail = overlay._prev;
+
+	overlay._prev = overlay._next = nullptr;
+	overlay._active = false;
+	--_size;
+}
+
+auto Sorcery::OverlayStack::close_all() -> void {
+
+	while (_tail)
+		remove(*_tail);
+}
+
+// Draw each open overlay from the bottom up; an overlay may close itself (or
+// any other) or open another whilst being drawn, and anything opened is drawn
+// in the same pass
+auto Sorcery::OverlayStack::draw() -> void {
+
+	_drawing = true;
+	_cursor = _head;
+	while (_cursor) {
+		auto *overlay{_cursor};
+		_cursor = overlay->_next;
+		if (overlay->_draw)
+			overlay->_draw();
+	}
+	_drawing = false;
+}
+
+auto Sorcery::OverlayStack::empty() const noexcept -> bool {
+
+	return _size == 0;
+}
+
+auto Sorcery::OverlayStack::size() const noexcept -> std::size_t {
+
+	return _size;
+}
+
+auto Sorcery::OverlayStack::top() const noexcept -> Overlay * {
+
+	return _tail;
+}
+
+auto Sorcery::OverlayStack::describe() const -> std::string {
+
+	std::string output{};
+	auto depth{0u};
+	for (auto *overlay{_head}; overlay != nullptr; overlay = overlay->_next)
+		output.append(std::format("{:>26}: {}\n", overlay->_name, depth++));
+
+	return output;
+}
@@ -31,10 +31,10 @@
 #include "types/component.hpp"
 
 Sorcery::Popup::Popup(Context &ctx, Component &component)
-	: _ctx{ctx},
+	: show{ctx.overlays, component.name},
+	  _ctx{ctx},
 	  _component{component} {
 
-	show = false;
 	_name = _component.name;
 }
 
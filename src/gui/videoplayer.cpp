@@ -29,6 +29,7 @@ Sorcery::VideoPlayer::VideoPlayer()
 	  _rgb_frame{nullptr},
 	  _packet{nullptr},
 	  _sws_ctx{nullptr},
+	  _input{},
 	  _rgb_buffer{},
 	  _gl_texture{0},
 	  _width{0},
@@ -43,12 +44,16 @@ Sorcery::VideoPlayer::~VideoPlayer() {
 	free_resources();
 }
 
-auto Sorcery::VideoPlayer::load(const std::string &filename) -> void {
+auto Sorcery::VideoPlayer::load(const Resource &resource) -> void {
 
 	free_resources();
 
-	if (avformat_open_input(&_format_ctx, filename.c_str(), nullptr, nullptr) <
-		0)
+	if (resource.packed()) {
+		_input = std::make_unique<PackedInput>(resource.data);
+		if (_input->open(&_format_ctx) < 0)
+			throw std::runtime_error{"Failed to open video file"};
+	} else if (avformat_open_input(&_format_ctx, resource.path.c_str(),
+								   nullptr, nullptr) < 0)
 		throw std::runtime_error{"Failed to open video file"};
 
 	if (avformat_find_stream_info(_format_ctx, nullptr) < 0)
@@ -121,6 +126,7 @@ auto Sorcery::VideoPlayer::free_resources() -> void {
 		avformat_close_input(&_format_ctx);
 		_format_ctx = nullptr;
 	}
+	_input.reset();
 	if (_sws_ctx) {
 		sws_freeContext(_sws_ctx);
 		_sws_ctx = nullptr;
@@ -42,7 +42,7 @@ Sorcery::Add::Add(Context &ctx)
 
 auto Sorcery::Add::_initialise() -> bool {
 
-	_ctx.controller->set_selected("add_selected", 0);
+	_ctx.controller->set_selected(CONTROL("add_selected"), 0);
 
 	return true;
 }
@@ -59,7 +59,7 @@ auto Sorcery::Add::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
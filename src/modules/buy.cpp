@@ -44,7 +44,7 @@ Sorcery::Buy::~Buy() {}
 
 auto Sorcery::Buy::_initialise() -> bool {
 
-	_ctx.controller->set_selected("buy_selected", -1);
+	_ctx.controller->set_selected(CONTROL("buy_selected"), -1);
 
 	return true;
 }
@@ -63,7 +63,7 @@ auto Sorcery::Buy::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -88,7 +88,7 @@ auto Sorcery::Buy::start() -> int {
 		_ctx.tick();
 
 		// Check for Buy Selected (remember +1 to selection)
-		if (_ctx.controller->get_selected("buy_selected") > -1) {
+		if (_ctx.controller->get_selected(CONTROL("buy_selected")) > -1) {
 
 			// Work out if we can buy the item (and if we can, do it!)
 
@@ -106,7 +106,7 @@ auto Sorcery::Buy::start() -> int {
 
 auto Sorcery::Buy::stop() -> int {
 
-	_ctx.controller->set_selected("buy_selected", -1);
+	_ctx.controller->set_selected(CONTROL("buy_selected"), -1);
 	_ctx.controller->go_to(Enums::Screen::STORE);
 
 	return 0;
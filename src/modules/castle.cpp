@@ -66,7 +66,7 @@ Sorcery::Castle::~Castle() {}
 
 auto Sorcery::Castle::_initialise() -> bool {
 
-	_ctx.controller->set_selected("party_panel_selected", 0);
+	_ctx.controller->set_selected(CONTROL("party_panel_selected"), 0);
 
 	return true;
 }
@@ -109,7 +109,7 @@ auto Sorcery::Castle::start() -> int {
 	while (!done) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(event, {.menu_key = true, .debug = true})) {
 
@@ -54,7 +54,7 @@ Sorcery::EdgeOfTown::~EdgeOfTown() {}
 
 auto Sorcery::EdgeOfTown::_initialise() -> bool {
 
-	_ctx.controller->set_selected("party_panel_selected", 0);
+	_ctx.controller->set_selected(CONTROL("party_panel_selected"), 0);
 
 	return true;
 }
@@ -97,7 +97,7 @@ auto Sorcery::EdgeOfTown::start(const int mode) -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(event, {.menu_key = true, .debug = true})) {
 
@@ -144,7 +144,7 @@ auto Sorcery::EdgeOfTown::start(const int mode) -> int {
 			if (result == ABORT_GAME)
 				return ABORT_GAME;
 			_restart->stop();
-			if (_ctx.controller->has_flag("want_restart_expedition"))
+			if (_ctx.controller->has_flag(CONTROL("want_restart_expedition")))
 				return RESTART_MAZE;
 		} else if (_ctx.controller->wants(Enums::Screen::ENGINE))
 			return EDGE_OF_TOWN_GO_TO_MAZE;
@@ -50,8 +50,8 @@ auto Sorcery::Heal::start() -> int {
 	_healing_done = false;
 	_heal_tick = 0;
 
-	_ctx.controller->unset_flag("heal_finished");
-	_ctx.controller->unset_text("heal_results");
+	_ctx.controller->unset_flag(CONTROL("heal_finished"));
+	_ctx.controller->unset_text(CONTROL("heal_results"));
 	_ctx.controller->go_to(Enums::Screen::HEAL);
 
 	show_immediately();
@@ -61,7 +61,7 @@ auto Sorcery::Heal::start() -> int {
 	while (true) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -91,7 +91,7 @@ auto Sorcery::Heal::start() -> int {
 
 			_healing_done = true;
 
-			_ctx.controller->set_flag("heal_finished");
+			_ctx.controller->set_flag(CONTROL("heal_finished"));
 		}
 
 		_ctx.ui->display(Enums::Screen::HEAL, stage);
@@ -129,7 +129,7 @@ auto Sorcery::Heal::_try_heal(int heal_char_id, int pay_char_id) -> bool {
 		heal_char.set_age(heal_char.get_age() + _ctx.get_random(D52));
 
 		_ctx.controller->set_text(
-			"heal_results",
+			CONTROL("heal_results"),
 			std::format("{} {} {}", _ctx.get_string("TEMPLE_HEALED_PREFIX"),
 						heal_char.get_name(),
 						_ctx.get_string("TEMPLE_HEALED_SUFFIX")));
@@ -153,7 +153,7 @@ auto Sorcery::Heal::_try_heal(int heal_char_id, int pay_char_id) -> bool {
 			heal_char.set_status(ASHES);
 
 			_ctx.controller->set_text(
-				"heal_results",
+				CONTROL("heal_results"),
 				std::format("{} {} {}",
 							_ctx.get_string("TEMPLE_OOPS_DEAD_PREFIX"),
 							heal_char.get_name(),
@@ -178,7 +178,7 @@ auto Sorcery::Heal::_try_heal(int heal_char_id, int pay_char_id) -> bool {
 			heal_char.set_location(TRAINING);
 
 			_ctx.controller->set_text(
-				"heal_results",
+				CONTROL("heal_results"),
 				std::format("{} {} {}",
 							_ctx.get_string("TEMPLE_OOPS_ASHES_PREFIX"),
 							heal_char.get_name(),
@@ -200,7 +200,7 @@ auto Sorcery::Heal::stop() -> int {
 		_heal_tick = 0;
 	}
 
-	_ctx.controller->unset_flag("heal_finished");
+	_ctx.controller->unset_flag(CONTROL("heal_finished"));
 	_ctx.controller->go_to(Enums::Screen::TEMPLE);
 
 	return 0;
@@ -44,7 +44,7 @@ Sorcery::Identify::~Identify() {}
 
 auto Sorcery::Identify::_initialise() -> bool {
 
-	_ctx.controller->set_selected("identify_selected", -1);
+	_ctx.controller->set_selected(CONTROL("identify_selected"), -1);
 
 	return true;
 }
@@ -60,7 +60,7 @@ auto Sorcery::Identify::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -82,7 +82,7 @@ auto Sorcery::Identify::start() -> int {
 		}
 
 		// Check for Buy Selected (remember +1 to selection)
-		if (_ctx.controller->get_selected("identify_selected") > -1) {
+		if (_ctx.controller->get_selected(CONTROL("identify_selected")) > -1) {
 
 			// Work out if we can sell the item (and if we can, do it!)
 
@@ -103,7 +103,7 @@ auto Sorcery::Identify::start() -> int {
 
 auto Sorcery::Identify::stop() -> int {
 
-	_ctx.controller->set_selected("identify_selected", -1);
+	_ctx.controller->set_selected(CONTROL("identify_selected"), -1);
 	_ctx.controller->go_to(Enums::Screen::STORE);
 
 	return 0;
@@ -52,7 +52,7 @@ Sorcery::Inn::~Inn() {}
 
 auto Sorcery::Inn::_initialise() -> bool {
 
-	_ctx.controller->set_selected("party_panel_selected", 0);
+	_ctx.controller->set_selected(CONTROL("party_panel_selected"), 0);
 
 	return true;
 }
@@ -94,7 +94,7 @@ auto Sorcery::Inn::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -71,7 +71,7 @@ auto Sorcery::Inspect::start(const int mode, const int start_char) -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -103,7 +103,7 @@ auto Sorcery::Inspect::start(const int mode, const int start_char) -> int {
 		_ctx.ui->display(Enums::Screen::INSPECT, mode);
 		_ctx.tick();
 
-		if (_ctx.controller->has_flag("select_previous_character")) {
+		if (_ctx.controller->has_flag(CONTROL("select_previous_character"))) {
 
 			const auto p_size{_ctx.game->state->get_party_size()};
 			const int char_id{
@@ -116,8 +116,9 @@ auto Sorcery::Inspect::start(const int mode, const int start_char) -> int {
 			_ctx.controller->set_character(
 				Enums::CharacterSlot::INSPECT,
 				_ctx.game->state->get_party_char(pos).value());
-			_ctx.controller->unset_flag("select_previous_character");
-		} else if (_ctx.controller->has_flag("select_next_character")) {
+			_ctx.controller->unset_flag(CONTROL("select_previous_character"));
+		} else if (_ctx.controller->has_flag(
+					   CONTROL("select_next_character"))) {
 
 			const auto p_size{_ctx.game->state->get_party_size()};
 			const int char_id{
@@ -130,7 +131,7 @@ auto Sorcery::Inspect::start(const int mode, const int start_char) -> int {
 			_ctx.controller->set_character(
 				Enums::CharacterSlot::INSPECT,
 				_ctx.game->state->get_party_char(pos).value());
-			_ctx.controller->unset_flag("select_next_character");
+			_ctx.controller->unset_flag(CONTROL("select_next_character"));
 		}
 	}
 
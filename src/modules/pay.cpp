@@ -49,7 +49,7 @@ Sorcery::Pay::~Pay() = default;
 
 auto Sorcery::Pay::_initialise() -> bool {
 
-	_ctx.controller->set_selected("party_panel_selected", 0);
+	_ctx.controller->set_selected(CONTROL("party_panel_selected"), 0);
 
 	return true;
 }
@@ -64,7 +64,7 @@ auto Sorcery::Pay::start() -> int {
 	while (true) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
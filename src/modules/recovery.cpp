@@ -161,7 +161,7 @@ auto Sorcery::Recovery::start(const int mode) -> int {
 	while (true) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -42,7 +42,7 @@ Sorcery::Remove::Remove(Context &ctx)
 
 auto Sorcery::Remove::_initialise() -> bool {
 
-	_ctx.controller->set_selected("remove_selected", 0);
+	_ctx.controller->set_selected(CONTROL("remove_selected"), 0);
 
 	return true;
 }
@@ -59,7 +59,7 @@ auto Sorcery::Remove::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
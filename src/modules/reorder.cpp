@@ -42,7 +42,7 @@ Sorcery::Reorder::Reorder(Context &ctx)
 
 auto Sorcery::Reorder::_initialise() -> bool {
 
-	_ctx.controller->set_selected("reorder_selected", 0);
+	_ctx.controller->set_selected(CONTROL("reorder_selected"), 0);
 
 	return true;
 }
@@ -59,7 +59,7 @@ auto Sorcery::Reorder::start(const int mode) -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -42,7 +42,7 @@ Sorcery::Restart::Restart(Context &ctx)
 
 auto Sorcery::Restart::_initialise() -> bool {
 
-	_ctx.controller->set_selected("restart_selected", 0);
+	_ctx.controller->set_selected(CONTROL("restart_selected"), 0);
 
 	return true;
 }
@@ -59,7 +59,7 @@ auto Sorcery::Restart::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -83,7 +83,7 @@ auto Sorcery::Restart::start() -> int {
 		_ctx.ui->display(Enums::Screen::RESTART, _ctx.game);
 		_ctx.tick();
 
-		if (_ctx.controller->has_flag("want_restart_expedition")) {
+		if (_ctx.controller->has_flag(CONTROL("want_restart_expedition"))) {
 			return RESTART_MAZE;
 		} else if (!_ctx.controller->wants(Enums::Screen::RESTART) &&
 				   _ctx.controller->wants(Enums::Screen::EDGEOFTOWN))
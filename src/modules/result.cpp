@@ -55,7 +55,7 @@ auto Sorcery::Result::start(const ResultType type, const int mode) -> int {
 	while (true) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
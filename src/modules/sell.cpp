@@ -44,7 +44,7 @@ Sorcery::Sell::~Sell() {}
 
 auto Sorcery::Sell::_initialise() -> bool {
 
-	_ctx.controller->set_selected("sell_selected", -1);
+	_ctx.controller->set_selected(CONTROL("sell_selected"), -1);
 
 	return true;
 }
@@ -63,7 +63,7 @@ auto Sorcery::Sell::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -85,7 +85,7 @@ auto Sorcery::Sell::start() -> int {
 		}
 
 		// Check for Buy Selected (remember +1 to selection)
-		if (_ctx.controller->get_selected("sell_selected") > -1) {
+		if (_ctx.controller->get_selected(CONTROL("sell_selected")) > -1) {
 
 			// Work out if we can sell the item (and if we can, do it!)
 
@@ -106,7 +106,7 @@ auto Sorcery::Sell::start() -> int {
 
 auto Sorcery::Sell::stop() -> int {
 
-	_ctx.controller->set_selected("sell_selected", -1);
+	_ctx.controller->set_selected(CONTROL("sell_selected"), -1);
 	_ctx.controller->go_to(Enums::Screen::STORE);
 
 	return 0;
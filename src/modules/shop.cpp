@@ -49,7 +49,7 @@ Sorcery::Shop::Shop(Context &ctx)
 
 auto Sorcery::Shop::_initialise() -> bool {
 
-	_ctx.controller->set_selected("party_panel_selected", 0);
+	_ctx.controller->set_selected(CONTROL("party_panel_selected"), 0);
 
 	return true;
 }
@@ -90,7 +90,7 @@ auto Sorcery::Shop::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
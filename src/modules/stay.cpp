@@ -50,7 +50,7 @@ Sorcery::Stay::~Stay() {}
 
 auto Sorcery::Stay::_initialise() -> bool {
 
-	_ctx.controller->set_selected("room_selected", -1);
+	_ctx.controller->set_selected(CONTROL("room_selected"), -1);
 
 	return true;
 }
@@ -67,7 +67,7 @@ auto Sorcery::Stay::start() -> int {
 	while (true) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -90,7 +90,8 @@ auto Sorcery::Stay::start() -> int {
 		_ctx.ui->display(Enums::Screen::STAY, _ctx.game);
 		_ctx.tick();
 
-		const auto room{_ctx.controller->get_selected("room_selected")};
+		const auto room{
+			_ctx.controller->get_selected(CONTROL("room_selected"))};
 
 		constexpr std::array recovery_modes{
 			RECOVERY_MODE_FREE,		RECOVERY_MODE_COST_10,
@@ -157,7 +158,7 @@ auto Sorcery::Stay::start() -> int {
 
 auto Sorcery::Stay::stop() -> int {
 
-	_ctx.controller->set_selected("room_selected", -1);
+	_ctx.controller->set_selected(CONTROL("room_selected"), -1);
 	_ctx.controller->go_to(Enums::Screen::INN);
 
 	return 0;
@@ -54,7 +54,7 @@ Sorcery::Store::~Store() {}
 
 auto Sorcery::Store::_initialise() -> bool {
 
-	_ctx.controller->set_selected("store_selected", -1);
+	_ctx.controller->set_selected(CONTROL("store_selected"), -1);
 
 	return true;
 }
@@ -73,7 +73,7 @@ auto Sorcery::Store::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -135,7 +135,7 @@ auto Sorcery::Store::start() -> int {
 
 auto Sorcery::Store::stop() -> int {
 
-	_ctx.controller->unset_flag("want_pool_gold");
+	_ctx.controller->unset_flag(CONTROL("want_pool_gold"));
 	_ctx.controller->clear_character(Enums::CharacterSlot::STORE);
 	_ctx.controller->go_to(Enums::Screen::SHOP);
 
@@ -50,7 +50,7 @@ Sorcery::Temple::~Temple() = default;
 
 auto Sorcery::Temple::_initialise() -> bool {
 
-	_ctx.controller->set_selected("party_panel_selected", 0);
+	_ctx.controller->set_selected(CONTROL("party_panel_selected"), 0);
 
 	return true;
 }
@@ -65,7 +65,7 @@ auto Sorcery::Temple::start() -> int {
 	while (true) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -44,7 +44,7 @@ Sorcery::Uncurse::~Uncurse() {}
 
 auto Sorcery::Uncurse::_initialise() -> bool {
 
-	_ctx.controller->set_selected("uncurse_selected", -1);
+	_ctx.controller->set_selected(CONTROL("uncurse_selected"), -1);
 
 	return true;
 }
@@ -60,7 +60,7 @@ auto Sorcery::Uncurse::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -81,7 +81,7 @@ auto Sorcery::Uncurse::start() -> int {
 				return BACK_TO_STORE;
 		}
 
-		if (_ctx.controller->get_selected("uncurse_selected") > -1) {
+		if (_ctx.controller->get_selected(CONTROL("uncurse_selected")) > -1) {
 
 			// Work out if we can sell the item (and if we can, do it!)
 
@@ -102,7 +102,7 @@ auto Sorcery::Uncurse::start() -> int {
 
 auto Sorcery::Uncurse::stop() -> int {
 
-	_ctx.controller->set_selected("uncurse_selected", -1);
+	_ctx.controller->set_selected(CONTROL("uncurse_selected"), -1);
 	_ctx.controller->go_to(Enums::Screen::STORE);
 
 	return 0;
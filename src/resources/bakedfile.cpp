@@ -0,0 +1,272 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "resources/bakedfile.hpp"
+#include "core/debug.hpp"
+#include "resources/define.hpp"
+
+#include <concepts>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// Magic, version and section count; each section is then its key, the size
+// and hash of the JSON it was baked from, its schema and its data, and the
+// file ends with a hash of everything before it. Integers are all
+// little-endian
+static_assert(Sorcery::BAKE_VERSION == 3,
+			  "The baked layout has changed, update write() and _index()");
+constexpr std::size_t HEADER_SIZE{8};
+constexpr std::size_t TRAILER_SIZE{8};
+
+template <std::unsigned_integral T>
+auto put_integer(std::string &output, const T value) -> void {
+
+	for (auto i = 0u; i < sizeof(T); i++)
+		output.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+template <std::unsigned_integral T>
+auto get_integer(const std::span<const std::byte> input, std::size_t &position)
+	-> T {
+
+	if (input.size() - position < sizeof(T))
+		throw std::runtime_error{"Baked data is truncated"};
+
+	T value{};
+	for (auto i = 0u; i < sizeof(T); i++)
+		value |= static_cast<T>(std::to_integer<unsigned char>(
+					 input[position + i]))
+				 << (i * 8);
+	position += sizeof(T);
+
+	return value;
+}
+
+auto fnv1a(const std::span<const std::byte> bytes,
+		   std::uint64_t hash = 14695981039346656037ull) -> std::uint64_t {
+
+	for (const auto byte : bytes) {
+		hash ^= std::to_integer<unsigned char>(byte);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+auto as_bytes(const std::string_view value) -> std::span<const std::byte> {
+
+	return std::as_bytes(std::span{value.data(), value.size()});
+}
+
+// The size and hash of a JSON file (loose ones are read just to be hashed,
+// which is still far cheaper than parsing them)
+auto fingerprint(const Sorcery::Resource &source)
+	-> std::optional<std::pair<std::uint64_t, std::uint64_t>> {
+
+	if (source.packed())
+		return std::pair{source.data.size(), fnv1a(source.data)};
+
+	std::ifstream file{source.path, std::ios::binary};
+	if (!file.is_open())
+		return std::nullopt;
+
+	const std::string contents{std::istreambuf_iterator<char>(file), {}};
+
+	return std::pair{contents.size(), fnv1a(as_bytes(contents))};
+}
+
+}
+
+Sorcery::BakedFile::BakedFile(const Resource &resource) {
+
+	// Loose files are read in one go; packed ones are used where they are
+	if (resource.packed())
+		_data = resource.data;
+	else {
+		std::ifstream file{resource.path, std::ios::binary | std::ios::ate};
+		if (file.is_open()) {
+			_buffer.resize(static_cast<std::size_t>(file.tellg()));
+			file.seekg(0);
+			if (file.read(reinterpret_cast<char *>(_buffer.data()),
+						  static_cast<std::streamsize>(_buffer.size())))
+				_data = _buffer;
+		}
+	}
+
+	if (_data.empty())
+		return;
+
+	if (!_index()) {
+		DEBUG_LOGF("Ignoring invalid baked data: {}", resource.path.string());
+		_entries.clear();
+		_buffer.clear();
+		_data = {};
+	}
+}
+
+auto Sorcery::BakedFile::is_open() const -> bool {
+
+	return !_entries.empty();
+}
+
+// Empty unless there is a section for the key and it was baked from exactly
+// the JSON that is in use now
+auto Sorcery::BakedFile::get(std::string_view key, const Resource &source,
+							 const std::uint64_t schema) const
+	-> std::span<const std::byte> {
+
+	const auto it{_entries.find(key)};
+	if (it == _entries.end())
+		return {};
+
+	const auto &entry{it->second};
+	if (entry.schema != schema) {
+		DEBUG_LOGF("Baked {} was made by another version, using the JSON", key);
+		return {};
+	}
+
+	const std::pair baked{entry.source_size, entry.source_hash};
+	if (fingerprint(source) != baked) {
+		DEBUG_LOGF("Baked {} is out of date, using the JSON", key);
+		return {};
+	}
+
+	return entry.data;
+}
+
+auto Sorcery::BakedFile::section(std::string_view key, const Resource &source,
+								 const std::uint64_t schema, std::string data)
+	-> Section {
+
+	const auto print{fingerprint(source)};
+	if (!print)
+		throw std::runtime_error{
+			std::format("Unable to read {}", source.path.string())};
+
+	return Section{.key = std::string{key},
+				   .source_size = print->first,
+				   .source_hash = print->second,
+				   .schema = schema,
+				   .data = std::move(data)};
+}
+
+auto Sorcery::BakedFile::schema(const std::size_t size,
+								const std::size_t alignment,
+								const std::uint32_t revision) -> std::uint64_t {
+
+	std::string print{};
+	put_integer(print, static_cast<std::uint64_t>(size));
+	put_integer(print, static_cast<std::uint64_t>(alignment));
+	put_integer(print, revision);
+
+	return fnv1a(as_bytes(print));
+}
+
+auto Sorcery::BakedFile::write(const std::filesystem::path &filename,
+							   const std::vector<Section> &sections) -> void {
+
+	if (sections.size() > std::numeric_limits<std::uint16_t>::max())
+		throw std::length_error{"Too many baked sections"};
+
+	std::string output{BAKE_MAGIC};
+	put_integer(output, BAKE_VERSION);
+	put_integer(output, static_cast<std::uint16_t>(sections.size()));
+	for (const auto &section : sections) {
+		put_integer(output, static_cast<std::uint32_t>(section.key.size()));
+		output.append(section.key);
+		put_integer(output, section.source_size);
+		put_integer(output, section.source_hash);
+		put_integer(output, section.schema);
+		put_integer(output, static_cast<std::uint64_t>(section.data.size()));
+		output.append(section.data);
+	}
+	put_integer(output, fnv1a(as_bytes(output)));
+
+	const std::filesystem::path temporary_file{filename.string() + ".tmp"};
+	{
+		std::ofstream file{temporary_file, std::ios::binary | std::ios::trunc};
+		if (!file.write(output.data(),
+						static_cast<std::streamsize>(output.size())))
+			throw std::runtime_error{std::format(
+				"Unable to write baked data: {}", temporary_file.string())};
+	}
+
+	std::filesystem::rename(temporary_file, filename);
+}
+
+auto Sorcery::BakedFile::_index() -> bool {
+
+	try {
+
+		if (_data.size() < HEADER_SIZE + TRAILER_SIZE)
+			return false;
+
+		const std::string_view magic{
+			reinterpret_cast<const char *>(_data.data()), BAKE_MAGIC.size()};
+		if (magic != BAKE_MAGIC)
+			return false;
+
+		const auto body{_data.first(_data.size() - TRAILER_SIZE)};
+		auto position{body.size()};
+		if (get_integer<std::uint64_t>(_data, position) != fnv1a(body))
+			return false;
+
+		position = BAKE_MAGIC.size();
+		if (get_integer<std::uint16_t>(body, position) != BAKE_VERSION)
+			return false;
+
+		const auto count{get_integer<std::uint16_t>(body, position)};
+		for (auto i = 0u; i < count; i++) {
+			const auto key_size{get_integer<std::uint32_t>(body, position)};
+			if (body.size() - position < key_size)
+				return false;
+			std::string key{reinterpret_cast<const char *>(&body[position]),
+							key_size};
+			position += key_size;
+
+			Entry entry{};
+			entry.source_size = get_integer<std::uint64_t>(body, position);
+			entry.source_hash = get_integer<std::uint64_t>(body, position);
+			entry.schema = get_integer<std::uint64_t>(body, position);
+			const auto size{get_integer<std::uint64_t>(body, position)};
+			if (body.size() - position < size)
+				return false;
+			entry.data = body.subspan(position, size);
+			position += size;
+
+			_entries.insert_or_assign(std::move(key), entry);
+		}
+
+		return position == body.size();
+
+	} catch (const std::exception &) {
+		return false;
+	}
+}
@@ -20,7 +20,12 @@
 // the licensors of this program grant you additional permission to convey
 // the resulting work.
 
+#include <algorithm>
 #include <fstream>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
 
 #include "common/macro.hpp"
 #include "core/system.hpp"
@@ -30,48 +35,68 @@
 #include "types/state.hpp"
 #include <jsoncpp/json/json.h>
 
+// Marks a handle that has not been resolved against the current layout yet
+static constexpr auto UNRESOLVED_SLOT{std::numeric_limits<std::size_t>::max()};
+
 // Standard Constructor
-Sorcery::ComponentStore::ComponentStore(const std::filesystem::path filename) {
+Sorcery::ComponentStore::ComponentStore(const Resource resource)
+	: _file{resource} {
 
 	_grid_w = 16;
 	_grid_h = 16;
-
-	_loaded = load(filename);
-	if (_loaded) {
-		_last_load = std::chrono::file_clock::now();
-		_file = filename;
-		_last_mod = std::filesystem::last_write_time(_file);
+	_generation = 1;
+
+	_loaded = load(_file, _layout);
+	if (!_loaded)
+		return;
+
+	// A modded layout may leave some out, which only matters if they are used
+	// (get() fails loudly then), but in a debug build a typo should stop us
+	if (const auto missing{_missing(_layout)}; !missing.empty()) {
+		for (const auto &key : missing)
+			std::cerr << std::format("Component '{}' is not in layout.json\n",
+									 key);
+#ifdef SORCERY_DEBUG
+		throw std::runtime_error{
+			std::format("layout.json is missing {} components: {}",
+						missing.size(), std::views::join_with(missing, ", ") |
+											std::ranges::to<std::string>())};
+#endif
 	}
 }
 
-auto Sorcery::ComponentStore::get(std::string_view combined_key)
+// Handles are resolved the first time they are used, and as what they resolve
+// to never moves, that is cached for good
+auto Sorcery::ComponentStore::get(const ComponentHandle &handle)
 	-> Component & {
 
-	// swap into _load instead and check if refresh needed is called unnecessary
+	if (handle.id() >= _slots.size())
+		_slots.resize(ComponentHandle::count(), nullptr);
+
+	auto &slot{_slots[handle.id()]};
 	try {
 
-		// First check if we need to reload if anything has changed!
-		if (need_refresh())
-			load(_file);
+		if (!slot)
+			slot = &_hold(handle.key());
 
-	} catch (std::exception &e) {
+		return *slot;
 
-		Error error{Enums::System::Error::JSON_PARSE_ERROR, e,
-					"layout.json is not valid JSON!"};
+	} catch (std::exception &e) {
+		Error error{Enums::System::Error::UNKNOWN_COMPONENT, e,
+					std::format("Unable to find Component '{}' in layout.json!",
+								handle.key())};
 		std::cerr << error;
 		exit(EXIT_FAILURE);
 	}
+}
+
+auto Sorcery::ComponentStore::get(std::string_view combined_key)
+	-> Component & {
 
 	try {
 
-		// Else return the requested component
-		if (_loaded)
-			if (_components.contains(std::string{combined_key}))
-				return _components.at(std::string{combined_key});
-			else
-				return _components.begin()->second;
-		else
-			return _components.begin()->second;
+		// Return the requested component
+		return _hold(combined_key);
 
 	} catch (std::exception &e) {
 		Error error{Enums::System::Error::UNKNOWN_COMPONENT, e,
@@ -82,75 +107,188 @@ auto Sorcery::ComponentStore::get(std::string_view combined_key)
 	}
 }
 
-// Overload () Operator
-auto Sorcery::ComponentStore::operator()(std::string_view screen)
-	-> std::optional<std::vector<Component>> {
+// Overload () Operator (the automatically drawn components of a screen)
+auto Sorcery::ComponentStore::operator()(std::string_view screen) const
+	-> std::span<const Component> {
+
+	if (const auto it{_layout.screens.find(screen)};
+		_loaded && it != _layout.screens.end())
+		return std::span{_layout.components}.subspan(
+			it->second.automatic, it->second.automatic_size);
+
+	return {};
+}
+
+auto Sorcery::ComponentStore::get_custom(std::string_view screen) const
+	-> std::span<const Component> {
 
-	// First check if we need to reload if anything has changed!
-	if (need_refresh())
-		load(_file);
+	if (const auto it{_layout.screens.find(screen)};
+		_loaded && it != _layout.screens.end())
+		return std::span{_layout.components}.subspan(
+			it->second.manual, it->second.manual_size);
 
-	// Else return the requested components for the screen
-	std::vector<Component> results;
-	if (_loaded) {
+	return {};
+}
 
-		for (const auto &[unique_key, component] : _components) {
-			if ((component.form == screen) &&
-				(component.drawmode == Enums::Layout::DrawMode::AUTOMATIC)) {
-				results.push_back(component);
-			}
-		}
+auto Sorcery::ComponentStore::get_resource() const -> const Resource & {
 
-		// Sort by priority
-		std::sort(results.begin(), results.end(),
-				  [](const auto &first, const auto &second) {
-					  return first.priority < second.priority;
-				  });
+	return _file;
+}
 
-		return results;
-	}
+auto Sorcery::ComponentStore::all() const -> std::span<const Component> {
 
-	return std::nullopt;
+	return _layout.components;
 }
 
-auto Sorcery::ComponentStore::get_custom(std::string_view screen)
-	-> std::optional<std::vector<Component>> {
+// Bumped whenever the layout is reloaded, so that anything derived from the
+// components (such as the UI's LayoutCache) knows to rebuild itself
+auto Sorcery::ComponentStore::generation() const -> std::uint64_t {
 
-	// First check if we need to reload if anything has changed!
-	if (need_refresh())
-		load(_file);
+	return _generation;
+}
 
-	// Else return the requested components for the screen
-	std::vector<Component> results;
-	if (_loaded) {
+// Called from the FileWatcher thread when the layout file has changed - the
+// new layout is parsed into a staging area and swapped in by commit() later
+auto Sorcery::ComponentStore::reparse() -> void {
 
-		for (const auto &[unique_key, component] : _components) {
-			if ((component.form == screen) &&
-				(component.drawmode == Enums::Layout::DrawMode::MANUAL)) {
-				results.push_back(component);
-			}
+	auto staged{std::make_unique<Layout>()};
+	try {
+
+		if (!load(_file, *staged)) {
+			std::cerr << "layout.json is not valid JSON, not reloading!\n";
+			return;
 		}
 
-		// Sort by priority
-		std::sort(results.begin(), results.end(),
-				  [](const auto &first, const auto &second) {
-					  return first.priority < second.priority;
-				  });
+	} catch (std::exception &e) {
 
-		return results;
+		// Keep the existing layout so it can be fixed whilst still running
+		Error error{Enums::System::Error::JSON_PARSE_ERROR, e,
+					"layout.json is not valid JSON!"};
+		std::cerr << error;
+		return;
+	}
+
+	std::scoped_lock<std::mutex> scoped_lock(_staged_mutex);
+	_staged = std::move(staged);
+}
+
+// Called on the main thread at a frame boundary. Widgets hold on to what
+// get() gave them, so those components are updated in place from the new
+// layout rather than replaced (any no longer in it keep their last definition)
+auto Sorcery::ComponentStore::commit() -> void {
+
+	std::unique_ptr<Layout> staged;
+	{
+		std::scoped_lock<std::mutex> scoped_lock(_staged_mutex);
+		staged = std::move(_staged);
 	}
+	if (!staged)
+		return;
+
+	// Keep the existing layout rather than swap in one that the code can't
+	// use, so that it can be fixed whilst still running
+	if (const auto missing{_missing(*staged)}; !missing.empty()) {
+		for (const auto &key : missing)
+			std::cerr << std::format("Unknown Component '{}' in layout.json, "
+									 "not reloading!\n",
+									 key);
+		return;
+	}
+
+	_layout = std::move(*staged);
+	for (auto &[key, component] : _held)
+		if (const auto it{_layout.index.find(key)}; it != _layout.index.end())
+			component = _layout.components[it->second];
 
-	return std::nullopt;
+	_loaded = true;
+	_generation++;
 }
 
-auto Sorcery::ComponentStore::load(const std::filesystem::path filename)
+// The copy of a component that get() hands out, made the first time it is
+// asked for; std::map never moves these, so references to them stay valid
+auto Sorcery::ComponentStore::_hold(std::string_view combined_key)
+	-> Component & {
+
+	if (const auto it{_held.find(combined_key)}; it != _held.end())
+		return it->second;
+
+	const auto &component{_layout.components.at(_resolve(combined_key))};
+
+	return _held.try_emplace(std::string{combined_key}, component)
+		.first->second;
+}
+
+// Unknown keys are left unresolved, so that using one fails (loudly) in get()
+auto Sorcery::ComponentStore::_resolve(std::string_view combined_key) const
+	-> std::size_t {
+
+	if (const auto it{_layout.index.find(combined_key)};
+		_loaded && it != _layout.index.end())
+		return it->second;
+
+	return UNRESOLVED_SLOT;
+}
+
+// Every key named in the code is interned before the layout is loaded, so
+// this checks all of them against it and a typo in either is flagged at once
+auto Sorcery::ComponentStore::_missing(const Layout &layout) const
+	-> std::vector<std::string> {
+
+	std::vector<std::string> missing{};
+	for (auto id = 0u; id < ComponentHandle::count(); id++)
+		if (const auto key{ComponentHandle::key_of(id)};
+			!layout.index.contains(key))
+			missing.emplace_back(key);
+
+	return missing;
+}
+
+// Flatten the parsed components into one array, ordered so that each screen
+// has its automatic and its manual components in two contiguous runs, both
+// sorted by priority
+auto Sorcery::ComponentStore::_build(std::map<std::string, Component> &parsed,
+									 Layout &layout) const -> void {
+
+	layout.components.clear();
+	layout.index.clear();
+	layout.screens.clear();
+
+	layout.components.reserve(parsed.size());
+	for (auto &[key, component] : parsed)
+		layout.components.emplace_back(std::move(component));
+
+	std::ranges::sort(layout.components, [](const auto &first,
+											const auto &second) {
+		return std::tie(first.form, first.drawmode, first.priority,
+						first.name) < std::tie(second.form, second.drawmode,
+											   second.priority, second.name);
+	});
+
+	using enum Enums::Layout::DrawMode;
+	for (auto i = 0u; i < layout.components.size(); i++) {
+		auto &component{layout.components[i]};
+		component.slot = i;
+		layout.index.emplace(
+			std::format("{}:{}", component.form, component.name), i);
+
+		auto &screen{layout.screens[component.form]};
+		if (component.drawmode == AUTOMATIC) {
+			if (screen.automatic_size++ == 0)
+				screen.automatic = i;
+		} else if (component.drawmode == MANUAL) {
+			if (screen.manual_size++ == 0)
+				screen.manual = i;
+		}
+	}
+}
+
+auto Sorcery::ComponentStore::load(const Resource &resource, Layout &layout)
 	-> bool {
 
-	_components.clear();
+	std::map<std::string, Component> components{};
 
 	// Attempt to load Layout File
-	if (std::ifstream file{filename.string(), std::ifstream::binary};
-		file.good()) {
+	if (auto file{resource.stream()}; file->good()) {
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -158,7 +296,7 @@ auto Sorcery::ComponentStore::load(const std::filesystem::path filename)
 #pragma GCC diagnostic pop
 		Json::StreamWriterBuilder builder{};
 		builder.settings_["indentation"] = "";
-		if (Json::Value layout; reader.parse(file, layout)) {
+		if (Json::Value layout; reader.parse(*file, layout)) {
 			Json::Value &forms{layout["form"]};
 
 			// Iterate through layout file one screen at a time
@@ -408,11 +546,14 @@ auto Sorcery::ComponentStore::load(const std::filesystem::path filename)
 						for (auto data_keys{extra_data.getMemberNames()};
 							 auto &data_key : data_keys) {
 							auto data_value{extra_data[data_key].asString()};
-							component.set(data_key, data_value);
+							if (!component.set(data_key, data_value))
+								throw std::runtime_error{std::format(
+									"Invalid value '{}' for '{}' in {}",
+									data_value, data_key, key)};
 						}
 					}
 
-					_components[key] = component;
+					components[key] = component;
 				}
 			}
 		} else
@@ -420,11 +561,8 @@ auto Sorcery::ComponentStore::load(const std::filesystem::path filename)
 	} else
 		return false;
 
+	_build(components, layout);
+
 	return true;
 }
 
-auto Sorcery::ComponentStore::need_refresh() -> bool {
-
-	_last_mod = std::filesystem::last_write_time(_file);
-	return _last_mod > _last_load;
-}
@@ -24,9 +24,11 @@
 #include "common/define.hpp"
 #include "core/debug.hpp"
 #include "resources/define.hpp"
+#include <algorithm>
 #include <array>
 #include <libgen.h>
 #include <limits.h>
+#include <print>
 #include <sstream>
 #include <stdexcept>
 #include <system_error>
@@ -70,7 +72,9 @@ Sorcery::FileStore::FileStore() {
 
 	// Save Files (not required, as they may not exist yet)
 	_add_path(SAVE_DIR, SAVE_GAME_FILE, false);
+	_add_path(SAVE_DIR, SAVE_LEGACY_GAME_FILE, false);
 	_add_path(SAVE_DIR, SAVE_STATES_DIR, SAVE_STATE_FILENAME, false);
+	_add_path(SAVE_DIR, SAVE_STATES_DIR, REPLAY_FILENAME, false);
 
 	// Data Files (required)
 	_add_path(DATA_DIR, ITEMS_FILE);
@@ -87,6 +91,9 @@ Sorcery::FileStore::FileStore() {
 	_add_path(DATA_DIR, STRINGS_FILE);
 	_add_path(DATA_DIR, TEXT_FONT_FILE);
 
+	// Baked Data (optional, see sorcery-bake)
+	_add_path(DATA_DIR, BAKE_FILE, false);
+
 	// Document Files (required)
 	_add_path(DOCUMENTS_DIR, LICENSE_FILE);
 	_add_path(DOCUMENTS_DIR, COMPILE_FILE);
@@ -111,6 +118,10 @@ Sorcery::FileStore::FileStore() {
 	// Video Files (required)
 	_add_path(VFX_DIR, MAINMENU_VIDEO);
 
+	// Use the resource pack if there is one (loose files are still used for
+	// anything not in it, so deleting the pack is all that is needed to mod)
+	_open_pack();
+
 	// Validate that all required files and directories exist
 	_validate_files();
 }
@@ -133,6 +144,60 @@ auto Sorcery::FileStore::get_path(const std::string_view key) const
 									  : std::string{FILE_NOT_FOUND};
 }
 
+// Prefer the packed copy of a file if there is one, unless the loose copy has
+// been edited since the pack was written (so that editing the data works
+// without having to remember to delete or rebuild the pack)
+auto Sorcery::FileStore::get_resource(const std::string_view key) const
+	-> Resource {
+
+	const auto path{get(key)};
+	if (!_pack.contains(key))
+		return Resource{path};
+
+	std::error_code error;
+	if (const auto modified{std::filesystem::last_write_time(path, error)};
+		!error && modified > _pack_time) {
+		std::println(stderr, "{} is newer than {}, using it instead",
+					 path.string(), PACK_FILE);
+		return Resource{path};
+	}
+
+	return Resource{path, _pack.get(key)};
+}
+
+auto Sorcery::FileStore::is_packed() const -> bool {
+
+	return _pack.is_open();
+}
+
+auto Sorcery::FileStore::get_packed_keys() const -> std::vector<std::string> {
+
+	return _pack.keys();
+}
+
+// Write every required read-only file (i.e. everything except config) into a
+// new resource pack next to the executable, returning the number packed
+auto Sorcery::FileStore::write_pack() const -> std::size_t {
+
+	std::vector<std::pair<std::string, std::filesystem::path>> files;
+	for (const auto &file : _required_files) {
+		if (file.parent_path().filename() == CONFIG_DIR)
+			continue;
+
+		files.emplace_back(file.filename().string(), file);
+	}
+
+	// Baked data is read-only too, so goes in if it has been made
+	std::error_code error;
+	if (const auto baked{get(BAKE_FILE)}; std::filesystem::exists(baked, error))
+		files.emplace_back(baked.filename().string(), baked);
+
+	std::ranges::sort(files);
+	ResourcePack::write(_base_path / PACK_FILE, files);
+
+	return files.size();
+}
+
 auto Sorcery::FileStore::get_directory(std::string_view key) const
 	-> std::filesystem::path {
 
@@ -207,6 +272,15 @@ auto Sorcery::FileStore::_add_path(const std::string_view dir,
 		_required_files.emplace_back(file_path);
 }
 
+auto Sorcery::FileStore::_open_pack() -> void {
+
+	const std::filesystem::path pack_path{_base_path / PACK_FILE};
+
+	std::error_code error;
+	if (std::filesystem::exists(pack_path, error) && _pack.open(pack_path))
+		_pack_time = std::filesystem::last_write_time(pack_path, error);
+}
+
 // Validate that all required files and directories exist
 auto Sorcery::FileStore::_validate_files() const -> void {
 
@@ -231,6 +305,10 @@ auto Sorcery::FileStore::_validate_files() const -> void {
 	for (const auto &file : _required_files) {
 		std::error_code error;
 
+		// No need to touch the disc for anything that is in the pack
+		if (_pack.contains(file.filename().string()))
+			continue;
+
 		DEBUG_LOGF("Checking required file: {}", file.string());
 
 		const bool exists{std::filesystem::exists(file, error)};
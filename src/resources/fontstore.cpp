@@ -25,9 +25,9 @@
 #include "core/context.hpp"
 #include "core/system.hpp"
 #include "resources/define.hpp"
+#include "resources/filestore.hpp"
 #include "types/config.hpp"
 
-#include <fstream>
 
 Sorcery::FontStore::FontStore(Context &ctx, ImGuiIO *io)
 	: _ctx(ctx),
@@ -74,12 +74,25 @@ auto Sorcery::FontStore::scan_and_load(const std::string &directory) -> void {
 	// Always load internal ImGui font
 	_default_font = _io->Fonts->AddFontDefault();
 
-	for (const auto &entry : std::filesystem::directory_iterator(directory)) {
-		if (!entry.is_regular_file())
-			continue;
+	// Fonts are taken from the resource pack if there is one, otherwise the
+	// directory is scanned for them
+	const auto is_ttf{[](const std::filesystem::path &path) {
+		return path.extension() == ".ttf" || path.extension() == ".TTF";
+	}};
+	std::vector<Resource> sources;
+	if (_ctx.files->is_packed()) {
+		for (const auto &key : _ctx.files->get_packed_keys())
+			if (is_ttf(key))
+				sources.emplace_back(_ctx.get_resource(key));
+	} else {
+		for (const auto &entry :
+			 std::filesystem::directory_iterator(directory))
+			if (entry.is_regular_file() && is_ttf(entry.path()))
+				sources.emplace_back(entry.path());
+	}
 
-		auto ext{entry.path().extension().string()};
-		auto stem{entry.path().stem().string()};
+	for (const auto &source : sources) {
+		auto stem{source.path.stem().string()};
 
 		using enum Enums::Layout::Font;
 		auto font_type{NO_FONT};
@@ -90,14 +103,14 @@ auto Sorcery::FontStore::scan_and_load(const std::string &directory) -> void {
 		else
 			font_type = MONOSPACE;
 
-		if (ext == ".ttf" || ext == ".TTF") {
-			const auto font_path{entry.path().string()};
-			if (_is_valid_ttf(font_path)) {
-				auto mono{_is_monospace_ttf(font_path)};
-				_load_font(font_path, mono, font_type);
-			} else {
-				std::cerr << "Invalid font skipped: " << font_path << "\n";
-			}
+		// Read each font just the once and then check it from memory
+		const auto buffer{source.bytes()};
+		if (_is_valid_ttf(buffer)) {
+			auto mono{_is_monospace_ttf(buffer)};
+			_load_font(source, buffer, mono, font_type);
+		} else {
+			std::cerr << "Invalid font skipped: " << source.path.string()
+					  << "\n";
 		}
 	}
 
@@ -115,16 +128,12 @@ auto Sorcery::FontStore::scan_and_load(const std::string &directory) -> void {
 	_io->Fonts->Build();
 }
 
-auto Sorcery::FontStore::_load_font(const std::string &path, bool is_monospace,
+auto Sorcery::FontStore::_load_font(const Resource &resource,
+									const std::vector<unsigned char> &buffer,
+									bool is_monospace,
 									Enums::Layout::Font font_type) -> void {
 
-	std::ifstream file(path, std::ios::binary);
-	if (!file.is_open())
-		return;
-
-	std::vector<unsigned char> buffer((std::istreambuf_iterator<char>(file)),
-									  {});
-
+	const auto path{resource.path.string()};
 	std::string name = _get_font_full_name(buffer);
 	if (name.empty())
 		name = std::filesystem::path(path).stem().string();
@@ -136,7 +145,15 @@ auto Sorcery::FontStore::_load_font(const std::string &path, bool is_monospace,
 
 	// Make the font available to ImGui at different sizes by setting the size
 	// to 0.0f and using ImGui::SetFontScale() when rendering text.
-	ImFont *font{_io->Fonts->AddFontFromFileTTF(path.c_str(), 0.0f, &config)};
+	// Packed fonts are used in place, as the pack outlives the font atlas
+	ImFont *font{nullptr};
+	if (resource.packed()) {
+		config.FontDataOwnedByAtlas = false;
+		font = _io->Fonts->AddFontFromMemoryTTF(
+			const_cast<std::byte *>(resource.data.data()),
+			static_cast<int>(resource.data.size()), 0.0f, &config);
+	} else
+		font = _io->Fonts->AddFontFromFileTTF(path.c_str(), 0.0f, &config);
 	if (!font) {
 
 		std::cerr << "Failed to load font: " << path << "\n";
@@ -147,11 +164,14 @@ auto Sorcery::FontStore::_load_font(const std::string &path, bool is_monospace,
 }
 
 // Attempt to validate a TTF font file by loading its header using stb_truetype
-auto Sorcery::FontStore::_is_valid_ttf(const std::string &path) const -> bool {
+auto Sorcery::FontStore::_is_valid_ttf(
+	const std::vector<unsigned char> &buffer) const -> bool {
 
 	FT_Face face = nullptr;
 
-	const FT_Error err = FT_New_Face(_ft, path.c_str(), 0, &face);
+	const FT_Error err =
+		FT_New_Memory_Face(_ft, buffer.data(),
+						   static_cast<FT_Long>(buffer.size()), 0, &face);
 
 	if (err != 0) {
 		return false;
@@ -188,12 +208,14 @@ auto Sorcery::FontStore::_get_font_full_name(
 }
 
 // Is a valid TTF font a monospace font?
-auto Sorcery::FontStore::_is_monospace_ttf(const std::string &path) const
-	-> bool {
+auto Sorcery::FontStore::_is_monospace_ttf(
+	const std::vector<unsigned char> &buffer) const -> bool {
 
 	FT_Face face = nullptr;
 
-	if (FT_New_Face(_ft, path.c_str(), 0, &face) != 0)
+	if (FT_New_Memory_Face(_ft, buffer.data(),
+						   static_cast<FT_Long>(buffer.size()), 0,
+						   &face) != 0)
 		return false;
 
 	// 1. Trust font metadata first
@@ -106,11 +106,11 @@ auto Sorcery::ImageStore::_load_image(const std::string &file) -> bool {
 		PROFILE_SCOPE("ImageStore::_load_image");
 		DEBUG_LOGF("Loading Resource: {}", file);
 
-		const auto path{_ctx.get_file(file)};
+		const auto resource{_ctx.get_resource(file)};
 
 		// If not loaded, load the image
 		Image image{};
-		_load_texture_from_disc(path.c_str(), &image.texture, &image.width,
+		_load_texture_from_disc(resource, &image.texture, &image.width,
 								&image.height);
 
 		_images.try_emplace(file, image);
@@ -121,7 +121,7 @@ auto Sorcery::ImageStore::_load_image(const std::string &file) -> bool {
 }
 
 // Load an image file from disk into a texture (using stb)
-auto Sorcery::ImageStore::_load_texture_from_disc(const char *filename,
+auto Sorcery::ImageStore::_load_texture_from_disc(const Resource &resource,
 												  GLuint *out_texture,
 												  int *out_width,
 												  int *out_height) -> bool {
@@ -132,9 +132,15 @@ auto Sorcery::ImageStore::_load_texture_from_disc(const char *filename,
 	int image_width{0};
 	int image_height{0};
 
-	// Get image data
+	// Get image data (decoding straight from the pack if it is in there)
 	unsigned char *image_data{
-		stbi_load(filename, &image_width, &image_height, nullptr, 4)};
+		resource.packed()
+			? stbi_load_from_memory(
+				  reinterpret_cast<const stbi_uc *>(resource.data.data()),
+				  static_cast<int>(resource.data.size()), &image_width,
+				  &image_height, nullptr, 4)
+			: stbi_load(resource.path.c_str(), &image_width, &image_height,
+						nullptr, 4)};
 	if (image_data == nullptr)
 		return false;
 
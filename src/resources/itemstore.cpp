@@ -26,25 +26,33 @@
 #include "common/macro.hpp"
 #include "core/context.hpp"
 #include "core/random.hpp"
+#include "resources/bakedfile.hpp"
+#include "resources/define.hpp"
 #include "resources/itemstore.hpp"
 #include "types/meta.hpp"
 #include <jsoncpp/json/json.h>
 
 // Standard Constructor
-Sorcery::ItemStore::ItemStore(Context &ctx,
-							  const std::filesystem::path filename)
+Sorcery::ItemStore::ItemStore(Context &ctx, const Resource resource,
+							  const BakedFile *baked)
 	: _ctx{ctx} {
 
 	_items.clear();
-
-	// Load the Item Definitions
-	_loaded = _load(filename);
+	_names.clear();
+
+	// Load the Item Definitions (the baked copy is used if it is current)
+	_loaded = baked &&
+			  BakedFile::unpack(
+				  baked->get(ITEMS_FILE, resource, bake_schema()), _items);
+	if (!_loaded)
+		_loaded = _load(resource);
+	if (_loaded)
+		_index();
 }
 
-auto Sorcery::ItemStore::_load(const std::filesystem::path filename) -> bool {
+auto Sorcery::ItemStore::_load(const Resource resource) -> bool {
 
-	if (std::ifstream file{filename.string(), std::ifstream::binary};
-		file.good()) {
+	if (auto file{resource.stream()}; file->good()) {
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -52,7 +60,7 @@ auto Sorcery::ItemStore::_load(const std::filesystem::path filename) -> bool {
 #pragma GCC diagnostic pop
 		Json::StreamWriterBuilder builder{};
 		builder.settings_["indentation"] = "";
-		if (Json::Value data; reader.parse(file, data)) {
+		if (Json::Value data; reader.parse(*file, data)) {
 			Json::Value &items{data["item"]};
 
 			// Iterate through item file one itemtype at a time
@@ -293,7 +301,12 @@ auto Sorcery::ItemStore::_load(const std::filesystem::path filename) -> bool {
 				item_type.set_buy(buy);
 				item_type.set_sell(sell);
 
-				_items[id.value()] = item_type;
+				// Item ids are contiguous from zero so a flat vector is a
+				// complete index
+				const auto index{std::to_underlying(id.value())};
+				if (index >= _items.size())
+					_items.resize(index + 1);
+				_items[index] = std::move(item_type);
 			}
 
 			return true;
@@ -306,50 +319,73 @@ auto Sorcery::ItemStore::_load(const std::filesystem::path filename) -> bool {
 }
 
 auto Sorcery::ItemStore::get(Enums::Items::TypeID item_type_id) const
-	-> ItemType {
+	-> const ItemType & {
 
-	return _items.at(item_type_id);
+	return _items.at(std::to_underlying(item_type_id));
 }
 
-auto Sorcery::ItemStore::get(unsigned int item_type_id) const -> ItemType {
+auto Sorcery::ItemStore::get(unsigned int item_type_id) const
+	-> const ItemType & {
 
-	return _items.at(enum_cast<Enums::Items::TypeID>(item_type_id).value());
+	return _items.at(item_type_id);
 }
 
 auto Sorcery::ItemStore::get_item_type(
-	const Enums::Items::TypeID item_type_id) const -> ItemType {
+	const Enums::Items::TypeID item_type_id) const -> const ItemType & {
 
-	return _items.at(item_type_id);
+	return get(item_type_id);
 }
 
-auto Sorcery::ItemStore::get(std::string_view name) const -> ItemType {
-
-	const auto it{std::ranges::find_if(_items, [name](const auto &item) {
-		return item.second.get_display_name() == name;
-	})};
+auto Sorcery::ItemStore::get(std::string_view name) const -> const ItemType & {
 
-	if (it == _items.end())
+	const auto it{_names.find(name)};
+	if (it == _names.end())
 		throw std::out_of_range{"Item not found: " + std::string{name}};
 
-	return it->second;
+	return get(it->second);
+}
+
+// Build the lookup tables once the items are loaded so that usability checks
+// and lookups by name never need to scan the whole store
+auto Sorcery::ItemStore::_index() -> void {
+
+	_names.clear();
+	_usability.assign(_items.size(), Usability{});
+
+	for (const auto &item_type : _items) {
+
+		// The first item with a given name wins
+		const auto id{item_type.get_type_id()};
+		_names.try_emplace(item_type.get_display_name(), id);
+
+		auto &usability{_usability[std::to_underlying(id)]};
+		const auto classes{item_type.get_usable_class()};
+		for (auto c = 0u; c < CLASSES; c++)
+			usability.classes[c] = classes[c];
+		const auto alignments{item_type.get_usable_alignment()};
+		for (auto a = 0u; a < ALIGNMENTS; a++)
+			usability.alignments[a] = alignments[a];
+		usability.usable = item_type.has_usable();
+		usability.invokable = item_type.has_invokable();
+	}
 }
 
-auto Sorcery::ItemStore::get(const Enums::Items::Category category) const
-	-> std::vector<ItemType> {
+// Everything loaded, for sorcery-bake to write out
+auto Sorcery::ItemStore::bake() const -> std::string {
 
-	std::vector<ItemType> items;
-	for (const auto &[key, value] : _items)
-		if (value.get_category() == category)
-			items.push_back(value);
+	return BakedFile::pack(_items);
+}
+
+auto Sorcery::ItemStore::bake_schema() -> std::uint64_t {
 
-	return items;
+	return BakedFile::schema<ItemType>(BAKE_ITEMS_REVISION);
 }
 
 // Public methods
 auto Sorcery::ItemStore::get_an_item(
 	const Enums::Items::TypeID item_type_id) const -> Item {
 
-	return Item{_items.at(item_type_id)};
+	return Item{get(item_type_id)};
 }
 
 auto Sorcery::ItemStore::is_usable(const Enums::Items::TypeID item_type_id,
@@ -357,32 +393,43 @@ auto Sorcery::ItemStore::is_usable(const Enums::Items::TypeID item_type_id,
 								   const Enums::Character::Align calign) const
 	-> bool {
 
-	return _items.at(item_type_id).is_class_usable(cclass) &&
-		   _items.at(item_type_id).is_align_usable(calign);
+	const auto &usability{_usability.at(std::to_underlying(item_type_id))};
+
+	return usability.classes.test(std::to_underlying(cclass)) &&
+		   usability.alignments.test(std::to_underlying(calign));
+}
+
+auto Sorcery::ItemStore::is_usable(const Enums::Items::TypeID item_type_id,
+								   const Enums::Character::Class cclass) const
+	-> bool {
+
+	const auto &usability{_usability.at(std::to_underlying(item_type_id))};
+
+	return usability.classes.test(std::to_underlying(cclass));
 }
 
 auto Sorcery::ItemStore::has_usable(
 	const Enums::Items::TypeID item_type_id) const -> bool {
 
-	return _items.at(item_type_id).has_usable();
+	return _usability.at(std::to_underlying(item_type_id)).usable;
 }
 
 auto Sorcery::ItemStore::sellable_price(
 	const Enums::Items::TypeID item_type_id) const -> unsigned int {
 
-	return _items.at(item_type_id).get_value() / 2;
+	return get(item_type_id).get_value() / 2;
 }
 
 auto Sorcery::ItemStore::sellable_to_shop(
 	const Enums::Items::TypeID item_type_id) const -> bool {
 
-	return _items.at(item_type_id).get_buy();
+	return get(item_type_id).get_buy();
 }
 
 auto Sorcery::ItemStore::has_invokable(
 	const Enums::Items::TypeID item_type_id) const -> bool {
 
-	return _items.at(item_type_id).has_invokable();
+	return _usability.at(std::to_underlying(item_type_id)).invokable;
 }
 
 auto Sorcery::ItemStore::get_random_item(
@@ -392,17 +439,12 @@ auto Sorcery::ItemStore::get_random_item(
 	auto item_type_id{_ctx.random->get(std::to_underlying(min_item_type_id),
 									   std::to_underlying(max_item_type_id))};
 
-	return Item{
-		_items.at(enum_cast<Enums::Items::TypeID>(item_type_id).value())};
+	return Item{_items.at(item_type_id)};
 }
 
-auto Sorcery::ItemStore::get_all_types() const -> std::vector<ItemType> {
-
-	std::vector<ItemType> items;
-	for (const auto &[key, value] : _items)
-		items.push_back(value);
+auto Sorcery::ItemStore::get_all_types() const -> std::span<const ItemType> {
 
-	return items;
+	return _items;
 }
 
 auto Sorcery::ItemStore::_get_defensive_effects(
@@ -434,10 +476,12 @@ auto Sorcery::ItemStore::_get_defensive_effects(
 					 i <= std::to_underlying(PROTECTION_VS_WERE); i++)
 					effects[i] = true;
 			};
-			auto def{enum_cast<Enums::Items::Effects::Defensive>(term)};
+			// A leading '!' removes an effect granted by an earlier term
+			const auto negated{term.starts_with('!')};
+			auto def{enum_cast<Enums::Items::Effects::Defensive>(
+				std::string_view{term}.substr(negated ? 1 : 0))};
 			if (def.has_value())
-				effects[std::to_underlying(def.value())] =
-					term.starts_with('!') ? false : true;
+				effects[std::to_underlying(def.value())] = !negated;
 		}
 	}
 
@@ -462,10 +506,12 @@ auto Sorcery::ItemStore::_get_offensive_effects(
 					split.end());
 
 		for (const auto &term : split) {
-			auto off{enum_cast<Enums::Items::Effects::Offensive>(term)};
+			// A leading '!' removes an effect granted by an earlier term
+			const auto negated{term.starts_with('!')};
+			auto off{enum_cast<Enums::Items::Effects::Offensive>(
+				std::string_view{term}.substr(negated ? 1 : 0))};
 			if (off.has_value())
-				effects[std::to_underlying(off.value())] =
-					term.starts_with('!') ? false : true;
+				effects[std::to_underlying(off.value())] = !negated;
 		}
 	}
 	return effects;
@@ -35,13 +35,13 @@ Sorcery::LevelStore::LevelStore() {
 }
 
 // Standard Constructor
-Sorcery::LevelStore::LevelStore(const std::filesystem::path filename) {
+Sorcery::LevelStore::LevelStore(const Resource resource) {
 
 	// Prepare the level store
 	_levels.clear();
 
 	// Load the levels
-	_loaded = _load(filename);
+	_loaded = _load(resource);
 }
 
 auto Sorcery::LevelStore::get(const int depth) const -> std::optional<Level> {
@@ -72,18 +72,17 @@ auto Sorcery::LevelStore::_get(const int depth) const -> std::optional<Level> {
 		return std::nullopt;
 }
 
-auto Sorcery::LevelStore::_load(const std::filesystem::path filename) -> bool {
+auto Sorcery::LevelStore::_load(const Resource resource) -> bool {
 
 	try {
 
-		if (std::ifstream file{filename.string(), std::ifstream::binary};
-			file.good()) {
+		if (auto file{resource.stream()}; file->good()) {
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 			Json::Reader reader{};
 #pragma GCC diagnostic pop
-			if (Json::Value layout; reader.parse(file, layout)) {
+			if (Json::Value layout; reader.parse(*file, layout)) {
 				Json::Value &regions{layout["regions"]};
 				std::string dungeon{regions[0]["name"].asString()};
 				Json::Value &layers{regions[0]["floors"]};
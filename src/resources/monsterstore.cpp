@@ -21,10 +21,12 @@
 // the resulting work.
 
 #include <fstream>
+#include <ranges>
 #include <regex>
 
 #include "common/enum.hpp"
 #include "common/macro.hpp"
+#include "resources/bakedfile.hpp"
 #include "resources/define.hpp"
 #include "resources/monsterstore.hpp"
 #include "types/meta.hpp"
@@ -32,19 +34,45 @@
 #include <jsoncpp/json/json.h>
 
 // Standard Constructor
-Sorcery::MonsterStore::MonsterStore(const std::filesystem::path filename) {
+Sorcery::MonsterStore::MonsterStore(const Resource resource,
+									const BakedFile *baked) {
 
 	_items.clear();
+	_names.clear();
+
+	// Load the Monster Definitions (the baked copy is used if it is current)
+	_loaded = baked &&
+			  BakedFile::unpack(
+				  baked->get(MONSTERS_FILE, resource, bake_schema()), _items);
+	if (!_loaded)
+		_loaded = _load(resource);
+	if (_loaded)
+		_index();
+}
+
+auto Sorcery::MonsterStore::_index() -> void {
+
+	_names.clear();
+	for (const auto &monster_type : _items)
+		_names.try_emplace(monster_type.get_known_name(),
+						   monster_type.get_type_id());
+}
+
+// Everything loaded, for sorcery-bake to write out
+auto Sorcery::MonsterStore::bake() const -> std::string {
+
+	return BakedFile::pack(_items);
+}
 
-	// Load the Item Definitions
-	_loaded = _load(filename);
+auto Sorcery::MonsterStore::bake_schema() -> std::uint64_t {
+
+	return BakedFile::schema<MonsterType>(BAKE_MONSTERS_REVISION);
 }
 
-auto Sorcery::MonsterStore::_load(const std::filesystem::path filename)
+auto Sorcery::MonsterStore::_load(const Resource resource)
 	-> bool {
 
-	if (std::ifstream file{filename.string(), std::ifstream::binary};
-		file.good()) {
+	if (auto file{resource.stream()}; file->good()) {
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
@@ -52,7 +80,7 @@ auto Sorcery::MonsterStore::_load(const std::filesystem::path filename)
 #pragma GCC diagnostic pop
 		Json::StreamWriterBuilder builder{};
 		builder.settings_["indentation"] = "";
-		if (Json::Value data; reader.parse(file, data)) {
+		if (Json::Value data; reader.parse(*file, data)) {
 			Json::Value &items{data["monster"]};
 
 			// Iterate through item file one itemtype at a time
@@ -213,7 +241,11 @@ auto Sorcery::MonsterStore::_load(const std::filesystem::path filename)
 				monster_type.set_traits(traits);
 				monster_type.set_weaknesses(weaknesses);
 
-				_items[id.value()] = monster_type;
+				// As with items, monster ids are contiguous from zero
+				const auto index{std::to_underlying(id.value())};
+				if (index >= _items.size())
+					_items.resize(index + 1);
+				_items[index] = std::move(monster_type);
 			}
 
 			return true;
@@ -226,45 +258,41 @@ auto Sorcery::MonsterStore::_load(const std::filesystem::path filename)
 }
 
 auto Sorcery::MonsterStore::get(Enums::Monsters::TypeID monster_type_id) const
-	-> MonsterType {
+	-> const MonsterType & {
 
-	return _items.at(monster_type_id);
+	return _items.at(std::to_underlying(monster_type_id));
 }
 
-auto Sorcery::MonsterStore::get(int monster_type_id) const -> MonsterType {
+auto Sorcery::MonsterStore::get(int monster_type_id) const
+	-> const MonsterType & {
 
-	return _items.at(
-		enum_cast<Enums::Monsters::TypeID>(monster_type_id).value());
+	// A negative id wraps past the end and is rejected by at()
+	return _items.at(static_cast<std::size_t>(monster_type_id));
 }
 
-auto Sorcery::MonsterStore::get_all_types() const -> std::vector<MonsterType> {
+auto Sorcery::MonsterStore::get(std::string_view name) const
+	-> const MonsterType & {
+
+	const auto it{_names.find(name)};
+	if (it == _names.end())
+		throw std::out_of_range{"Monster not found: " + std::string{name}};
+
+	return get(it->second);
+}
 
-	std::vector<MonsterType> items;
-	for (const auto &[key, value] : _items)
-		items.push_back(value);
+auto Sorcery::MonsterStore::get_all_types() const
+	-> std::span<const MonsterType> {
 
-	return items;
+	return _items;
 }
 
 auto Sorcery::MonsterStore::_parse_attacks(const std::string value) const
 	-> std::vector<Dice> {
 
 	std::vector<Dice> attacks;
-	attacks.clear();
-
-	const std::regex regex(R"([,]+)");
-	std::sregex_token_iterator it{value.begin(), value.end(), regex, -1};
-	std::vector<std::string> split{it, {}};
-	split.erase(std::remove_if(split.begin(), split.end(),
-							   [](std::string_view s) {
-								   return s.size() == 0;
-							   }),
-				split.end());
-
-	for (const auto &each : split) {
-
-		Dice atk{each};
-		attacks.emplace_back(atk);
+	for (const auto each : std::views::split(value, ',')) {
+		if (const std::string_view atk{each}; !atk.empty())
+			attacks.emplace_back(atk);
 	}
 
 	return attacks;
@@ -316,7 +344,7 @@ auto Sorcery::MonsterStore::_parse_resistances(const std::string value) const
 	-> std::array<bool, 7> {
 
 	using enum Enums::Monsters::Resistance;
-	std::array<bool, 7> res;
+	std::array<bool, 7> res{};
 	if (value.contains("Cold"))
 		res[std::to_underlying(RESIST_COLD)] = true;
 	if (value.contains("Drain"))
@@ -339,7 +367,7 @@ auto Sorcery::MonsterStore::_parse_properties(const std::string value) const
 	-> std::array<bool, 7> {
 
 	using enum Enums::Monsters::Property;
-	std::array<bool, 7> props;
+	std::array<bool, 7> props{};
 	if (value.contains("Critical"))
 		props[std::to_underlying(CAN_AUTOKILL)] = true;
 	if (value.contains("Sleep"))
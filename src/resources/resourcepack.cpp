@@ -0,0 +1,321 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+#include "resources/resourcepack.hpp"
+#include "core/debug.hpp"
+#include "resources/define.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <spanstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Sorcery::Resource::Resource(const std::filesystem::path &path)
+	: path{path},
+	  data{},
+	  in_pack{false} {}
+
+Sorcery::Resource::Resource(const std::filesystem::path &path,
+							std::span<const std::byte> data)
+	: path{path},
+	  data{data},
+	  in_pack{true} {}
+
+auto Sorcery::Resource::packed() const -> bool {
+
+	return in_pack;
+}
+
+// Packed resources are read straight out of the mapped pack
+auto Sorcery::Resource::stream() const -> std::unique_ptr<std::istream> {
+
+	if (packed())
+		return std::make_unique<std::ispanstream>(std::span<const char>{
+			reinterpret_cast<const char *>(data.data()), data.size()});
+	else
+		return std::make_unique<std::ifstream>(path, std::ifstream::binary);
+}
+
+auto Sorcery::Resource::bytes() const -> std::vector<unsigned char> {
+
+	if (packed()) {
+		const auto begin{reinterpret_cast<const unsigned char *>(data.data())};
+		return {begin, begin + data.size()};
+	}
+
+	std::ifstream file{path, std::ios::binary};
+	if (!file.is_open())
+		return {};
+
+	return {std::istreambuf_iterator<char>(file), {}};
+}
+
+Sorcery::ResourcePack::ResourcePack()
+	: _data{nullptr},
+	  _size{0},
+	  _mapped{false} {}
+
+Sorcery::ResourcePack::~ResourcePack() {
+
+	close();
+}
+
+auto Sorcery::ResourcePack::open(const std::filesystem::path &filename)
+	-> bool {
+
+	close();
+
+	if (!_map(filename))
+		return false;
+
+	if (!_index()) {
+		DEBUG_LOGF("Ignoring invalid resource pack: {}", filename.string());
+		close();
+		return false;
+	}
+
+	DEBUG_LOGF("Opened resource pack {} ({} entries, {} bytes)",
+			   filename.string(), _entries.size(), _size);
+
+	return true;
+}
+
+auto Sorcery::ResourcePack::close() -> void {
+
+#ifdef __linux__
+	if (_mapped)
+		::munmap(const_cast<std::byte *>(_data), _size);
+#endif
+
+	_data = nullptr;
+	_size = 0;
+	_mapped = false;
+	_buffer.clear();
+	_entries.clear();
+}
+
+auto Sorcery::ResourcePack::is_open() const -> bool {
+
+	return _data != nullptr;
+}
+
+auto Sorcery::ResourcePack::contains(std::string_view key) const -> bool {
+
+	return _entries.contains(std::string{key});
+}
+
+auto Sorcery::ResourcePack::get(std::string_view key) const
+	-> std::span<const std::byte> {
+
+	const auto found{_entries.find(std::string{key})};
+
+	return found != _entries.end() ? found->second
+								   : std::span<const std::byte>{};
+}
+
+auto Sorcery::ResourcePack::keys() const -> std::vector<std::string> {
+
+	std::vector<std::string> keys;
+	keys.reserve(_entries.size());
+	for (const auto &[key, data] : _entries)
+		keys.emplace_back(key);
+
+	std::ranges::sort(keys);
+
+	return keys;
+}
+
+auto Sorcery::ResourcePack::size() const -> std::size_t {
+
+	return _entries.size();
+}
+
+// Build a pack from a list of keys and the files that they refer to, writing
+// to a temporary file first so that a pack that is currently mapped is never
+// modified in place
+auto Sorcery::ResourcePack::write(
+	const std::filesystem::path &filename,
+	const std::vector<std::pair<std::string, std::filesystem::path>> &files)
+	-> void {
+
+	const auto align{[](std::uint64_t offset) {
+		return (offset + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1);
+	}};
+
+	std::vector<Entry> entries(files.size());
+	std::string keys{};
+	for (auto i = 0u; i < files.size(); i++) {
+		entries[i].key_offset = static_cast<std::uint32_t>(keys.size());
+		entries[i].key_size = static_cast<std::uint32_t>(files[i].first.size());
+		entries[i].size = std::filesystem::file_size(files[i].second);
+		keys.append(files[i].first);
+	}
+
+	auto offset{align(sizeof(Header) + entries.size() * sizeof(Entry) +
+					  keys.size())};
+	for (auto &entry : entries) {
+		entry.key_offset += static_cast<std::uint32_t>(
+			sizeof(Header) + entries.size() * sizeof(Entry));
+		entry.offset = offset;
+		offset = align(offset + entry.size);
+	}
+
+	Header header{};
+	std::memcpy(header.magic, PACK_MAGIC.data(), sizeof(header.magic));
+	header.version = PACK_VERSION;
+	header.count = static_cast<std::uint32_t>(entries.size());
+
+	const std::filesystem::path temporary_file{filename.string() + ".tmp"};
+	{
+		std::ofstream output{temporary_file, std::ios::binary};
+		if (!output.is_open())
+			throw std::runtime_error{std::format(
+				"Unable to write resource pack: {}", temporary_file.string())};
+
+		output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+		output.write(reinterpret_cast<const char *>(entries.data()),
+					 static_cast<std::streamsize>(entries.size() *
+												  sizeof(Entry)));
+		output.write(keys.data(), static_cast<std::streamsize>(keys.size()));
+
+		for (auto i = 0u; i < files.size(); i++) {
+			output.seekp(static_cast<std::streamoff>(entries[i].offset));
+			std::ifstream input{files[i].second, std::ios::binary};
+			if (!input.is_open())
+				throw std::runtime_error{
+					std::format("Unable to read resource: {}",
+								files[i].second.string())};
+			output << input.rdbuf();
+		}
+
+		// Pad the final blob so the file size is itself aligned
+		output.seekp(static_cast<std::streamoff>(offset) - 1);
+		output.put('\0');
+
+		if (!output.good())
+			throw std::runtime_error{std::format(
+				"Unable to write resource pack: {}", temporary_file.string())};
+	}
+
+	std::filesystem::rename(temporary_file, filename);
+}
+
+auto Sorcery::ResourcePack::_map(const std::filesystem::path &filename)
+	-> bool {
+
+#ifdef __linux__
+
+	const auto fd{::open(filename.c_str(), O_RDONLY | O_CLOEXEC)};
+	if (fd < 0)
+		return false;
+
+	struct stat info{};
+	if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+		::close(fd);
+		return false;
+	}
+
+	auto *address{::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+						 PROT_READ, MAP_PRIVATE, fd, 0)};
+	::close(fd);
+	if (address == MAP_FAILED)
+		return false;
+
+	// We will touch most of the pack during startup anyway
+	::madvise(address, static_cast<std::size_t>(info.st_size), MADV_WILLNEED);
+
+	_data = static_cast<const std::byte *>(address);
+	_size = static_cast<std::size_t>(info.st_size);
+	_mapped = true;
+
+	return true;
+
+#else
+
+	// No mapping available so fall back to a single read of the whole file
+	std::ifstream file{filename, std::ios::binary | std::ios::ate};
+	if (!file.is_open())
+		return false;
+
+	_buffer.resize(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0);
+	if (_buffer.empty() ||
+		!file.read(reinterpret_cast<char *>(_buffer.data()),
+				   static_cast<std::streamsize>(_buffer.size())))
+		return false;
+
+	_data = _buffer.data();
+	_size = _buffer.size();
+
+	return true;
+
+#endif
+}
+
+// Check the header and build the key lookup, rejecting anything that would
+// point outside of the pack
+auto Sorcery::ResourcePack::_index() -> bool {
+
+	if (_size < sizeof(Header))
+		return false;
+
+	Header header{};
+	std::memcpy(&header, _data, sizeof(header));
+	if (std::string_view{header.magic, sizeof(header.magic)} != PACK_MAGIC ||
+		header.version != PACK_VERSION)
+		return false;
+
+	const auto table_size{static_cast<std::size_t>(header.count) *
+						  sizeof(Entry)};
+	if (_size - sizeof(Header) < table_size)
+		return false;
+
+	_entries.reserve(header.count);
+	for (auto i = 0u; i < header.count; i++) {
+		Entry entry{};
+		std::memcpy(&entry, _data + sizeof(Header) + i * sizeof(Entry),
+					sizeof(entry));
+
+		if (entry.key_offset > _size ||
+			entry.key_size > _size - entry.key_offset ||
+			entry.offset > _size || entry.size > _size - entry.offset)
+			return false;
+
+		const std::string key{
+			reinterpret_cast<const char *>(_data + entry.key_offset),
+			entry.key_size};
+		const std::span<const std::byte> data{
+			_data + entry.offset, static_cast<std::size_t>(entry.size)};
+		_entries.insert_or_assign(key, data);
+	}
+
+	return true;
+}
@@ -0,0 +1,491 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "resources/rosterfile.hpp"
+#include "core/debug.hpp"
+#include "resources/define.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <print>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Header is the magic, a version and two reserved bytes; each record is its
+// size, operation and id, then the record itself, and then a checksum of
+// everything but the size
+constexpr std::uint64_t HEADER_SIZE{8};
+constexpr std::uint64_t PREFIX_SIZE{9};
+constexpr std::uint64_t CHECKSUM_SIZE{8};
+
+template <std::unsigned_integral T>
+auto put_integer(std::string &output, const T value) -> void {
+
+	for (auto i = 0u; i < sizeof(T); i++)
+		output.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+template <std::unsigned_integral T>
+auto get_integer(const std::byte *input) -> T {
+
+	T value{};
+	for (auto i = 0u; i < sizeof(T); i++)
+		value |= static_cast<T>(std::to_integer<unsigned char>(input[i]))
+				 << (i * 8);
+
+	return value;
+}
+
+auto fnv1a(const std::string_view bytes,
+		   std::uint64_t hash = 14695981039346656037ull) -> std::uint64_t {
+
+	for (const auto byte : bytes) {
+		hash ^= static_cast<unsigned char>(byte);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+auto as_chars(const std::byte *data, const std::uint64_t size)
+	-> std::string_view {
+
+	return {reinterpret_cast<const char *>(data),
+			static_cast<std::size_t>(size)};
+}
+
+auto record_size(const std::uint32_t size) -> std::uint64_t {
+
+	return PREFIX_SIZE + size + CHECKSUM_SIZE;
+}
+
+// Thrown by the scan, with where the damage starts (everything before it
+// checked out)
+struct Damaged : std::runtime_error {
+		Damaged(const std::uint64_t position_, const std::string &what)
+			: std::runtime_error{what},
+			  position{position_} {}
+
+		std::uint64_t position;
+};
+
+}
+
+Sorcery::RosterFile::RosterFile(const std::filesystem::path &path)
+	: _path{path},
+	  _size{0},
+	  _live{0},
+	  _data{nullptr},
+	  _mapped_size{0},
+	  _mapped{false} {
+
+	_open();
+	if (_wasted() > ROSTER_COMPACT_MINIMUM && _wasted() > _live)
+		compact();
+}
+
+Sorcery::RosterFile::~RosterFile() {
+
+	_close();
+}
+
+// Sorted, and kept up to date as characters are put and erased
+auto Sorcery::RosterFile::ids() const noexcept
+	-> const std::vector<unsigned int> & {
+
+	return _ids;
+}
+
+auto Sorcery::RosterFile::contains(const unsigned int id) const -> bool {
+
+	return _index.contains(id);
+}
+
+// Only valid until the roster is next changed
+auto Sorcery::RosterFile::get(const unsigned int id) const -> std::string_view {
+
+	const auto it{_index.find(id)};
+	if (it == _index.end())
+		return {};
+
+	const auto &entry{it->second};
+	if (entry.offset + entry.size > _mapped_size)
+		_map();
+
+	return as_chars(_data + entry.offset, entry.size);
+}
+
+auto Sorcery::RosterFile::put(const unsigned int id,
+							  const std::string_view record) -> void {
+
+	if (record.size() > std::numeric_limits<std::uint32_t>::max())
+		throw std::length_error{"Roster record is too large"};
+
+	const auto offset{_size + PREFIX_SIZE};
+	_append(Op::PUT, id, record);
+
+	const Entry entry{.offset = offset,
+					  .size = static_cast<std::uint32_t>(record.size())};
+	if (const auto it{_index.find(id)}; it != _index.end()) {
+		_live -= record_size(it->second.size);
+		it->second = entry;
+	} else {
+		_index.emplace(id, entry);
+		_ids.insert(std::ranges::upper_bound(_ids, id), id);
+	}
+	_live += record_size(entry.size);
+
+	if (_wasted() > ROSTER_COMPACT_MINIMUM && _wasted() > _live)
+		compact();
+}
+
+auto Sorcery::RosterFile::erase(const unsigned int id) -> bool {
+
+	const auto it{_index.find(id)};
+	if (it == _index.end())
+		return false;
+
+	_append(Op::ERASE, id, {});
+	_live -= record_size(it->second.size);
+	_index.erase(it);
+	_ids.erase(std::ranges::lower_bound(_ids, id));
+
+	if (_wasted() > ROSTER_COMPACT_MINIMUM && _wasted() > _live)
+		compact();
+
+	return true;
+}
+
+auto Sorcery::RosterFile::clear() -> void {
+
+	_close();
+	std::filesystem::remove(_path);
+	_open();
+}
+
+// Rewrite the file with only the newest version of each character, in id
+// order, replacing it in the same way as the other saves are
+auto Sorcery::RosterFile::compact() -> void {
+
+	const auto before{_size};
+	const std::filesystem::path temporary_file{_path.string() + ".tmp"};
+	try {
+		std::ofstream output{temporary_file, std::ios::out |
+												 std::ios::binary |
+												 std::ios::trunc};
+		if (!output.is_open())
+			throw std::runtime_error{"Unable to open temporary roster: " +
+									 temporary_file.string()};
+
+		_map();
+		output.write(reinterpret_cast<const char *>(_data),
+					 static_cast<std::streamsize>(HEADER_SIZE));
+		for (const auto id : _ids) {
+			const auto &entry{_index.at(id)};
+			output.write(
+				reinterpret_cast<const char *>(_data + entry.offset -
+											   PREFIX_SIZE),
+				static_cast<std::streamsize>(record_size(entry.size)));
+		}
+		output.flush();
+		if (!output)
+			throw std::runtime_error{"Unable to write temporary roster: " +
+									 temporary_file.string()};
+		output.close();
+
+		_close();
+		std::filesystem::rename(temporary_file, _path);
+
+	} catch (...) {
+		std::error_code ignored_error;
+		std::filesystem::remove(temporary_file, ignored_error);
+		throw;
+	}
+
+	_open();
+
+	DEBUG_LOGF("Compacted {} from {} to {} bytes ({} characters)",
+			   _path.string(), before, _size, _ids.size());
+}
+
+auto Sorcery::RosterFile::path() const -> const std::filesystem::path & {
+
+	return _path;
+}
+
+// Create the file if need be, index it, and get ready to append to it
+auto Sorcery::RosterFile::_open() -> void {
+
+	_index.clear();
+	_ids.clear();
+	_live = 0;
+
+	std::error_code error;
+	if (!std::filesystem::is_regular_file(_path, error) ||
+		std::filesystem::file_size(_path, error) == 0) {
+		std::string header{ROSTER_MAGIC};
+		put_integer(header, ROSTER_VERSION);
+		put_integer(header, std::uint16_t{0});
+		std::ofstream output{_path, std::ios::out | std::ios::binary |
+										std::ios::trunc};
+		output.write(header.data(),
+					 static_cast<std::streamsize>(header.size()));
+		if (!output)
+			throw std::runtime_error{"Unable to create roster: " +
+									 _path.string()};
+	}
+
+	_map();
+	std::uint64_t end{};
+	try {
+		end = _scan();
+	} catch (const Damaged &damaged) {
+		_unmap();
+		_quarantine(damaged.position);
+		_open();
+		return;
+	} catch (...) {
+		_unmap();
+		throw;
+	}
+	const auto size{_mapped_size};
+	_unmap();
+
+	// Anything after the last complete record was being written when the
+	// game stopped, and can only be thrown away (damage elsewhere has already
+	// been dealt with by the scan)
+	if (end < size) {
+		std::filesystem::resize_file(_path, end);
+		DEBUG_LOGF("Dropped {} bytes of incomplete records from {}",
+				   size - end, _path.string());
+	}
+	_size = end;
+
+	_out.open(_path, std::ios::out | std::ios::binary | std::ios::app);
+	if (!_out.is_open())
+		throw std::runtime_error{"Unable to open roster: " + _path.string()};
+
+	DEBUG_LOGF("Opened {} ({} characters, {} of {} bytes current)",
+			   _path.string(), _ids.size(), _live, _size);
+}
+
+auto Sorcery::RosterFile::_close() -> void {
+
+	if (_out.is_open())
+		_out.close();
+	_unmap();
+}
+
+// Map (or failing that read) the whole file as it is now
+auto Sorcery::RosterFile::_map() const -> void {
+
+	_unmap();
+
+#ifdef __linux__
+
+	const auto fd{::open(_path.c_str(), O_RDONLY | O_CLOEXEC)};
+	if (fd < 0)
+		throw std::runtime_error{"Unable to open roster: " + _path.string()};
+
+	struct stat info{};
+	if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+		::close(fd);
+		throw std::runtime_error{"Unable to read roster: " + _path.string()};
+	}
+
+	auto *address{::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+						 PROT_READ, MAP_PRIVATE, fd, 0)};
+	::close(fd);
+	if (address == MAP_FAILED)
+		throw std::runtime_error{"Unable to map roster: " + _path.string()};
+
+	_data = static_cast<const std::byte *>(address);
+	_mapped_size = static_cast<std::size_t>(info.st_size);
+	_mapped = true;
+
+#else
+
+	std::ifstream file{_path, std::ios::binary | std::ios::ate};
+	if (!file.is_open())
+		throw std::runtime_error{"Unable to open roster: " + _path.string()};
+
+	_buffer.resize(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0);
+	if (!file.read(reinterpret_cast<char *>(_buffer.data()),
+				   static_cast<std::streamsize>(_buffer.size())))
+		throw std::runtime_error{"Unable to read roster: " + _path.string()};
+
+	_data = _buffer.data();
+	_mapped_size = _buffer.size();
+
+#endif
+}
+
+auto Sorcery::RosterFile::_unmap() const -> void {
+
+#ifdef __linux__
+	if (_mapped)
+		::munmap(const_cast<std::byte *>(_data), _mapped_size);
+#endif
+
+	_data = nullptr;
+	_mapped_size = 0;
+	_mapped = false;
+	_buffer.clear();
+}
+
+// Build the index from the mapped file, returning where the last complete
+// record ends. Only a record whose size runs past the end of the file is
+// torn, and anything else that fails to check out could be followed by any
+// number of good records, so is never dropped here (see _quarantine())
+auto Sorcery::RosterFile::_scan() -> std::uint64_t {
+
+	if (_mapped_size < HEADER_SIZE ||
+		as_chars(_data, ROSTER_MAGIC.size()) != ROSTER_MAGIC)
+		throw Damaged{0, "Not a roster: " + _path.string()};
+
+	if (const auto version{get_integer<std::uint16_t>(_data + 4)};
+		version != ROSTER_VERSION)
+		throw std::runtime_error{"Unsupported roster version " +
+								 std::to_string(version) + ": " +
+								 _path.string()};
+
+	std::uint64_t position{HEADER_SIZE};
+	while (_mapped_size - position >= PREFIX_SIZE + CHECKSUM_SIZE) {
+		const auto *record{_data + position};
+		const auto size{get_integer<std::uint32_t>(record)};
+		if (_mapped_size - position < record_size(size))
+			break;
+
+		const auto op{
+			static_cast<Op>(std::to_integer<std::uint8_t>(record[4]))};
+		const auto id{get_integer<std::uint32_t>(record + 5)};
+		if ((op != Op::PUT && op != Op::ERASE) ||
+			get_integer<std::uint64_t>(record + PREFIX_SIZE + size) !=
+				fnv1a(as_chars(record + 4, PREFIX_SIZE - 4 + size)))
+			throw Damaged{position, "Roster is damaged at byte " +
+										std::to_string(position) + ": " +
+										_path.string()};
+
+		if (const auto it{_index.find(id)}; it != _index.end()) {
+			_live -= record_size(it->second.size);
+			_index.erase(it);
+		}
+		if (op == Op::PUT) {
+			_index.emplace(id, Entry{.offset = position + PREFIX_SIZE,
+									 .size = size});
+			_live += record_size(size);
+		}
+
+		position += record_size(size);
+	}
+
+	_ids.reserve(_index.size());
+	for (const auto &[id, entry] : _index)
+		_ids.emplace_back(id);
+	std::ranges::sort(_ids);
+
+	return position;
+}
+
+auto Sorcery::RosterFile::_append(const Op op, const unsigned int id,
+								  const std::string_view record) -> void {
+
+	std::string prefix{};
+	put_integer(prefix, static_cast<std::uint32_t>(record.size()));
+	put_integer(prefix, static_cast<std::uint8_t>(op));
+	put_integer(prefix, static_cast<std::uint32_t>(id));
+
+	std::string checksum{};
+	put_integer(checksum,
+				fnv1a(record, fnv1a(std::string_view{prefix}.substr(4))));
+
+	_out.write(prefix.data(), static_cast<std::streamsize>(prefix.size()));
+	_out.write(record.data(), static_cast<std::streamsize>(record.size()));
+	_out.write(checksum.data(), static_cast<std::streamsize>(checksum.size()));
+	_out.flush();
+
+	// Never leave part of a record behind, as it would hide any after it
+	if (!_out) {
+		_out.close();
+		std::error_code ignored_error;
+		std::filesystem::resize_file(_path, _size, ignored_error);
+		_out.open(_path, std::ios::out | std::ios::binary | std::ios::app);
+		throw std::runtime_error{"Unable to write roster: " + _path.string()};
+	}
+
+	_size += record_size(static_cast<std::uint32_t>(record.size()));
+}
+
+auto Sorcery::RosterFile::_wasted() const noexcept -> std::uint64_t {
+
+	return _size - HEADER_SIZE - _live;
+}
+
+// The roster is damaged, but it holds every character, so rather than refuse
+// to start (or quietly throw any of them away) it is kept aside as it is, for
+// recovery by hand, and the records before the damage are carried on with
+auto Sorcery::RosterFile::_quarantine(const std::uint64_t position) -> void {
+
+	const auto seconds{std::chrono::duration_cast<std::chrono::seconds>(
+						   std::chrono::system_clock::now().time_since_epoch())
+						   .count()};
+	std::filesystem::path damaged_file{
+		std::format("{}.damaged-{}", _path.string(), seconds)};
+	for (auto copy = 2u; std::filesystem::exists(damaged_file); copy++)
+		damaged_file = std::format("{}.damaged-{}-{}", _path.string(),
+								   seconds, copy);
+	std::filesystem::rename(_path, damaged_file);
+
+	if (position >= HEADER_SIZE) {
+		std::ifstream input{damaged_file, std::ios::in | std::ios::binary};
+		std::string good(static_cast<std::size_t>(position), '\0');
+		if (!input.read(good.data(), static_cast<std::streamsize>(position)))
+			throw std::runtime_error{"Unable to read roster: " +
+									 damaged_file.string()};
+
+		std::ofstream output{_path, std::ios::out | std::ios::binary |
+										std::ios::trunc};
+		output.write(good.data(), static_cast<std::streamsize>(good.size()));
+		if (!output)
+			throw std::runtime_error{"Unable to write roster: " +
+									 _path.string()};
+	}
+
+	std::println(stderr,
+				 "{} is damaged at byte {}, so it has been moved to {} and "
+				 "only the characters saved before that are loaded",
+				 _path.string(), position, damaged_file.string());
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "resources/savepayload.hpp"
+#include "resources/define.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+Sorcery::PayloadBuffer::PayloadBuffer(const bool compress, const bool keep)
+	: _payload{},
+	  _sink_buffer{_payload.data},
+	  _sink{&_sink_buffer},
+	  _compress{compress},
+	  _keep{keep} {}
+
+// Ends the deflate stream if there is one; nothing more may be written after
+auto Sorcery::PayloadBuffer::finish() -> SavePayload {
+
+	if (_deflate) {
+		_deflate->finish();
+		_deflate.reset();
+		_payload.compressed = true;
+	}
+	if (!_sink)
+		throw std::runtime_error{"Unable to store the save payload"};
+
+	return std::move(_payload);
+}
+
+auto Sorcery::PayloadBuffer::overflow(const int_type ch) -> int_type {
+
+	if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+		const auto byte{traits_type::to_char_type(ch)};
+		_store({&byte, 1});
+	}
+
+	return traits_type::not_eof(ch);
+}
+
+auto Sorcery::PayloadBuffer::xsputn(const char *data,
+									const std::streamsize count)
+	-> std::streamsize {
+
+	_store({data, static_cast<std::size_t>(count)});
+
+	return count;
+}
+
+// Anything small enough is kept as it is, as deflating it would only make it
+// larger, so the deflate stream is only started once that is left behind
+auto Sorcery::PayloadBuffer::_store(const std::string_view bytes) -> void {
+
+	_payload.checksum = fnv1a(bytes, _payload.checksum);
+	_payload.size += bytes.size();
+	if (!_keep)
+		return;
+
+	if (_deflate) {
+		_deflate->sputn(bytes.data(),
+						static_cast<std::streamsize>(bytes.size()));
+		return;
+	}
+
+	_payload.data.append(bytes);
+	if (_compress && _payload.data.size() >= SAVE_COMPRESS_MINIMUM) {
+		const auto start{std::exchange(_payload.data, {})};
+		_deflate.emplace(_sink);
+		_deflate->sputn(start.data(),
+						static_cast<std::streamsize>(start.size()));
+	}
+}
+
+Sorcery::PayloadBuffer::Sink::Sink(std::string &data)
+	: _data{data} {}
+
+auto Sorcery::PayloadBuffer::Sink::overflow(const int_type ch) -> int_type {
+
+	if (!traits_type::eq_int_type(ch, traits_type::eof()))
+		_data.push_back(traits_type::to_char_type(ch));
+
+	return traits_type::not_eof(ch);
+}
+
+auto Sorcery::PayloadBuffer::Sink::xsputn(const char *data,
+										  const std::streamsize count)
+	-> std::streamsize {
+
+	_data.append(data, static_cast<std::size_t>(count));
+
+	return count;
+}
+
+Sorcery::PayloadStream::PayloadStream(const bool compress, const bool keep)
+	: std::ostream{nullptr},
+	  _buffer{compress, keep} {
+
+	rdbuf(&_buffer);
+}
+
+auto Sorcery::PayloadStream::finish() -> SavePayload {
+
+	return _buffer.finish();
+}
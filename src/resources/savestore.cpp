@@ -24,20 +24,43 @@
 #include "common/cereal.hpp"
 #include "common/types.hpp"
 #include "core/debug.hpp"
+#include "resources/define.hpp"
+#include "resources/rosterfile.hpp"
+#include "resources/savepayload.hpp"
+#include "resources/zstream.hpp"
 
 #include <algorithm>
 #include <charconv>
 #include <chrono>
+#include <concepts>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <optional>
+#include <print>
+#include <spanstream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
 namespace {
 
+enum class SaveKind : std::uint8_t {
+	GAME = 1,
+	CHARACTER = 2
+};
+
+struct SaveFile {
+		SaveKind kind;
+		Sorcery::SaveHeader header;
+		std::string data;
+};
+
+// Records as written by the older JSON saves, which are only ever read now
 struct CharacterSaveRecord {
 		std::uint32_t version{1};
 		unsigned int id{};
@@ -70,11 +93,394 @@ struct GameSaveRecord {
 		}
 };
 
+// Everything in the container is little-endian regardless of platform
+template <std::unsigned_integral T>
+auto put_integer(std::string &output, const T value) -> void {
+
+	for (auto i = 0u; i < sizeof(T); i++)
+		output.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+auto put_string(std::string &output, const std::string_view value) -> void {
+
+	if (value.size() > std::numeric_limits<std::uint32_t>::max())
+		throw std::length_error{"Save field is too large"};
+
+	put_integer(output, static_cast<std::uint32_t>(value.size()));
+	output.append(value);
+}
+
+template <std::unsigned_integral T>
+auto get_integer(const std::string_view input, std::size_t &position) -> T {
+
+	if (input.size() - position < sizeof(T))
+		throw std::runtime_error{"Save file is truncated"};
+
+	T value{};
+	for (auto i = 0u; i < sizeof(T); i++)
+		value |= static_cast<T>(
+					 static_cast<unsigned char>(input[position + i]))
+				 << (i * 8);
+	position += sizeof(T);
+
+	return value;
+}
+
+auto get_string(const std::string_view input, std::size_t &position)
+	-> std::string {
+
+	const auto size{get_integer<std::uint32_t>(input, position)};
+	if (input.size() - position < size)
+		throw std::runtime_error{"Save file is truncated"};
+
+	std::string value{input.substr(position, size)};
+	position += size;
+
+	return value;
+}
+
+// magic, version, kind, flags, id, game id, created, modified, key, name,
+// status and payload size - this is followed by the payload (deflated if the
+// flags say so) and then a checksum of the payload as it was before it was
+// deflated, carried on over the header. Version 1 had no flags, and versions
+// 1 and 2 checksummed the header first, but otherwise they are laid out in
+// exactly the same way
+auto encode_header(const SaveKind kind, const Sorcery::SaveHeader &header,
+				   const Sorcery::SavePayload &payload) -> std::string {
+
+	if (payload.size > std::numeric_limits<std::uint32_t>::max())
+		throw std::length_error{"Save payload is too large"};
+
+	std::string output{};
+	output.reserve(header.key.size() + header.name.size() +
+				   header.status.size() + 64);
+	output.append(Sorcery::SAVE_MAGIC);
+	put_integer(output, Sorcery::SAVE_VERSION);
+	put_integer(output, static_cast<std::uint8_t>(kind));
+	put_integer(output, payload.compressed ? Sorcery::SAVE_FLAG_COMPRESSED
+										   : std::uint8_t{0});
+	put_integer(output, static_cast<std::uint32_t>(header.id));
+	put_integer(output, static_cast<std::uint32_t>(header.game_id));
+	put_integer(output, static_cast<std::uint64_t>(header.created));
+	put_integer(output, static_cast<std::uint64_t>(header.modified));
+	put_string(output, header.key);
+	put_string(output, header.name);
+	put_string(output, header.status);
+	put_integer(output, static_cast<std::uint32_t>(payload.size));
+
+	return output;
+}
+
+auto decode(const std::string_view input, const std::filesystem::path &path)
+	-> SaveFile {
+
+	const auto fail{[&](const std::string_view reason) {
+		return std::runtime_error{std::string{reason} +
+								  " in save file: " + path.string()};
+	}};
+
+	constexpr auto CHECKSUM_SIZE{sizeof(std::uint64_t)};
+	if (input.size() < Sorcery::SAVE_MAGIC.size() + sizeof(std::uint16_t) +
+						   CHECKSUM_SIZE)
+		throw fail("Truncated header");
+
+	const auto body{input.substr(0, input.size() - CHECKSUM_SIZE)};
+	std::size_t position{Sorcery::SAVE_MAGIC.size()};
+	const auto version{get_integer<std::uint16_t>(body, position)};
+	if (version < 1 || version > Sorcery::SAVE_VERSION)
+		throw fail("Unsupported version " + std::to_string(version));
+
+	SaveFile file{};
+	std::uint8_t flags{};
+	std::uint32_t size{};
+	try {
+		file.kind =
+			static_cast<SaveKind>(get_integer<std::uint8_t>(body, position));
+		flags = get_integer<std::uint8_t>(body, position);
+		auto &header{file.header};
+		header.id = get_integer<std::uint32_t>(body, position);
+		header.game_id = get_integer<std::uint32_t>(body, position);
+		header.created = static_cast<std::int64_t>(
+			get_integer<std::uint64_t>(body, position));
+		header.modified = static_cast<std::int64_t>(
+			get_integer<std::uint64_t>(body, position));
+		header.key = get_string(body, position);
+		header.name = get_string(body, position);
+		header.status = get_string(body, position);
+		size = get_integer<std::uint32_t>(body, position);
+
+	} catch (const std::runtime_error &error) {
+		throw fail(error.what());
+	}
+
+	if ((flags & ~Sorcery::SAVE_FLAG_COMPRESSED) != 0 ||
+		(version == 1 && flags != 0))
+		throw fail("Unknown flags");
+
+	// Check the size in the header against what is left of the file before
+	// allocating anything, as deflate can't do better than about 1032:1
+	constexpr std::uint64_t MAX_DEFLATE_RATIO{1032};
+	const auto payload{body.substr(position)};
+	const auto compressed{(flags & Sorcery::SAVE_FLAG_COMPRESSED) != 0};
+	if (size > (compressed ? payload.size() * MAX_DEFLATE_RATIO
+						   : payload.size()))
+		throw fail("Payload size mismatch");
+
+	// Inflate straight into the payload, which is already the right size
+	auto complete{payload.size() == size};
+	file.data.resize(size);
+	if (compressed) {
+		try {
+			std::ispanstream stream{payload};
+			Sorcery::InflateStream inflated{stream};
+			inflated.exceptions(std::ios::badbit);
+			inflated.read(file.data.data(), size);
+			complete =
+				inflated.gcount() == static_cast<std::streamsize>(size) &&
+				inflated.get() == std::char_traits<char>::eof();
+		} catch (const std::runtime_error &error) {
+			throw fail(error.what());
+		}
+	} else if (complete)
+		payload.copy(file.data.data(), size);
+
+	if (!complete)
+		throw fail("Payload size mismatch");
+
+	const auto head{body.substr(0, body.size() - payload.size())};
+	const auto checksum{version < 3
+							? Sorcery::fnv1a(file.data, Sorcery::fnv1a(head))
+							: Sorcery::fnv1a(head, Sorcery::fnv1a(file.data))};
+	position = body.size();
+	if (get_integer<std::uint64_t>(input, position) != checksum)
+		throw fail("Checksum mismatch");
+
+	return file;
+}
+
+auto read_legacy(const std::string &input, const std::filesystem::path &path,
+				 const SaveKind kind) -> SaveFile {
+
+	try {
+		std::istringstream stream{input};
+		cereal::JSONInputArchive archive{stream};
+
+		SaveFile file{.kind = kind, .header = {}, .data = {}};
+		if (kind == SaveKind::GAME) {
+			GameSaveRecord game;
+			archive(cereal::make_nvp("game", game));
+			if (game.version != 1)
+				throw std::runtime_error{"Unsupported game save version " +
+										 std::to_string(game.version) +
+										 " in file: " + path.string()};
+			file.header = {.id = game.id,
+						   .game_id = game.id,
+						   .key = std::move(game.key),
+						   .name = {},
+						   .status = std::move(game.status),
+						   .created = game.started,
+						   .modified = game.last_played};
+			file.data = std::move(game.data);
+		} else {
+			CharacterSaveRecord character;
+			archive(cereal::make_nvp("character", character));
+			if (character.version != 1)
+				throw std::runtime_error{"Unsupported character save version " +
+										 std::to_string(character.version) +
+										 " in file: " + path.string()};
+			file.header = {.id = character.id,
+						   .game_id = character.game_id,
+						   .key = {},
+						   .name = std::move(character.name),
+						   .status = std::move(character.status),
+						   .created = character.created,
+						   .modified = character.created};
+			file.data = std::move(character.data);
+		}
+
+		return file;
+
+	} catch (const cereal::Exception &error) {
+		throw std::runtime_error{"Unable to deserialize save file '" +
+								 path.string() + "': " + error.what()};
+	}
+}
+
+// Read either format, telling them apart by the magic at the front
+auto read_save(const std::filesystem::path &path, const SaveKind kind)
+	-> SaveFile {
+
+	std::ifstream input{path, std::ios::in | std::ios::binary};
+	if (!input.is_open())
+		throw std::runtime_error{"Unable to open save file: " + path.string()};
+
+	const std::string bytes{std::istreambuf_iterator<char>{input},
+							std::istreambuf_iterator<char>{}};
+	if (input.bad())
+		throw std::runtime_error{"Unable to read save file: " + path.string()};
+
+	auto file{bytes.starts_with(Sorcery::SAVE_MAGIC)
+				  ? decode(bytes, path)
+				  : read_legacy(bytes, path, kind)};
+	if (file.kind != kind)
+		throw std::runtime_error{"Unexpected kind of save file: " +
+								 path.string()};
+
+	return file;
+}
+
+// A payload read from an older save, to be written again
+auto to_payload(const std::string_view data, const bool compress)
+	-> Sorcery::SavePayload {
+
+	Sorcery::PayloadStream stream{compress};
+	stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+
+	return stream.finish();
+}
+
+// The payload is already in its final form (and its checksum known), so the
+// container is only ever put together around it, never copied through zlib
+auto encode(const SaveKind kind, const Sorcery::SaveHeader &header,
+			const Sorcery::SavePayload &payload) -> std::string {
+
+	auto output{encode_header(kind, header, payload)};
+	const auto checksum{Sorcery::fnv1a(output, payload.checksum)};
+	output.reserve(output.size() + payload.data.size() + sizeof(checksum));
+	output.append(payload.data);
+	put_integer(output, checksum);
+
+	return output;
+}
+
+// Write to a temporary file first so that a failed save never leaves a
+// half-written one behind
+auto write_save(const std::filesystem::path &path, const SaveKind kind,
+				const Sorcery::SaveHeader &header,
+				const Sorcery::SavePayload &payload) -> void {
+
+	const auto start{std::chrono::steady_clock::now()};
+	const std::filesystem::path temporary_file{path.string() + ".tmp"};
+
+	try {
+		{
+			std::ofstream output{temporary_file, std::ios::out |
+													 std::ios::binary |
+													 std::ios::trunc};
+
+			if (!output.is_open()) {
+				throw std::runtime_error{
+					"Unable to open temporary save file: " +
+					temporary_file.string()};
+			}
+
+			const auto head{encode_header(kind, header, payload)};
+			std::string checksum{};
+			put_integer(checksum, Sorcery::fnv1a(head, payload.checksum));
+			output.write(head.data(),
+						 static_cast<std::streamsize>(head.size()));
+			output.write(payload.data.data(),
+						 static_cast<std::streamsize>(payload.data.size()));
+			output.write(checksum.data(),
+						 static_cast<std::streamsize>(checksum.size()));
+			output.flush();
+
+			if (!output) {
+				throw std::runtime_error{
+					"Unable to write temporary save file: " +
+					temporary_file.string()};
+			}
+		}
+
+		std::error_code error;
+
+		std::filesystem::rename(temporary_file, path, error);
+
+		if (error) {
+
+			// Some platforms do not replace an existing destination during
+			// rename, so remove the old save and retry
+			error.clear();
+
+			std::filesystem::remove(path, error);
+
+			if (error) {
+				throw std::filesystem::filesystem_error{
+					"Unable to replace the existing save file", path, error};
+			}
+
+			std::filesystem::rename(temporary_file, path, error);
+
+			if (error) {
+				throw std::filesystem::filesystem_error{
+					"Unable to install the new save file", temporary_file,
+					path, error};
+			}
+		}
+
+	} catch (...) {
+		std::error_code ignored_error;
+
+		std::filesystem::remove(temporary_file, ignored_error);
+
+		throw;
+	}
+
+	DEBUG_LOGF("Wrote {} bytes of payload as {} to {} in {} us",
+			   payload.size, payload.data.size(), path.string(),
+			   std::chrono::duration_cast<std::chrono::microseconds>(
+				   std::chrono::steady_clock::now() - start)
+				   .count());
+}
+
+// Decoded straight from the roster's mapping
+auto read_character(const Sorcery::RosterFile &roster,
+					const unsigned int character_id)
+	-> std::optional<SaveFile> {
+
+	if (!roster.contains(character_id))
+		return std::nullopt;
+
+	auto character{decode(roster.get(character_id), roster.path())};
+
+	if (character.kind != SaveKind::CHARACTER ||
+		character.header.id != character_id) {
+		throw std::runtime_error{"Character " + std::to_string(character_id) +
+								 " does not match its roster entry: " +
+								 roster.path().string()};
+	}
+
+	return character;
+}
+
+// Accept only complete positive integer filenames:
+//
+//     1.sav      valid
+//     12.sav     valid
+//     0.sav      ignored
+//     1-old.sav  ignored
+//     fred.sav   ignored
+auto character_id_of(const std::filesystem::path &path) -> unsigned int {
+
+	const std::string stem{path.stem().string()};
+
+	unsigned int character_id{};
+
+	const auto [ptr, conversion_error]{std::from_chars(
+		stem.data(), stem.data() + stem.size(), character_id)};
+
+	if (conversion_error == std::errc{} && ptr == stem.data() + stem.size())
+		return character_id;
+
+	return 0;
+}
+
 }
 
 Sorcery::SaveStore::SaveStore(const std::filesystem::path &game_file,
 							  const std::filesystem::path &characters_directory)
-	: _game_file{game_file},
+	: compress{false},
+	  _game_file{game_file},
 	  _characters_directory{characters_directory} {
 
 	DEBUG_LOGF(
@@ -112,8 +518,15 @@ Sorcery::SaveStore::SaveStore(const std::filesystem::path &game_file,
 			"Unable to create the character save directory",
 			_characters_directory, error};
 	}
+
+	_roster = std::make_unique<RosterFile>(_characters_directory /
+										   ROSTER_FILE);
+
+	_migrate();
 }
 
+Sorcery::SaveStore::~SaveStore() {}
+
 auto Sorcery::SaveStore::has_game() const -> bool {
 
 	DEBUG_LOGF("SaveStore::has_game(game_file='{}')", _game_file.string());
@@ -147,6 +560,9 @@ auto Sorcery::SaveStore::wipe_data() -> void {
 		"SaveStore::wipe_data(game_file='{}', characters_directory='{}')",
 		_game_file.string(), _characters_directory.string());
 
+	_game.reset();
+	_characters.clear();
+
 	std::error_code error;
 
 	// Remove the active game save, if present.
@@ -157,87 +573,18 @@ auto Sorcery::SaveStore::wipe_data() -> void {
 			"Unable to remove the game save file", _game_file, error};
 	}
 
-	error.clear();
-
-	if (!std::filesystem::exists(_characters_directory, error)) {
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect the character save directory",
-				_characters_directory, error};
-		}
-
-		return;
-	}
-
-	if (!std::filesystem::is_directory(_characters_directory, error)) {
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect the character save directory",
-				_characters_directory, error};
-		}
-
-		throw std::runtime_error{"Character save path is not a directory: " +
-								 _characters_directory.string()};
-	}
-
-	std::filesystem::directory_iterator iterator{_characters_directory, error};
+	std::filesystem::remove(journal_file(), error);
 
 	if (error) {
 		throw std::filesystem::filesystem_error{
-			"Unable to open the character save directory",
-			_characters_directory, error};
+			"Unable to remove the log journal", journal_file(), error};
 	}
 
-	const std::filesystem::directory_iterator end;
-
-	while (iterator != end) {
-		const auto entry_path{iterator->path()};
-
-		error.clear();
-
-		const bool regular_file{iterator->is_regular_file(error)};
-
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect character save entry", entry_path, error};
-		}
-
-		if (regular_file && entry_path.extension() == ".json") {
-			const std::string stem{entry_path.stem().string()};
-
-			unsigned int character_id{};
-
-			const auto [ptr, conversion_error]{std::from_chars(
-				stem.data(), stem.data() + stem.size(), character_id)};
-
-			const bool valid_character_file{conversion_error == std::errc{} &&
-											ptr == stem.data() + stem.size() &&
-											character_id > 0};
-
-			if (valid_character_file) {
-				error.clear();
-
-				std::filesystem::remove(entry_path, error);
-
-				if (error) {
-					throw std::filesystem::filesystem_error{
-						"Unable to remove character save file", entry_path,
-						error};
-				}
-			}
-		}
-
-		iterator.increment(error);
-
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to enumerate the character save directory",
-				_characters_directory, error};
-		}
-	}
+	_roster->clear();
 }
 
-auto Sorcery::SaveStore::create_game_state(std::string key, std::string data)
+auto Sorcery::SaveStore::create_game_state(std::string key,
+										   const SavePayload &payload)
 	-> unsigned int {
 
 	DEBUG_LOGF(
@@ -246,60 +593,19 @@ auto Sorcery::SaveStore::create_game_state(std::string key, std::string data)
 		_game_file.string(), _characters_directory.string());
 
 	constexpr unsigned int game_id{1};
-	const auto now{std::chrono::system_clock::now()};
-	GameSaveRecord game{.version = 1,
-						.id = game_id,
-						.key = key,
-						.status = "OK",
-						.started = _to_epoch_seconds(now),
-						.last_played = _to_epoch_seconds(now),
-						.data = std::move(data)};
-	const std::filesystem::path temporary_file{_game_file.string() + ".tmp"};
-	try {
-		const auto parent_directory{_game_file.parent_path()};
-		if (!parent_directory.empty())
-			std::filesystem::create_directories(parent_directory);
-		{
-			std::ofstream output{temporary_file,
-								 std::ios::out | std::ios::trunc};
-			if (!output.is_open()) {
-				throw std::runtime_error{
-					"Unable to open temporary game save file: " +
-					temporary_file.string()};
-			}
-			cereal::JSONOutputArchive archive{output};
-			archive(cereal::make_nvp("game", game));
-			output.flush();
-			if (!output) {
-				throw std::runtime_error{
-					"Unable to write temporary game save file: " +
-					temporary_file.string()};
-			}
-		}
-		std::error_code error;
-		std::filesystem::rename(temporary_file, _game_file, error);
-		if (error) { /* * Some platforms do not replace an existing destination
-						during * rename, so remove the old save and retry. */
-			error.clear();
-			std::filesystem::remove(_game_file, error);
-			if (error) {
-				throw std::filesystem::filesystem_error{
-					"Unable to replace the existing game save file", _game_file,
-					error};
-			}
-			std::filesystem::rename(temporary_file, _game_file, error);
-			if (error) {
-				throw std::filesystem::filesystem_error{
-					"Unable to install the new game save file", temporary_file,
-					_game_file, error};
-			}
-		}
-		return game_id;
-	} catch (...) {
-		std::error_code ignored_error;
-		std::filesystem::remove(temporary_file, ignored_error);
-		throw;
-	}
+	const auto now{_to_epoch_seconds(std::chrono::system_clock::now())};
+	SaveHeader game{.id = game_id,
+					.game_id = game_id,
+					.key = std::move(key),
+					.name = {},
+					.status = "OK",
+					.created = now,
+					.modified = now};
+
+	write_save(_game_file, SaveKind::GAME, game, payload);
+	_game = std::move(game);
+
+	return game_id;
 }
 
 auto Sorcery::SaveStore::load_game_state() const -> std::optional<GameEntry> {
@@ -312,59 +618,31 @@ auto Sorcery::SaveStore::load_game_state() const -> std::optional<GameEntry> {
 	if (!has_game())
 		return std::nullopt;
 
-	try {
-		std::ifstream input{_game_file, std::ios::in};
-
-		if (!input.is_open()) {
-			throw std::runtime_error{"Unable to open game save file: " +
-									 _game_file.string()};
-		}
-
-		GameSaveRecord game;
-
-		{
-			cereal::JSONInputArchive archive{input};
-
-			archive(cereal::make_nvp("game", game));
-		}
+	auto game{read_save(_game_file, SaveKind::GAME)};
 
-		if (!input.eof() && input.fail()) {
-			throw std::runtime_error{"Unable to read game save file: " +
-									 _game_file.string()};
-		}
-
-		if (game.version != 1) {
-			throw std::runtime_error{"Unsupported game save version " +
-									 std::to_string(game.version) +
-									 " in file: " + _game_file.string()};
-		}
-
-		if (game.id == 0) {
-			throw std::runtime_error{"Invalid game ID in save file: " +
-									 _game_file.string()};
-		}
+	if (game.header.id == 0) {
+		throw std::runtime_error{"Invalid game ID in save file: " +
+								 _game_file.string()};
+	}
 
-		if (game.key.empty()) {
-			throw std::runtime_error{"Missing game key in save file: " +
-									 _game_file.string()};
-		}
+	if (game.header.key.empty()) {
+		throw std::runtime_error{"Missing game key in save file: " +
+								 _game_file.string()};
+	}
 
-		return GameEntry{game.id,
-						 std::move(game.key),
-						 std::move(game.status),
-						 _from_epoch_seconds(game.started),
-						 _from_epoch_seconds(game.last_played),
-						 std::move(game.data)};
+	_game = game.header;
 
-	} catch (const cereal::Exception &error) {
-		throw std::runtime_error{"Unable to deserialize game save file '" +
-								 _game_file.string() + "': " + error.what()};
-	}
+	return GameEntry{game.header.id,
+					 std::move(game.header.key),
+					 std::move(game.header.status),
+					 _from_epoch_seconds(game.header.created),
+					 _from_epoch_seconds(game.header.modified),
+					 std::move(game.data)};
 }
 
 auto Sorcery::SaveStore::save_game_state(const unsigned int game_id,
 										 const std::string_view key,
-										 std::string data) -> void {
+										 const SavePayload &payload) -> void {
 
 	DEBUG_LOGF(
 		"SaveStore::save_game_state(game_file='{}', characters_directory='{}')",
@@ -376,30 +654,7 @@ auto Sorcery::SaveStore::save_game_state(const unsigned int game_id,
 			_game_file.string()};
 	}
 
-	GameSaveRecord game;
-
-	try {
-		std::ifstream input{_game_file, std::ios::in};
-
-		if (!input.is_open()) {
-			throw std::runtime_error{"Unable to open game save file: " +
-									 _game_file.string()};
-		}
-
-		cereal::JSONInputArchive archive{input};
-
-		archive(cereal::make_nvp("game", game));
-
-	} catch (const cereal::Exception &error) {
-		throw std::runtime_error{"Unable to deserialize game save file '" +
-								 _game_file.string() + "': " + error.what()};
-	}
-
-	if (game.version != 1) {
-		throw std::runtime_error{"Unsupported game save version " +
-								 std::to_string(game.version) +
-								 " in file: " + _game_file.string()};
-	}
+	auto game{_game_header()};
 
 	if (game.id != game_id) {
 		throw std::runtime_error{
@@ -412,70 +667,15 @@ auto Sorcery::SaveStore::save_game_state(const unsigned int game_id,
 	}
 
 	game.status = "OK";
-	game.last_played = _to_epoch_seconds(std::chrono::system_clock::now());
-	game.data = std::move(data);
-
-	const std::filesystem::path temporary_file{_game_file.string() + ".tmp"};
-
-	try {
-		{
-			std::ofstream output{temporary_file,
-								 std::ios::out | std::ios::trunc};
-
-			if (!output.is_open()) {
-				throw std::runtime_error{
-					"Unable to open temporary game save file: " +
-					temporary_file.string()};
-			}
-
-			cereal::JSONOutputArchive archive{output};
+	game.modified = _to_epoch_seconds(std::chrono::system_clock::now());
 
-			archive(cereal::make_nvp("game", game));
-
-			output.flush();
-
-			if (!output) {
-				throw std::runtime_error{
-					"Unable to write temporary game save file: " +
-					temporary_file.string()};
-			}
-		}
-
-		std::error_code error;
-
-		std::filesystem::rename(temporary_file, _game_file, error);
-
-		if (error) {
-			error.clear();
-
-			std::filesystem::remove(_game_file, error);
-
-			if (error) {
-				throw std::filesystem::filesystem_error{
-					"Unable to replace the existing game save file", _game_file,
-					error};
-			}
-
-			std::filesystem::rename(temporary_file, _game_file, error);
-
-			if (error) {
-				throw std::filesystem::filesystem_error{
-					"Unable to install the updated game save file",
-					temporary_file, _game_file, error};
-			}
-		}
-
-	} catch (...) {
-		std::error_code ignored_error;
-
-		std::filesystem::remove(temporary_file, ignored_error);
-
-		throw;
-	}
+	write_save(_game_file, SaveKind::GAME, game, payload);
+	_game = std::move(game);
 }
 
 auto Sorcery::SaveStore::add_character(const unsigned int game_id,
-									   std::string name, std::string data)
+									   std::string name,
+									   const SavePayload &payload)
 	-> unsigned int {
 
 	DEBUG_LOGF(
@@ -487,189 +687,53 @@ auto Sorcery::SaveStore::add_character(const unsigned int game_id,
 			"Cannot create a character because no game exists."};
 	}
 
-	const auto character_ids{get_character_ids(game_id)};
+	const auto &character_ids{get_character_ids(game_id)};
 
 	unsigned int character_id{1};
 
 	if (!character_ids.empty())
 		character_id = character_ids.back() + 1;
 
-	const CharacterSaveRecord character{
-		.version = 1,
-		.id = character_id,
-		.game_id = game_id,
-		.name = std::move(name),
-		.status = "OK",
-		.created = _to_epoch_seconds(std::chrono::system_clock::now()),
-		.data = std::move(data)};
-
-	const auto character_file{_characters_directory /
-							  (std::to_string(character_id) + ".json")};
-
-	const auto temporary_file{character_file.string() + ".tmp"};
-
-	try {
-
-		{
-			std::ofstream output{temporary_file,
-								 std::ios::out | std::ios::trunc};
-
-			if (!output.is_open()) {
-				throw std::runtime_error{
-					"Unable to open temporary character save: " +
-					temporary_file};
-			}
-
-			cereal::JSONOutputArchive archive{output};
-
-			archive(cereal::make_nvp("character", character));
-		}
-
-		std::error_code error;
-
-		std::filesystem::rename(temporary_file, character_file, error);
-
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to install character save", temporary_file,
-				character_file, error};
-		}
-
-		return character_id;
-
-	} catch (...) {
-
-		std::error_code ignored;
+	const auto now{_to_epoch_seconds(std::chrono::system_clock::now())};
+	SaveHeader character{.id = character_id,
+						 .game_id = game_id,
+						 .key = {},
+						 .name = std::move(name),
+						 .status = "OK",
+						 .created = now,
+						 .modified = now};
 
-		std::filesystem::remove(temporary_file, ignored);
+	_roster->put(character_id,
+				 encode(SaveKind::CHARACTER, character, payload));
+	_characters.insert_or_assign(character_id, std::move(character));
 
-		throw;
-	}
+	return character_id;
 }
 
 auto Sorcery::SaveStore::update_character(const unsigned int game_id,
 										  const unsigned int character_id,
-										  std::string name, std::string data)
-	-> bool {
+										  std::string name,
+										  const SavePayload &payload) -> bool {
 
 	DEBUG_LOGF(
 		"SaveStore::update_character(game_file='{}', "
 		"characters_directory='{}')",
 		_game_file.string(), _characters_directory.string());
 
-	const auto character_file{_characters_directory /
-							  (std::to_string(character_id) + ".json")};
-
-	std::error_code error;
-
-	if (!std::filesystem::is_regular_file(character_file, error)) {
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect character save file", character_file, error};
-		}
-
-		return false;
-	}
-
-	CharacterSaveRecord character;
-
-	try {
-		std::ifstream input{character_file, std::ios::in};
-
-		if (!input.is_open()) {
-			throw std::runtime_error{"Unable to open character save file: " +
-									 character_file.string()};
-		}
-
-		cereal::JSONInputArchive archive{input};
-
-		archive(cereal::make_nvp("character", character));
-
-	} catch (const cereal::Exception &error) {
-		throw std::runtime_error{"Unable to deserialize character save file '" +
-								 character_file.string() +
-								 "': " + error.what()};
-	}
-
-	if (character.version != 1) {
-		throw std::runtime_error{"Unsupported character save version " +
-								 std::to_string(character.version) +
-								 " in file: " + character_file.string()};
-	}
-
-	if (character.id != character_id) {
-		throw std::runtime_error{
-			"Character ID does not match its save filename: " +
-			character_file.string()};
-	}
-
-	if (character.game_id != game_id)
+	const auto header{_character_header(character_id)};
+	if (!header || header->game_id != game_id)
 		return false;
 
+	auto character{*header};
 	character.name = std::move(name);
-	character.data = std::move(data);
 	character.status = "OK";
+	character.modified = _to_epoch_seconds(std::chrono::system_clock::now());
 
-	const auto temporary_file{
-		std::filesystem::path{character_file.string() + ".tmp"}};
-
-	try {
-		{
-			std::ofstream output{temporary_file,
-								 std::ios::out | std::ios::trunc};
-
-			if (!output.is_open()) {
-				throw std::runtime_error{
-					"Unable to open temporary character save file: " +
-					temporary_file.string()};
-			}
-
-			cereal::JSONOutputArchive archive{output};
-
-			archive(cereal::make_nvp("character", character));
-
-			output.flush();
-
-			if (!output) {
-				throw std::runtime_error{
-					"Unable to write temporary character save file: " +
-					temporary_file.string()};
-			}
-		}
-
-		error.clear();
-
-		std::filesystem::rename(temporary_file, character_file, error);
-
-		if (error) {
-			error.clear();
-
-			std::filesystem::remove(character_file, error);
-
-			if (error) {
-				throw std::filesystem::filesystem_error{
-					"Unable to replace the existing character save file",
-					character_file, error};
-			}
-
-			std::filesystem::rename(temporary_file, character_file, error);
-
-			if (error) {
-				throw std::filesystem::filesystem_error{
-					"Unable to install the updated character save file",
-					temporary_file, character_file, error};
-			}
-		}
+	_roster->put(character_id,
+				 encode(SaveKind::CHARACTER, character, payload));
+	_characters.insert_or_assign(character_id, std::move(character));
 
-		return true;
-
-	} catch (...) {
-		std::error_code ignored_error;
-
-		std::filesystem::remove(temporary_file, ignored_error);
-
-		throw;
-	}
+	return true;
 }
 
 auto Sorcery::SaveStore::delete_character(const unsigned int game_id,
@@ -681,150 +745,22 @@ auto Sorcery::SaveStore::delete_character(const unsigned int game_id,
 		"characters_directory='{}')",
 		_game_file.string(), _characters_directory.string());
 
-	const auto character_file{_characters_directory /
-							  (std::to_string(character_id) + ".json")};
-
-	std::error_code error;
-
-	if (!std::filesystem::exists(character_file, error)) {
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect character save file", character_file, error};
-		}
-
+	const auto header{_character_header(character_id)};
+	if (!header || header->game_id != game_id)
 		return;
-	}
 
-	CharacterSaveRecord character;
-
-	try {
-
-		std::ifstream input{character_file, std::ios::in};
-
-		if (!input.is_open()) {
-			throw std::runtime_error{"Unable to open character save file: " +
-									 character_file.string()};
-		}
-
-		cereal::JSONInputArchive archive{input};
-
-		archive(cereal::make_nvp("character", character));
-
-	} catch (const cereal::Exception &error) {
-
-		throw std::runtime_error{"Unable to deserialize character save file '" +
-								 character_file.string() +
-								 "': " + error.what()};
-	}
-
-	if (character.game_id != game_id)
-		return;
-
-	error.clear();
-
-	std::filesystem::remove(character_file, error);
-
-	if (error) {
-		throw std::filesystem::filesystem_error{
-			"Unable to remove character save file", character_file, error};
-	}
+	_roster->erase(character_id);
+	_characters.erase(character_id);
 }
 
 auto Sorcery::SaveStore::get_character_ids(const unsigned int game_id) const
-	-> std::vector<unsigned int> {
+	-> const std::vector<unsigned int> & {
 
-	DEBUG_LOGF(
-		"SaveStore::get_character_ids(game_file='{}', "
-		"characters_directory='{}')",
-		_game_file.string(), _characters_directory.string());
-
-	// There is currently only one active game, so character files all belong
-	// to that game
+	// There is currently only one active game, so the roster only ever holds
+	// characters belonging to that game
 	static_cast<void>(game_id);
 
-	std::vector<unsigned int> character_ids;
-
-	std::error_code error;
-
-	if (!std::filesystem::exists(_characters_directory, error)) {
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect the character save directory",
-				_characters_directory, error};
-		}
-
-		return character_ids;
-	}
-
-	if (!std::filesystem::is_directory(_characters_directory, error)) {
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect the character save directory",
-				_characters_directory, error};
-		}
-
-		throw std::runtime_error{"Character save path is not a directory: " +
-								 _characters_directory.string()};
-	}
-
-	std::filesystem::directory_iterator iterator{_characters_directory, error};
-
-	if (error) {
-		throw std::filesystem::filesystem_error{
-			"Unable to open the character save directory",
-			_characters_directory, error};
-	}
-
-	const std::filesystem::directory_iterator end;
-	while (iterator != end) {
-		const auto &entry{*iterator};
-
-		error.clear();
-
-		if (entry.is_regular_file(error) &&
-			entry.path().extension() == ".json") {
-
-			const std::string stem{entry.path().stem().string()};
-
-			unsigned int character_id{};
-
-			const auto [ptr, conversion_error]{std::from_chars(
-				stem.data(), stem.data() + stem.size(), character_id)};
-
-			/*
-			 * Accept only complete positive integer filenames:
-			 *
-			 *     1.json      valid
-			 *     12.json     valid
-			 *     0.json      ignored
-			 *     1-old.json  ignored
-			 *     fred.json   ignored
-			 */
-			if (conversion_error == std::errc{} &&
-				ptr == stem.data() + stem.size() && character_id > 0) {
-
-				character_ids.emplace_back(character_id);
-			}
-		}
-
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect a character save entry", entry.path(),
-				error};
-		}
-
-		iterator.increment(error);
-
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to enumerate the character save directory",
-				_characters_directory, error};
-		}
-	}
-
-	std::ranges::sort(character_ids);
-
-	return character_ids;
+	return _roster->ids();
 }
 
 auto Sorcery::SaveStore::get_character(const unsigned int game_id,
@@ -836,46 +772,109 @@ auto Sorcery::SaveStore::get_character(const unsigned int game_id,
 		"characters_directory='{}')",
 		_game_file.string(), _characters_directory.string());
 
-	const auto character_file{_characters_directory /
-							  (std::to_string(character_id) + ".json")};
-
-	std::error_code error;
+	auto character{read_character(*_roster, character_id)};
+	if (!character)
+		return {};
 
-	if (!std::filesystem::is_regular_file(character_file, error)) {
-		if (error) {
-			throw std::filesystem::filesystem_error{
-				"Unable to inspect character save file", character_file, error};
-		}
+	_characters.insert_or_assign(character_id, character->header);
 
+	if (character->header.game_id != game_id)
 		return {};
-	}
 
-	CharacterSaveRecord character;
+	return std::move(character->data);
+}
 
-	try {
+// Where the game's log keeps the messages that no longer fit in memory
+auto Sorcery::SaveStore::journal_file() const -> std::filesystem::path {
 
-		std::ifstream input{character_file, std::ios::in};
+	return _game_file.parent_path() / SAVE_JOURNAL_FILE;
+}
 
-		if (!input.is_open()) {
-			throw std::runtime_error{"Unable to open character save file: " +
-									 character_file.string()};
-		}
+// Headers are normally already known from an earlier load or save, and only
+// decoded the first time a character is touched
+auto Sorcery::SaveStore::_character_header(
+	const unsigned int character_id) const -> std::optional<SaveHeader> {
 
-		cereal::JSONInputArchive archive{input};
+	if (const auto it{_characters.find(character_id)}; it != _characters.end())
+		return it->second;
 
-		archive(cereal::make_nvp("character", character));
+	auto character{read_character(*_roster, character_id)};
+	if (!character)
+		return std::nullopt;
 
-	} catch (const cereal::Exception &error) {
+	return _characters
+		.insert_or_assign(character_id, std::move(character->header))
+		.first->second;
+}
 
-		throw std::runtime_error{"Unable to deserialize character save file '" +
-								 character_file.string() +
-								 "': " + error.what()};
-	}
+auto Sorcery::SaveStore::_game_header() const -> const SaveHeader & {
 
-	if (character.game_id != game_id)
-		return {};
+	if (!_game)
+		_game = read_save(_game_file, SaveKind::GAME).header;
 
-	return character.data;
+	return *_game;
+}
+
+// Convert a game save still in the older JSON format, leaving its payload as
+// it is (Game can read either kind of payload, and rewrites them when it next
+// saves), and import any characters still in a file of their own into the
+// roster, newer format first
+auto Sorcery::SaveStore::_migrate() -> void {
+
+	const auto legacy_game_file{_game_file.parent_path() /
+								SAVE_LEGACY_GAME_FILE};
+
+	std::error_code error;
+
+	if (std::filesystem::is_regular_file(legacy_game_file, error) &&
+		!has_game()) {
+		const auto game{read_save(legacy_game_file, SaveKind::GAME)};
+		write_save(_game_file, SaveKind::GAME, game.header,
+				   to_payload(game.data, compress));
+		std::filesystem::remove(legacy_game_file, error);
+		DEBUG_LOGF("Migrated {}", legacy_game_file.string());
+	}
+
+	std::vector<std::filesystem::path> loose_files{};
+	for (const auto &entry : std::filesystem::directory_iterator{
+			 _characters_directory, error}) {
+		if (entry.is_regular_file() &&
+			(entry.path().extension() == SAVE_EXTENSION ||
+			 entry.path().extension() == SAVE_LEGACY_EXTENSION) &&
+			character_id_of(entry.path()) > 0)
+			loose_files.emplace_back(entry.path());
+	}
+	std::ranges::stable_partition(loose_files, [](const auto &path) {
+		return path.extension() == SAVE_EXTENSION;
+	});
+
+	// A file is only removed once it is in the roster: one whose id is taken
+	// already (such as the older format of one just imported, or one left
+	// after the roster was restored from a backup) or that can't be read is
+	// left where it is
+	for (const auto &loose_file : loose_files) {
+		const auto character_id{character_id_of(loose_file)};
+		if (_roster->contains(character_id)) {
+			DEBUG_LOGF("Not importing {}, as the roster already has {}",
+					   loose_file.string(), character_id);
+			continue;
+		}
+
+		try {
+			auto character{read_save(loose_file, SaveKind::CHARACTER)};
+			character.header.id = character_id;
+			_roster->put(character_id,
+						 encode(SaveKind::CHARACTER, character.header,
+								to_payload(character.data, compress)));
+		} catch (const std::exception &e) {
+			std::println(stderr, "Unable to import {} into the roster: {}",
+						 loose_file.string(), e.what());
+			continue;
+		}
+
+		std::filesystem::remove(loose_file, error);
+		DEBUG_LOGF("Imported {} into the roster", loose_file.string());
+	}
 }
 
 auto Sorcery::SaveStore::_to_epoch_seconds(
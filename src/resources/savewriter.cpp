@@ -0,0 +1,194 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "resources/savewriter.hpp"
+#include "core/debug.hpp"
+#include "resources/savestore.hpp"
+
+#include <exception>
+#include <utility>
+
+namespace {
+
+// Newer wins, other than characters only in the older snapshot
+auto merge(Sorcery::SaveWriter::Snapshot &into,
+		   Sorcery::SaveWriter::Snapshot &&from) -> void {
+
+	into.game_id = from.game_id;
+	into.key = std::move(from.key);
+	into.state = std::move(from.state);
+	for (auto &[id, character] : from.characters)
+		into.characters.insert_or_assign(id, std::move(character));
+}
+
+}
+
+Sorcery::SaveWriter::SaveWriter(SaveStore &saves)
+	: _saves{saves},
+	  _status{SaveStatus::IDLE},
+	  _writing{false} {
+
+	_thread = std::jthread([this](std::stop_token stop) { _run(stop); });
+}
+
+Sorcery::SaveWriter::~SaveWriter() {
+
+	stop();
+}
+
+auto Sorcery::SaveWriter::submit(Snapshot snapshot) -> void {
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	// Once stopped there is nothing left to hand the write to
+	if (!_thread.joinable()) {
+		lock.unlock();
+		_write(snapshot);
+		return;
+	}
+
+	if (_retry) {
+		merge(*_retry, std::move(snapshot));
+		snapshot = std::move(*_retry);
+		_retry.reset();
+	}
+
+	if (_pending)
+		merge(*_pending, std::move(snapshot));
+	else
+		_pending = std::move(snapshot);
+
+	_status = SaveStatus::PENDING;
+	_wake.notify_one();
+}
+
+// Wait until everything submitted so far has been written (or has failed),
+// returning false if anything failed
+auto Sorcery::SaveWriter::flush() -> bool {
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_idle.wait(lock, [this] { return !_pending && !_writing; });
+
+	return _status != SaveStatus::FAILED;
+}
+
+// Drop anything that hasn't been written yet, including anything waiting to be
+// retried, for when the saves it would go into are being wiped or replaced (a
+// write already in progress is waited for, as it can't be stopped part way)
+auto Sorcery::SaveWriter::discard() -> void {
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_pending.reset();
+	_idle.wait(lock, [this] { return !_writing; });
+
+	// A write that failed in the meantime will have been put back
+	_pending.reset();
+	_retry.reset();
+	_error.clear();
+	_status = SaveStatus::IDLE;
+}
+
+// Flush, including one last attempt at anything that failed, and then stop
+auto Sorcery::SaveWriter::stop() -> void {
+
+	if (!_thread.joinable())
+		return;
+
+	{
+		std::scoped_lock<std::mutex> scoped_lock(_mutex);
+		if (_retry && !_pending) {
+			_pending = std::move(*_retry);
+			_retry.reset();
+			_wake.notify_one();
+		}
+	}
+
+	if (!flush())
+		DEBUG_LOGF("Unable to save on exit: {}", error());
+
+	_thread.request_stop();
+	_thread.join();
+}
+
+auto Sorcery::SaveWriter::status() const -> SaveStatus {
+
+	return _status;
+}
+
+auto Sorcery::SaveWriter::error() const -> std::string {
+
+	std::scoped_lock<std::mutex> scoped_lock(_mutex);
+
+	return _error;
+}
+
+auto Sorcery::SaveWriter::_run(std::stop_token stop) -> void {
+
+	while (!stop.stop_requested()) {
+		std::unique_lock<std::mutex> lock(_mutex);
+		if (!_wake.wait(lock, stop, [this] { return _pending.has_value(); }))
+			return;
+
+		auto snapshot{std::move(*_pending)};
+		_pending.reset();
+		_writing = true;
+		_status = SaveStatus::WRITING;
+		lock.unlock();
+
+		std::string failure{};
+		try {
+			_write(snapshot);
+		} catch (const std::exception &e) {
+			failure = e.what();
+		}
+
+		lock.lock();
+		_writing = false;
+		if (failure.empty()) {
+			_retry.reset();
+			_error.clear();
+			_status = _pending ? SaveStatus::PENDING : SaveStatus::IDLE;
+		} else {
+
+			// Keep hold of it so that it is tried again along with whatever
+			// is submitted next
+			if (_pending) {
+				merge(snapshot, std::move(*_pending));
+				_pending = std::move(snapshot);
+			} else
+				_retry = std::move(snapshot);
+			_error = failure;
+			_status = SaveStatus::FAILED;
+			DEBUG_LOGF("Save failed: {}", failure);
+		}
+		_idle.notify_all();
+	}
+}
+
+auto Sorcery::SaveWriter::_write(const Snapshot &snapshot) -> void {
+
+	_saves.save_game_state(snapshot.game_id, snapshot.key, snapshot.state);
+	for (const auto &[id, character] : snapshot.characters)
+		_saves.update_character(snapshot.game_id, id, character.name,
+								character.data);
+}
@@ -20,48 +20,44 @@
 // the licensors of this program grant you additional permission to convey
 // the resulting work.
 
-#include <ranges>
-
 #include "common/enum.hpp"
 #include "common/macro.hpp"
 #include "core/context.hpp"
 #include "resources/spellstore.hpp"
 #include "resources/stringstore.hpp"
 
+#include <stdexcept>
+#include <string>
+
 Sorcery::SpellStore::SpellStore(Context &ctx)
 	: _ctx{ctx} {
 
 	_load();
 }
 
-auto Sorcery::SpellStore::get(Enums::Magic::SpellID spell_id) const -> Spell {
-
-	const auto it = std::ranges::find(_spells, spell_id, &Spell::id);
+auto Sorcery::SpellStore::get(Enums::Magic::SpellID spell_id) const
+	-> const Spell & {
 
-	// Always assumes a spell can be found
-	assert(it != _spells.end());
-
-	return *it;
+	// NO_SPELL is -1, so is out of range too
+	return _spells.at(std::to_underlying(spell_id));
 }
+
 auto Sorcery::SpellStore::get(Enums::Magic::SpellCategory category) const
-	-> std::vector<Spell> {
+	-> std::span<const Enums::Magic::SpellID> {
 
-	return _spells | std::views::filter([category](const Spell &spell) {
-			   return spell.category == category;
-		   }) |
-		   std::ranges::to<std::vector>();
+	return _by_category.at(std::to_underlying(category));
 }
 
-auto Sorcery::SpellStore::get(std::string_view name) const -> Spell {
-	const auto it = std::ranges::find(_spells, name, &Spell::name);
+auto Sorcery::SpellStore::get(std::string_view name) const -> const Spell & {
 
-	// Always assumes a spell can be found
-	assert(it != _spells.end());
+	const auto it{_names.find(name)};
+	if (it == _names.end())
+		throw std::out_of_range{"Spell not found: " + std::string{name}};
 
-	return *it;
+	return get(it->second);
 }
 
-auto Sorcery::SpellStore::get_all() -> std::vector<Spell> {
+auto Sorcery::SpellStore::get_all() const -> std::span<const Spell> {
 
 	return _spells;
 }
@@ -71,6 +67,9 @@ auto Sorcery::SpellStore::_load() -> void {
 
 	_loaded = false;
 	_spells.clear();
+	_names.clear();
+	for (auto &list : _by_category)
+		list.clear();
 
 	// Mage Spells (grouped by level)
 
@@ -321,5 +320,16 @@ auto Sorcery::SpellStore::_load() -> void {
 						 _ctx.get_string("SPELL_MALIKTO_TITLE"),
 						 _ctx.get_string("SPELL_MALIKTO_DESC"));
 
+	// Spells are added in SpellID order, so the vector is already a dense
+	// index by id; names and categories get their own lookups
+	for (const auto &spell : _spells) {
+		if (_spells.at(std::to_underlying(spell.id)).id != spell.id)
+			throw std::logic_error{"Spell " + spell.name +
+								   " is out of SpellID order"};
+		_names.try_emplace(spell.name, spell.id);
+		_by_category.at(std::to_underlying(spell.category))
+			.push_back(spell.id);
+	}
+
 	_loaded = true;
 }
\ No newline at end of file
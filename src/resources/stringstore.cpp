@@ -20,30 +20,90 @@
 // the licensors of this program grant you additional permission to convey
 // the resulting work.
 
+#include <algorithm>
 #include <fstream>
+#include <utility>
 
+#include "resources/bakedfile.hpp"
 #include "resources/define.hpp"
 #include "resources/stringstore.hpp"
 #include <jsoncpp/json/json.h>
 
-Sorcery::StringStore::StringStore(const std::string &filename)
-	: _filename{filename} {
+Sorcery::StringStore::StringStore(const Resource &resource,
+								  const BakedFile *baked)
+	: _resource{resource} {
 
-	// Load strings from file
-	_loaded = _load();
+	// Load strings from the baked copy if it is current, otherwise the file
+	// (reloads always go to the file, as that is what is being edited)
+	_loaded = baked &&
+			  BakedFile::unpack(
+				  baked->get(STRINGS_FILE, resource, bake_schema()), _strings);
+	if (_loaded)
+		_strings.index();
+	else
+		_loaded = _load(_strings);
+	_generation = 1;
 }
 
 auto Sorcery::StringStore::reload() -> void {
 
-	_loaded = _load();
+	_loaded = _load(_strings);
+	_generation++;
+}
+
+auto Sorcery::StringStore::get_resource() const -> const Resource & {
+
+	return _resource;
+}
+
+// Called from the FileWatcher thread; a file that fails to parse is ignored
+// so that the strings in use are kept
+auto Sorcery::StringStore::reparse() -> void {
+
+	auto staged{std::make_unique<Strings>()};
+	if (!_load(*staged))
+		return;
+
+	std::scoped_lock<std::mutex> scoped_lock(_staged_mutex);
+	_staged = std::move(staged);
+}
+
+// Called on the main thread at a frame boundary
+auto Sorcery::StringStore::commit() -> void {
+
+	std::scoped_lock<std::mutex> scoped_lock(_staged_mutex);
+	if (!_staged)
+		return;
+
+	_strings = std::move(*_staged);
+	_staged.reset();
+	_loaded = true;
+	_generation++;
+}
+
+// Everything loaded, for sorcery-bake to write out
+auto Sorcery::StringStore::bake() const -> std::string {
+
+	return BakedFile::pack(_strings);
+}
+
+auto Sorcery::StringStore::bake_schema() -> std::uint64_t {
+
+	return BakedFile::schema<Strings>(BAKE_STRINGS_REVISION);
 }
 
-auto Sorcery::StringStore::_load() -> bool {
+// Bumped whenever the strings change, so that cached text sizes are redone
+auto Sorcery::StringStore::generation() const -> std::uint64_t {
+
+	return _generation;
+}
+
+auto Sorcery::StringStore::_load(Strings &strings) const -> bool {
 
 	// Attempt to load the Strings File
-	_strings.clear();
-	_strings["NONE"] = STRINGS_NOT_LOADED;
-	if (std::ifstream file{_filename, std::ifstream::binary}; file.good()) {
+	strings.clear();
+	strings.add("NONE", STRINGS_NOT_LOADED);
+	if (auto file{_resource.stream()}; file->good()) {
 
 		// Iterate through the file
 		Json::Value root{};
@@ -53,7 +113,7 @@ auto Sorcery::StringStore::_load() -> bool {
 #pragma GCC diagnostic pop
 		Json::StreamWriterBuilder builder{};
 		builder.settings_["indentation"] = "";
-		if (reader.parse(file, root, false)) {
+		if (reader.parse(*file, root, false)) {
 			for (Json::Value::iterator it = root.begin(); it != root.end();
 				 ++it) {
 				Json::Value key{it.key()};
@@ -72,23 +132,32 @@ auto Sorcery::StringStore::_load() -> bool {
 					remove(string_key.begin(), string_key.end(), '\n'),
 					string_key.end());
 
-				// Insert it into the map
-				_strings[string_key] = string_value;
+				strings.add(string_key, string_value);
 			}
 		} else
 			return false;
 	} else
 		return false;
 
+	strings.index();
+
 	return true;
 }
 
-auto Sorcery::StringStore::get(std::string_view key) const -> std::string {
+// The views returned are into the strings themselves, and so last until the
+// next reload (which only ever happens at a frame boundary)
+auto Sorcery::StringStore::get(std::string_view key) const -> std::string_view {
 
 	if (_loaded)
-		return _strings.contains(std::string{key})
-				   ? _strings.at(std::string{key})
-				   : KEY_NOT_FOUND;
+		return _strings.find(key).value_or(KEY_NOT_FOUND);
 	else
 		return STRINGS_NOT_LOADED;
-}
\ No newline at end of file
+}
+
+auto Sorcery::StringStore::get(const StringID id) const -> std::string_view {
+
+	if (_loaded)
+		return _strings.find(id).value_or(KEY_NOT_FOUND);
+	else
+		return STRINGS_NOT_LOADED;
+}
@@ -0,0 +1,136 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "resources/stringtable.hpp"
+#include "resources/stringkeys.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace {
+
+auto fnv1a(const std::string_view value) -> std::uint64_t {
+
+	auto hash{14695981039346656037ull};
+	for (const auto c : value) {
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+}
+
+// Nothing can be found until the table is indexed again
+auto Sorcery::StringTable::add(std::string_view key, std::string_view value)
+	-> void {
+
+	const auto append{[this](std::string_view text) {
+		const auto offset{static_cast<std::uint32_t>(_arena.size())};
+		_arena.append(text);
+		_arena.push_back('\0');
+		return offset;
+	}};
+
+	const auto key_offset{append(key)};
+	const auto value_offset{append(value)};
+	_entries.emplace_back(key_offset, static_cast<std::uint32_t>(key.size()),
+						  value_offset,
+						  static_cast<std::uint32_t>(value.size()));
+	_slots.clear();
+	_ids.clear();
+}
+
+// Build the hash table (kept at most half full, so probes are short) and
+// then resolve every generated StringID against it. Where a key was added
+// more than once, the last one wins
+auto Sorcery::StringTable::index() -> void {
+
+	_slots.assign(std::bit_ceil(std::max(_entries.size() * 2, 16uz)), EMPTY);
+	for (auto i = 0uz; i < _entries.size(); i++)
+		_slots[_slot(_key(_entries[i]))] = static_cast<std::uint32_t>(i + 1);
+
+	_ids.assign(STRING_KEYS.size(), MISSING);
+	for (auto id = 0uz; id < STRING_KEYS.size(); id++)
+		if (const auto slot{_slots[_slot(STRING_KEYS[id])]}; slot != EMPTY)
+			_ids[id] = slot - 1;
+}
+
+auto Sorcery::StringTable::clear() -> void {
+
+	_arena.clear();
+	_entries.clear();
+	_slots.clear();
+	_ids.clear();
+}
+
+auto Sorcery::StringTable::size() const -> std::size_t {
+
+	return _entries.size();
+}
+
+auto Sorcery::StringTable::find(std::string_view key) const
+	-> std::optional<std::string_view> {
+
+	if (_slots.empty())
+		return std::nullopt;
+	if (const auto slot{_slots[_slot(key)]}; slot != EMPTY)
+		return _value(_entries[slot - 1]);
+
+	return std::nullopt;
+}
+
+auto Sorcery::StringTable::find(const StringID id) const
+	-> std::optional<std::string_view> {
+
+	const auto index{static_cast<std::size_t>(std::to_underlying(id))};
+	if (index >= _ids.size() || _ids[index] == MISSING)
+		return std::nullopt;
+
+	return _value(_entries[_ids[index]]);
+}
+
+// Linear probing from the key's hash: the slot holding the key, or else the
+// empty one where it would go
+auto Sorcery::StringTable::_slot(std::string_view key) const -> std::size_t {
+
+	const auto mask{_slots.size() - 1};
+	auto slot{static_cast<std::size_t>(fnv1a(key)) & mask};
+	while (_slots[slot] != EMPTY && _key(_entries[_slots[slot] - 1]) != key)
+		slot = (slot + 1) & mask;
+
+	return slot;
+}
+
+auto Sorcery::StringTable::_key(const Entry &entry) const -> std::string_view {
+
+	return {_arena.data() + entry.key, entry.key_size};
+}
+
+auto Sorcery::StringTable::_value(const Entry &entry) const
+	-> std::string_view {
+
+	return {_arena.data() + entry.value, entry.value_size};
+}
@@ -0,0 +1,224 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "resources/zstream.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+auto zlib_error(const char *what, const z_stream &zs, const int result)
+	-> std::runtime_error {
+
+	return std::runtime_error{std::string{what} + ": " +
+							  (zs.msg ? zs.msg : std::to_string(result))};
+}
+
+}
+
+Sorcery::DeflateBuffer::DeflateBuffer(std::ostream &sink, const int level)
+	: _sink{sink},
+	  _zs{},
+	  _finished{false} {
+
+	if (const auto result{deflateInit(&_zs, level)}; result != Z_OK)
+		throw zlib_error("Unable to start compressing", _zs, result);
+
+	setp(_in.data(), _in.data() + _in.size());
+}
+
+Sorcery::DeflateBuffer::~DeflateBuffer() {
+
+	deflateEnd(&_zs);
+}
+
+// Everything written so far is deflated and the stream ended; nothing more
+// may be written afterwards
+auto Sorcery::DeflateBuffer::finish() -> void {
+
+	if (_finished)
+		return;
+
+	_deflate(Z_FINISH);
+	_finished = true;
+}
+
+auto Sorcery::DeflateBuffer::consumed() const noexcept -> std::uint64_t {
+
+	return _zs.total_in;
+}
+
+auto Sorcery::DeflateBuffer::produced() const noexcept -> std::uint64_t {
+
+	return _zs.total_out;
+}
+
+auto Sorcery::DeflateBuffer::overflow(const int_type ch) -> int_type {
+
+	if (_finished)
+		return traits_type::eof();
+
+	_deflate(Z_NO_FLUSH);
+	if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+		*pptr() = traits_type::to_char_type(ch);
+		pbump(1);
+	}
+
+	return traits_type::not_eof(ch);
+}
+
+// Deflating already buffers, so there is nothing to gain from flushing part
+// way through - only finish() ends a block
+auto Sorcery::DeflateBuffer::sync() -> int {
+
+	return _sink.good() ? 0 : -1;
+}
+
+// Large writes (such as a whole payload) go straight to zlib rather than
+// being copied through the put area first
+auto Sorcery::DeflateBuffer::xsputn(const char *data,
+									const std::streamsize count)
+	-> std::streamsize {
+
+	if (_finished)
+		return 0;
+
+	if (count < static_cast<std::streamsize>(epptr() - pptr())) {
+		std::memcpy(pptr(), data, static_cast<std::size_t>(count));
+		pbump(static_cast<int>(count));
+		return count;
+	}
+
+	_deflate(Z_NO_FLUSH);
+	_zs.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+	_zs.avail_in = static_cast<uInt>(count);
+	while (_zs.avail_in > 0) {
+		_zs.next_out = reinterpret_cast<Bytef *>(_out.data());
+		_zs.avail_out = static_cast<uInt>(_out.size());
+		if (const auto result{deflate(&_zs, Z_NO_FLUSH)};
+			result == Z_STREAM_ERROR)
+			throw zlib_error("Unable to compress", _zs, result);
+		_sink.write(_out.data(), static_cast<std::streamsize>(
+									 _out.size() - _zs.avail_out));
+	}
+
+	return _sink ? count : 0;
+}
+
+// Pass whatever is in the put area to zlib, writing out anything it produces
+auto Sorcery::DeflateBuffer::_deflate(const int flush) -> void {
+
+	_zs.next_in = reinterpret_cast<Bytef *>(pbase());
+	_zs.avail_in = static_cast<uInt>(pptr() - pbase());
+
+	auto result{Z_OK};
+	do {
+		_zs.next_out = reinterpret_cast<Bytef *>(_out.data());
+		_zs.avail_out = static_cast<uInt>(_out.size());
+		result = deflate(&_zs, flush);
+		if (result == Z_STREAM_ERROR)
+			throw zlib_error("Unable to compress", _zs, result);
+		_sink.write(_out.data(),
+					static_cast<std::streamsize>(_out.size() - _zs.avail_out));
+	} while (_zs.avail_out == 0 ||
+			 (flush == Z_FINISH && result != Z_STREAM_END));
+
+	setp(_in.data(), _in.data() + _in.size());
+}
+
+Sorcery::InflateBuffer::InflateBuffer(std::istream &source)
+	: _source{source},
+	  _zs{},
+	  _ended{false} {
+
+	if (const auto result{inflateInit(&_zs)}; result != Z_OK)
+		throw zlib_error("Unable to start decompressing", _zs, result);
+
+	setg(_out.data(), _out.data(), _out.data());
+}
+
+Sorcery::InflateBuffer::~InflateBuffer() {
+
+	inflateEnd(&_zs);
+}
+
+auto Sorcery::InflateBuffer::underflow() -> int_type {
+
+	if (gptr() < egptr())
+		return traits_type::to_int_type(*gptr());
+
+	_zs.next_out = reinterpret_cast<Bytef *>(_out.data());
+	_zs.avail_out = static_cast<uInt>(_out.size());
+	while (!_ended && _zs.avail_out == _out.size()) {
+		if (_zs.avail_in == 0) {
+			_source.read(_in.data(), static_cast<std::streamsize>(_in.size()));
+			_zs.next_in = reinterpret_cast<Bytef *>(_in.data());
+			_zs.avail_in = static_cast<uInt>(_source.gcount());
+			if (_zs.avail_in == 0)
+				throw std::runtime_error{"Compressed data is truncated"};
+		}
+
+		const auto result{inflate(&_zs, Z_NO_FLUSH)};
+		if (result == Z_STREAM_END)
+			_ended = true;
+		else if (result != Z_OK)
+			throw zlib_error("Unable to decompress", _zs, result);
+	}
+
+	setg(_out.data(), _out.data(),
+		 _out.data() + (_out.size() - _zs.avail_out));
+
+	return gptr() < egptr() ? traits_type::to_int_type(*gptr())
+							: traits_type::eof();
+}
+
+Sorcery::DeflateStream::DeflateStream(std::ostream &sink, const int level)
+	: std::ostream{nullptr},
+	  _buffer{sink, level} {
+
+	rdbuf(&_buffer);
+}
+
+auto Sorcery::DeflateStream::finish() -> void {
+
+	_buffer.finish();
+}
+
+auto Sorcery::DeflateStream::consumed() const noexcept -> std::uint64_t {
+
+	return _buffer.consumed();
+}
+
+auto Sorcery::DeflateStream::produced() const noexcept -> std::uint64_t {
+
+	return _buffer.produced();
+}
+
+Sorcery::InflateStream::InflateStream(std::istream &source)
+	: std::istream{nullptr},
+	  _buffer{source} {
+
+	rdbuf(&_buffer);
+}
@@ -70,7 +70,7 @@ auto Sorcery::Create::start() -> int {
 	while (!done) {
 
 		SDL_Event event;
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -137,7 +137,7 @@ auto Sorcery::Create::start() -> int {
 			_ctx.ui->display(Enums::Screen::CREATE_CONFIRM,
 							 std::to_underlying(candidate->get_stage()));
 
-			if (_ctx.controller->has_flag("confirm_keep_character")) {
+			if (_ctx.controller->has_flag(CONTROL("confirm_keep_character"))) {
 
 				candidate->set_stage(COMPLETED);
 				candidate->set_location(Enums::Character::Location::TAVERN);
@@ -148,12 +148,14 @@ auto Sorcery::Create::start() -> int {
 				_ctx.game->creation_candidate.reset();
 				_ctx.game->save_game();
 
-				_ctx.controller->unset_flag("confirm_keep_character");
+				_ctx.controller->unset_flag(CONTROL("confirm_keep_character"));
 				return BACK_TO_TRAINING_GROUNDS;
-			} else if (_ctx.controller->has_flag("confirm_discard_character")) {
+			} else if (_ctx.controller->has_flag(
+						   CONTROL("confirm_discard_character"))) {
 
 				_ctx.game->creation_candidate.reset();
-				_ctx.controller->unset_flag("confirm_discard_character");
+				_ctx.controller->unset_flag(
+					CONTROL("confirm_discard_character"));
 				return BACK_TO_TRAINING_GROUNDS;
 			}
 
@@ -58,7 +58,7 @@ auto Sorcery::Delete::start() -> int {
 
 	_ctx.controller->clear_character(Enums::CharacterSlot::EDIT);
 
-	_ctx.controller->unset_flag("want_delete_ok");
+	_ctx.controller->unset_flag(CONTROL("want_delete_ok"));
 
 	_ctx.ui->dialog_delete->show = false;
 
@@ -73,7 +73,7 @@ auto Sorcery::Delete::start() -> int {
 
 		SDL_Event event{};
 
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(event)) {
 
@@ -94,7 +94,7 @@ auto Sorcery::Delete::start() -> int {
 
 					_ctx.ui->dialog_delete->show = false;
 
-					_ctx.controller->unset_flag("want_delete_ok");
+					_ctx.controller->unset_flag(CONTROL("want_delete_ok"));
 
 					_ctx.controller->clear_character(
 						Enums::CharacterSlot::EDIT);
@@ -121,7 +121,7 @@ auto Sorcery::Delete::start() -> int {
 		if (!confirming &&
 			_ctx.controller->has_character(Enums::CharacterSlot::EDIT)) {
 
-			_ctx.controller->unset_flag("want_delete_ok");
+			_ctx.controller->unset_flag(CONTROL("want_delete_ok"));
 
 			_ctx.ui->dialog_delete->show = true;
 
@@ -133,9 +133,9 @@ auto Sorcery::Delete::start() -> int {
 		if (confirming) {
 
 			// Yes
-			if (_ctx.controller->has_flag("want_delete_ok")) {
+			if (_ctx.controller->has_flag(CONTROL("want_delete_ok"))) {
 
-				_ctx.controller->unset_flag("want_delete_ok");
+				_ctx.controller->unset_flag(CONTROL("want_delete_ok"));
 
 				_ctx.ui->dialog_delete->show = false;
 
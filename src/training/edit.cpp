@@ -74,7 +74,7 @@ auto Sorcery::Edit::start() -> int {
 
 		SDL_Event event{};
 
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(event)) {
 
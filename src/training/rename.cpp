@@ -52,7 +52,7 @@ auto Sorcery::Rename::_initialise() -> bool {
 auto Sorcery::Rename::start() -> int {
 
 	_ctx.controller->go_to(Enums::Screen::RENAME);
-	_ctx.controller->unset_flag("want_renamed_ok");
+	_ctx.controller->unset_flag(CONTROL("want_renamed_ok"));
 
 	show_immediately();
 
@@ -62,7 +62,7 @@ auto Sorcery::Rename::start() -> int {
 	while (!done) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(event)) {
 
@@ -85,9 +85,9 @@ auto Sorcery::Rename::start() -> int {
 
 		_ctx.tick();
 
-		if (_ctx.controller->has_flag("want_renamed_ok")) {
+		if (_ctx.controller->has_flag(CONTROL("want_renamed_ok"))) {
 
-			_ctx.controller->unset_flag("want_renamed_ok");
+			_ctx.controller->unset_flag(CONTROL("want_renamed_ok"));
 
 			return BACK_TO_EDIT;
 		}
@@ -58,7 +58,7 @@ auto Sorcery::Rite::start() -> int {
 
 	show_immediately();
 
-	_ctx.controller->unset_flag("want_rite_ok");
+	_ctx.controller->unset_flag(CONTROL("want_rite_ok"));
 	_ctx.ui->dialog_rite->show = true;
 
 	_ctx.audio->set_volume(1.0f);
@@ -68,7 +68,7 @@ auto Sorcery::Rite::start() -> int {
 	while (!done) {
 
 		SDL_Event event{};
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(event)) {
 
@@ -85,7 +85,7 @@ auto Sorcery::Rite::start() -> int {
 
 			if (_ctx.controller->check_for_back(event)) {
 				_ctx.ui->dialog_rite->show = false;
-				_ctx.controller->unset_flag("want_rite_ok");
+				_ctx.controller->unset_flag(CONTROL("want_rite_ok"));
 				return BACK_TO_EDIT;
 			}
 		}
@@ -95,8 +95,8 @@ auto Sorcery::Rite::start() -> int {
 		_ctx.tick();
 
 		// Yes
-		if (_ctx.controller->has_flag("want_rite_ok")) {
-			_ctx.controller->unset_flag("want_rite_ok");
+		if (_ctx.controller->has_flag(CONTROL("want_rite_ok"))) {
+			_ctx.controller->unset_flag(CONTROL("want_rite_ok"));
 			break;
 		}
 
@@ -117,7 +117,7 @@ auto Sorcery::Rite::start() -> int {
 
 		SDL_Event event{};
 
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(
 				event,
@@ -180,7 +180,7 @@ auto Sorcery::Rite::stop() -> int {
 
 	_ctx.ui->dialog_rite->show = false;
 
-	_ctx.controller->unset_flag("want_rite_ok");
+	_ctx.controller->unset_flag(CONTROL("want_rite_ok"));
 
 	_ctx.controller->go_to(Enums::Screen::EDIT);
 	;
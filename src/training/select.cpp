@@ -84,7 +84,7 @@ auto Sorcery::Select::start(const Enums::Selection::Edit mode) -> int {
 
 		SDL_Event event{};
 
-		while (SDL_PollEvent(&event)) {
+		while (_ctx.poll_event(event)) {
 
 			switch (process_event(event)) {
 
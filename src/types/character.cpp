@@ -1939,7 +1939,8 @@ auto Sorcery::Character::set_spells() -> void {
 auto Sorcery::Character::create_spells() -> void {
 
 	_spells.clear();
-	_spells = _ctx->resources->spells->get_all();
+	_spells =
+		_ctx->resources->spells->get_all() | std::ranges::to<std::vector>();
 }
 
 auto Sorcery::Character::reset_spells() -> void {
@@ -41,10 +41,12 @@ Sorcery::Component::Component()
 	  type{Enums::Layout::ComponentType::NO_CT},
 	  priority{999},
 	  drawmode{Enums::Layout::DrawMode::NO_DM},
+	  slot{0},
 	  _id{_s_id++} {
 
 	unique_key.clear();
 	_data.clear();
+	_slots.clear();
 	_enabled = false;
 	_visible = false;
 }
@@ -73,6 +75,7 @@ Sorcery::Component::Component(
 	  type{_type},
 	  priority{priority_},
 	  drawmode{drawmode_},
+	  slot{0},
 	  _id{_s_id++} {
 
 	// Unique Key is like this because it is used for runtime component-sorting
@@ -81,33 +84,51 @@ Sorcery::Component::Component(
 	const auto priority_id{std::format("{:03d}", priority)};
 	unique_key = std::format("{}_{}:{}", priority_id, form, name);
 	_data.clear();
+	_slots.clear();
 	_enabled = true;
 	_visible = true;
 }
 
-// Overload the [] operator
-auto Sorcery::Component::get(std::string_view key)
+// Looking a property up by name never interns it - a name that has never been
+// interned can't have been set on any component
+auto Sorcery::Component::get(std::string_view key) const
 	-> std::optional<std::string> {
 
-	return _get(key);
+	if (const auto id{PropertyId::find(key)}; id)
+		return get(*id);
+	else
+		return std::nullopt;
 }
 
-auto Sorcery::Component::get(std::string_view key) const
+auto Sorcery::Component::get(const PropertyId &key) const
 	-> std::optional<std::string> {
 
-	return _get(key);
+	if (const auto *property{_find(key.id())}; property)
+		return property->text;
+	else
+		return std::nullopt;
 }
 
+// Values are parsed here, once, as the layout is loaded; returns false (and
+// leaves the component unchanged) if a value is not valid for its property
 auto Sorcery::Component::set(std::string_view key, std::string_view value)
-	-> void {
-
-	const auto it = std::ranges::find(
-		_data, key, &std::pair<std::string, std::string>::first);
+	-> bool {
 
-	if (it == _data.end())
-		_data.emplace_back(key, value);
-	else
-		it->second = value;
+	const PropertyId id{key};
+	auto property{Property::parse(id, value)};
+	if (!property)
+		return false;
+
+	// Slots hold the index into _data plus one, so that zero means unset
+	if (id.id() >= _slots.size())
+		_slots.resize(id.id() + 1, 0);
+	if (auto &slot{_slots[id.id()]}; slot == 0) {
+		_data.emplace_back(std::move(property.value()));
+		slot = static_cast<std::uint16_t>(_data.size());
+	} else
+		_data[slot - 1] = std::move(property.value());
+
+	return true;
 }
 
 auto Sorcery::Component::set_enabled(bool value) -> void {
@@ -130,16 +151,12 @@ auto Sorcery::Component::get_visible() const -> bool {
 	return _visible;
 }
 
-auto Sorcery::Component::_get(std::string_view key) const
-	-> std::optional<std::string> {
-
-	const auto it = std::ranges::find(
-		_data, key, &std::pair<std::string, std::string>::first);
-
-	if (it == _data.end())
-		return std::nullopt;
+auto Sorcery::Component::_find(std::size_t id) const -> const Property * {
 
-	return it->second;
+	if (id < _slots.size() && _slots[id] != 0)
+		return &_data[_slots[id] - 1];
+	else
+		return nullptr;
 }
 
 auto Sorcery::Component::id() const -> long {
@@ -150,8 +167,8 @@ auto Sorcery::Component::id() const -> long {
 auto Sorcery::Component::get_int(std::string_view key, int fallback) const
 	-> int {
 
-	if (_get(key))
-		return std::stoi(_get(key).value());
+	if (const auto id{PropertyId::find(key)}; id)
+		return get_int(*id, fallback);
 	else
 		return fallback;
 }
@@ -159,8 +176,8 @@ auto Sorcery::Component::get_int(std::string_view key, int fallback) const
 auto Sorcery::Component::get_float(std::string_view key, float fallback) const
 	-> float {
 
-	if (_get(key))
-		return std::stof(_get(key).value());
+	if (const auto id{PropertyId::find(key)}; id)
+		return get_float(*id, fallback);
 	else
 		return fallback;
 }
@@ -168,8 +185,35 @@ auto Sorcery::Component::get_float(std::string_view key, float fallback) const
 auto Sorcery::Component::get_bool(std::string_view key, bool fallback) const
 	-> bool {
 
-	if (_get(key))
-		return _get(key).value() == "true";
+	if (const auto id{PropertyId::find(key)}; id)
+		return get_bool(*id, fallback);
+	else
+		return fallback;
+}
+
+auto Sorcery::Component::get_int(const PropertyId &key, int fallback) const
+	-> int {
+
+	if (const auto *property{_find(key.id())}; property && property->numeric)
+		return property->integer;
+	else
+		return fallback;
+}
+
+auto Sorcery::Component::get_float(const PropertyId &key, float fallback) const
+	-> float {
+
+	if (const auto *property{_find(key.id())}; property && property->numeric)
+		return property->number;
+	else
+		return fallback;
+}
+
+auto Sorcery::Component::get_bool(const PropertyId &key, bool fallback) const
+	-> bool {
+
+	if (const auto *property{_find(key.id())}; property)
+		return property->boolean;
 	else
 		return fallback;
 }
@@ -58,6 +58,17 @@ auto Sorcery::Config::load() -> bool {
 	return _load();
 }
 
+// Switch to a different settings file (from then on, saving writes to it too)
+auto Sorcery::Config::load(const std::filesystem::path &cfg_path) -> bool {
+
+	_cfg_path = cfg_path;
+	_settings->Reset();
+	if (_settings->LoadFile(CSTR(_cfg_path)) < 0)
+		return false;
+
+	return _load();
+}
+
 auto Sorcery::Config::_load() -> bool {
 
 	// Attempt to read the settings from the Settings file if possible
@@ -20,74 +20,57 @@
 // the licensors of this program grant you additional permission to convey
 // the resulting work.
 
-#include <regex>
-
 #include "types/dice.hpp"
 
+#include <algorithm>
+
 std::random_device Sorcery::Dice::_device;
 std::mt19937_64 Sorcery::Dice::_random(_device());
 
-Sorcery::Dice::Dice() {
+auto Sorcery::Dice::seed(const std::uint64_t value) -> void {
 
-	num = 0;
-	dice = 0;
-	mod = 0;
+	_random.seed(value);
 }
 
-Sorcery::Dice::Dice(const unsigned int num_, const unsigned int dice_)
-	: num{num_},
-	  dice{dice_},
-	  mod{0} {}
-
-Sorcery::Dice::Dice(const std::string dice_) {
-
-	if (dice_.length() > 0) {
-		const std::regex regex(R"(^(\d+)d(\d+)[+-]?(\d*)$)");
-		if (std::smatch match; std::regex_search(dice_, match, regex)) {
-			num = std::stoi(match[1]);
-			dice = std::stoi(match[2]);
-			if (match[3].length() > 0)
-				mod = std::stoi(match[3]);
-			else
-				mod = 0;
-			if (dice_.contains('-'))
-				mod = -mod;
-		} else {
-			num = 0;
-			dice = 0;
-			mod = 0;
-		}
-	} else {
-
-		num = 0;
-		dice = 0;
-		mod = 0;
-	}
+auto Sorcery::Dice::roll() const -> int {
+
+	auto result{0};
+	roll({&result, 1});
+
+	return result;
 }
 
-Sorcery::Dice::Dice(const unsigned int num_, const unsigned int dice_,
-					const int mod_)
-	: num{num_},
-	  dice{dice_},
-	  mod{mod_} {}
+// Roll the same dice many times over (e.g. the hit points of a whole group),
+// sharing the one distribution. One die is rolled and multiplied by the
+// number of dice, and no dice at all always comes to 0
+auto Sorcery::Dice::roll(std::span<int> results) const -> void {
 
-auto Sorcery::Dice::roll() const -> int {
+	if (dice == 0) {
+		std::ranges::fill(results, 0);
+		return;
+	}
 
-	if (dice > 0) {
-		auto dist{std::uniform_int_distribution<unsigned int>(1, dice)};
-		return num * dist(_random) + mod;
-	} else
-		return 0;
+	std::uniform_int_distribution<unsigned int> die{1, dice};
+	for (auto &result : results)
+		result = static_cast<int>(num * die(_random)) + mod;
 }
 
 auto Sorcery::Dice::roll_min() const -> int {
 
-	return dice + mod;
+	return static_cast<int>(dice) + mod;
 }
 
 auto Sorcery::Dice::roll_max() const -> int {
 
-	return (num * dice) + mod;
+	return static_cast<int>(num * dice) + mod;
+}
+
+auto Sorcery::Dice::mean() const -> double {
+
+	if (dice == 0)
+		return 0;
+
+	return (num * (dice + 1) / 2.0) + mod;
 }
 
 auto Sorcery::Dice::str() const -> std::string {
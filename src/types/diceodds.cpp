@@ -0,0 +1,123 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "types/diceodds.hpp"
+
+#include <algorithm>
+
+Sorcery::DiceOdds::DiceOdds(const Dice &dice) : _min{0}, _odds{1.0} {
+
+	_add(dice);
+	_finish();
+}
+
+Sorcery::DiceOdds::DiceOdds(std::span<const Dice> dice)
+	: _min{0},
+	  _odds{1.0} {
+
+	for (const auto &each : dice)
+		_add(each);
+	_finish();
+}
+
+// A roll is one die multiplied by the number of dice (see Dice::roll), so it
+// spreads every total so far evenly over (sides) totals, (num) apart
+auto Sorcery::DiceOdds::_add(const Dice &dice) -> void {
+
+	if (dice.dice == 0)
+		return;
+
+	_min += dice.mod;
+	if (dice.num == 0)
+		return;
+
+	const auto sides{static_cast<std::size_t>(dice.dice)};
+	const auto step{static_cast<std::size_t>(dice.num)};
+	std::vector<double> odds(_odds.size() + ((sides - 1) * step), 0.0);
+	for (auto total = 0uz; total < _odds.size(); total++)
+		for (auto face = 0uz; face < sides; face++)
+			odds[total + (face * step)] +=
+				_odds[total] / static_cast<double>(sides);
+	_odds = std::move(odds);
+	_min += static_cast<int>(dice.num);
+}
+
+auto Sorcery::DiceOdds::_finish() -> void {
+
+	_cumulative.resize(_odds.size());
+	auto sum{0.0};
+	for (auto total = 0uz; total < _odds.size(); total++) {
+		sum += _odds[total];
+		_cumulative[total] = sum;
+	}
+}
+
+auto Sorcery::DiceOdds::min() const -> int {
+
+	return _min;
+}
+
+auto Sorcery::DiceOdds::max() const -> int {
+
+	return _min + static_cast<int>(_odds.size()) - 1;
+}
+
+auto Sorcery::DiceOdds::mean() const -> double {
+
+	auto result{0.0};
+	for (auto total = 0uz; total < _odds.size(); total++)
+		result += static_cast<double>(total) * _odds[total];
+
+	return result + _min;
+}
+
+// Chance of rolling exactly this total
+auto Sorcery::DiceOdds::chance(const int total) const -> double {
+
+	if (total < min() || total > max())
+		return 0.0;
+
+	return _odds[static_cast<std::size_t>(total - _min)];
+}
+
+// Chance of rolling this total or more (e.g. damage >= the HP left)
+auto Sorcery::DiceOdds::at_least(const int total) const -> double {
+
+	if (total <= min())
+		return 1.0;
+	if (total > max())
+		return 0.0;
+
+	return std::max(
+		0.0, 1.0 - _cumulative[static_cast<std::size_t>(total - _min - 1)]);
+}
+
+// Lowest total that this fraction of rolls come to or less (0.5 the median)
+auto Sorcery::DiceOdds::percentile(const double fraction) const -> int {
+
+	const auto it{std::ranges::lower_bound(_cumulative, fraction - 1e-12)};
+	if (it == _cumulative.end())
+		return max();
+
+	return _min + static_cast<int>(it - _cumulative.begin());
+}
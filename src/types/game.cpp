@@ -30,11 +30,66 @@
 #include "resources/filestore.hpp"
 #include "resources/itemstore.hpp"
 #include "resources/levelstore.hpp"
+#include "resources/savepayload.hpp"
 #include "resources/savestore.hpp"
+#include "resources/savewriter.hpp"
 #include "types/meta.hpp"
 #include "types/scopedtimer.hpp"
 #include "types/state.hpp"
 
+#include <span>
+#include <spanstream>
+
+namespace {
+
+// Payloads are binary now, but saves that were migrated from the older format
+// still hold XML until they are next written
+auto is_xml(const std::string &data) -> bool {
+
+	return data.starts_with("<?xml");
+}
+
+// Serialised straight into the payload, deflating it as it goes
+template <typename T>
+auto to_payload(const T &value, const bool compress) -> Sorcery::SavePayload {
+
+	Sorcery::PayloadStream stream{compress};
+	{
+		cereal::BinaryOutputArchive archive(stream);
+		archive(value);
+	}
+
+	return stream.finish();
+}
+
+// Only the checksum, to tell whether something needs saving at all
+template <typename T> auto checksum_of(const T &value) -> std::uint64_t {
+
+	Sorcery::PayloadStream stream{false, false};
+	{
+		cereal::BinaryOutputArchive archive(stream);
+		archive(value);
+	}
+
+	return stream.finish().checksum;
+}
+
+// Read in place, rather than copying the payload into a stringstream first
+template <typename T>
+auto from_payload(const std::string &data, T &value) -> void {
+
+	std::ispanstream ss{std::span{data}};
+	if (is_xml(data)) {
+		cereal::XMLInputArchive archive(ss);
+		archive(value);
+	} else {
+		cereal::BinaryInputArchive archive(ss);
+		archive(value);
+	}
+}
+
+}
+
 Sorcery::Game::Game(Context &ctx)
 	: _ctx{ctx} {
 
@@ -83,6 +138,8 @@ auto Sorcery::Game::reset() -> void {
 
 auto Sorcery::Game::wipe_data() -> void {
 
+	_ctx.writer->flush();
+	_ctx.writer->discard();
 	_ctx.saves->wipe_data();
 }
 
@@ -302,9 +359,11 @@ auto Sorcery::Game::delete_character(unsigned int char_id) -> void {
 		return;
 
 	characters.erase(char_id);
+	_saved.erase(char_id);
 
 	save_game();
 
+	_ctx.writer->flush();
 	_ctx.saves->delete_character(_id, char_id);
 }
 
@@ -314,6 +373,7 @@ auto Sorcery::Game::_clear() -> void {
 	state.reset();
 	characters.clear();
 	_char_ids.clear();
+	_saved.clear();
 
 	state = std::make_unique<State>(&_ctx);
 
@@ -324,23 +384,24 @@ auto Sorcery::Game::_clear() -> void {
 }
 
 auto Sorcery::Game::_create_game() -> void {
+
+	_ctx.writer->flush();
+	_ctx.writer->discard();
 	_clear();
 
-	std::stringstream ss;
-	{
-		cereal::XMLOutputArchive out_archive(ss);
-		state->add_log_message("New Game Started",
-							   Enums::Internal::MessageType::GAME);
-		out_archive(state);
-	}
-	const auto data{ss.str()};
+	state->erase_log_journal();
+	state->add_log_message("New Game Started",
+						   Enums::Internal::MessageType::GAME);
 
 	_key = GUID();
-	_id = _ctx.saves->create_game_state(_key, data);
+	_id = _ctx.saves->create_game_state(
+		_key, to_payload(state, _ctx.saves->compress));
 }
 
 auto Sorcery::Game::_load_game() -> void {
 
+	_ctx.writer->flush();
+
 	// Get Game and State Data
 	auto [id, key, status, start_time, last_time, data] =
 		_ctx.saves->load_game_state().value();
@@ -351,17 +412,18 @@ auto Sorcery::Game::_load_game() -> void {
 	_last_time = last_time;
 	state = std::make_unique<State>();
 	if (data.length() > 0) {
-		std::stringstream ss;
-		ss.str(data);
-		{
-			cereal::XMLInputArchive in_archive(ss);
-			in_archive(state);
-			state->set(&_ctx);
-		}
+		from_payload(data, state);
+		state->set(&_ctx);
 	}
 
 	// And load the associated characters
-	_load_characters();
+	const auto legacy_characters{_load_characters()};
+
+	// Rewrite anything still in the older format straight away
+	if (is_xml(data) || legacy_characters) {
+		DEBUG_LOG("Migrating Game to binary saves");
+		_save_game();
+	}
 }
 
 auto Sorcery::Game::pass_turn(unsigned int turns) -> void {
@@ -394,33 +456,45 @@ auto Sorcery::Game::get_console_status() const -> bool {
 	return _show_console;
 }
 
+// Serialising and deflating are quick, so are done here, whilst writing it all
+// to disk is left to the SaveWriter thread
 auto Sorcery::Game::_save_game() -> void {
 
-	std::stringstream ss;
-	{
-		cereal::XMLOutputArchive archive(ss);
-		archive(state);
-	}
-	auto data{ss.str()};
+	state->flush_log_journal();
+	SaveWriter::Snapshot snapshot{
+		.game_id = _id,
+		.key = _key,
+		.state = to_payload(state, _ctx.saves->compress),
+		.characters = _save_characters()};
 
-	_ctx.saves->save_game_state(_id, _key, data);
-	_save_characters();
+	_ctx.writer->submit(std::move(snapshot));
 }
 
-auto Sorcery::Game::_save_characters() -> void {
-	for (const auto &[char_id, character] : characters) {
+// Only characters that have changed since they were last loaded or written
+// go to disk - with a large roster almost all of them will be unchanged
+auto Sorcery::Game::_save_characters()
+	-> std::map<unsigned int, SaveWriter::Character> {
 
-		_update_party_location();
-		std::stringstream ss;
-		{
-			cereal::XMLOutputArchive out_archive(ss);
-			out_archive(character);
-		}
-		const auto char_data{ss.str()};
+	_update_party_location();
+
+	std::map<unsigned int, SaveWriter::Character> changed{};
+	for (const auto &[char_id, character] : characters) {
+		const auto digest{checksum_of(character)};
+		if (const auto it{_saved.find(char_id)};
+			it != _saved.end() && it->second == digest)
+			continue;
 
-		_ctx.saves->update_character(_id, char_id, character.get_name(),
-									 char_data);
+		changed.emplace(char_id,
+						SaveWriter::Character{
+							character.get_name(),
+							to_payload(character, _ctx.saves->compress)});
+		_saved.insert_or_assign(char_id, digest);
 	}
+
+	DEBUG_LOGF("Saving {} of {} characters", changed.size(),
+			   characters.size());
+
+	return changed;
 }
 
 auto Sorcery::Game::has_party_in_maze() const -> bool {
@@ -461,51 +535,55 @@ auto Sorcery::Game::get_characters_at_loc() const -> std::vector<unsigned int> {
 
 auto Sorcery::Game::save_character(Character character) -> unsigned int {
 
-	std::stringstream ss;
-	{
-		cereal::XMLOutputArchive out_archive(ss);
-		out_archive(character);
-	}
-	const auto char_data{ss.str()};
+	_ctx.writer->flush();
+
+	const auto payload{to_payload(character, _ctx.saves->compress)};
+	const auto char_id{
+		_ctx.saves->add_character(_id, character.get_name(), payload)};
+	_saved.insert_or_assign(char_id, payload.checksum);
 
-	return _ctx.saves->add_character(_id, character.get_name(), char_data);
+	return char_id;
 }
 
 auto Sorcery::Game::update_character(unsigned int game_id, unsigned int char_id,
 									 Character &character) -> bool {
 
-	std::stringstream ss;
-	{
-		cereal::XMLOutputArchive out_archive(ss);
-		out_archive(character);
-	}
-	const auto character_data{ss.str()};
+	_ctx.writer->flush();
+
+	const auto payload{to_payload(character, _ctx.saves->compress)};
+	const auto updated{_ctx.saves->update_character(
+		game_id, char_id, character.get_name(), payload)};
+	if (updated && game_id == _id)
+		_saved.insert_or_assign(char_id, payload.checksum);
 
-	return _ctx.saves->update_character(game_id, char_id, character.get_name(),
-										character_data);
+	return updated;
 }
 
-auto Sorcery::Game::_load_characters() -> void {
+// Returns whether any of the characters were saved in the older format
+auto Sorcery::Game::_load_characters() -> bool {
 
 	_char_ids.clear();
 	_char_ids = _ctx.saves->get_character_ids(_id);
 	characters.clear();
+	_saved.clear();
 
+	auto legacy{false};
 	for (auto char_id : _char_ids) {
 
 		const auto data{_ctx.saves->get_character(_id, char_id)};
-		std::stringstream ss;
-		ss.str(data);
+		if (is_xml(data))
+			legacy = true;
+		else
+			_saved.insert_or_assign(char_id, fnv1a(data));
 
 		Character character(&_ctx);
-		{
-			cereal::XMLInputArchive in_archive(ss);
-			in_archive(character);
-		}
+		from_payload(data, character);
 		character.create_spells();
 		character.set_spells();
 		characters[char_id] = character;
 	}
+
+	return legacy;
 }
 
 auto Sorcery::Game::get_party_alignment() const -> Enums::Character::Align {
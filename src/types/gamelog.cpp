@@ -0,0 +1,286 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "types/gamelog.hpp"
+#include "core/debug.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+auto put_u32(std::string &output, const std::uint32_t value) -> void {
+
+	for (auto i = 0u; i < 4; i++)
+		output.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+auto put_u64(std::string &output, const std::uint64_t value) -> void {
+
+	for (auto i = 0u; i < 8; i++)
+		output.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+}
+
+auto get_u32(const std::string &input, const std::size_t position)
+	-> std::uint32_t {
+
+	std::uint32_t value{};
+	for (auto i = 0u; i < 4; i++)
+		value |= static_cast<std::uint32_t>(
+					 static_cast<unsigned char>(input[position + i]))
+				 << (i * 8);
+
+	return value;
+}
+
+auto get_u64(const std::string &input, const std::size_t position)
+	-> std::uint64_t {
+
+	std::uint64_t value{};
+	for (auto i = 0u; i < 8; i++)
+		value |= static_cast<std::uint64_t>(
+					 static_cast<unsigned char>(input[position + i]))
+				 << (i * 8);
+
+	return value;
+}
+
+// id, type, time (in ms since the epoch) and then the text
+auto encode(const Sorcery::ConsoleMessage &message) -> std::string {
+
+	std::string body{};
+	put_u64(body, static_cast<std::uint64_t>(message.id));
+	body.push_back(static_cast<char>(message.type));
+	put_u64(body, static_cast<std::uint64_t>(
+					  std::chrono::duration_cast<std::chrono::milliseconds>(
+						  message.datetime.time_since_epoch())
+						  .count()));
+	body.append(message.text);
+
+	std::string record{};
+	put_u32(record, static_cast<std::uint32_t>(body.size()));
+	record.append(body);
+	put_u32(record, static_cast<std::uint32_t>(body.size()));
+
+	return record;
+}
+
+constexpr std::size_t HEADER_SIZE{8 + 1 + 8};
+
+auto decode(const std::string &body) -> Sorcery::ConsoleMessage {
+
+	if (body.size() < HEADER_SIZE)
+		throw std::runtime_error{"Log journal record is truncated"};
+
+	Sorcery::ConsoleMessage message{};
+	message.id = static_cast<long int>(get_u64(body, 0));
+	message.type = static_cast<Sorcery::Enums::Internal::MessageType>(body[8]);
+	message.datetime = std::chrono::system_clock::time_point{
+		std::chrono::duration_cast<std::chrono::system_clock::duration>(
+			std::chrono::milliseconds{
+				static_cast<std::int64_t>(get_u64(body, 9))})};
+	message.text = body.substr(HEADER_SIZE);
+
+	return message;
+}
+
+}
+
+Sorcery::GameLog::GameLog()
+	: _ring(CAPACITY),
+	  _head{0},
+	  _count{0},
+	  _journal_size{0},
+	  _journalled{0},
+	  _loaded{false} {
+}
+
+auto Sorcery::GameLog::add(ConsoleMessage message) -> void {
+
+	// When full, the slot about to be overwritten holds the oldest message
+	if (_count == CAPACITY)
+		_journal(_ring[_head]);
+	else
+		++_count;
+
+	_ring[_head] = std::move(message);
+	_head = (_head + 1) % CAPACITY;
+}
+
+// Note that this leaves the journal alone
+auto Sorcery::GameLog::clear() -> void {
+
+	_clear_ring();
+	_unwritten.clear();
+}
+
+// Start afresh, as for a new game
+auto Sorcery::GameLog::erase_journal() -> void {
+
+	_out.close();
+	_unwritten.clear();
+	_journal_size = 0;
+	_journalled = 0;
+
+	if (!_path.empty()) {
+		std::error_code error{};
+		std::filesystem::remove(_path, error);
+	}
+}
+
+// Make sure everything journalled so far is on disc, as a save made after this
+// will expect to find it there
+auto Sorcery::GameLog::flush() -> void {
+
+	_out.flush();
+}
+
+// Nothing is read from the journal here - but if this log was loaded from a
+// save, anything journalled since that save was made is dropped, as those
+// messages are either in the ring again or never happened
+auto Sorcery::GameLog::open(const std::filesystem::path &journal) -> void {
+
+	_out.close();
+	_path = journal;
+
+	// A journal that was never written to (and so doesn't exist) is fine
+	std::error_code error{};
+	if (_loaded) {
+		const auto size{std::filesystem::exists(_path, error)
+							? std::filesystem::file_size(_path, error)
+							: 0};
+		if (!error && size > _journal_size)
+			std::filesystem::resize_file(_path, _journal_size, error);
+		else if (error || size < _journal_size) {
+
+			// Missing or damaged, so whatever it held has gone
+			DEBUG_LOGF("Log journal {} is shorter than expected",
+					   _path.string());
+			std::filesystem::remove(_path, error);
+			_journal_size = 0;
+			_journalled = 0;
+		}
+	}
+
+	for (const auto &message : std::exchange(_unwritten, {}))
+		_journal(message);
+}
+
+auto Sorcery::GameLog::size() const -> std::size_t {
+
+	return _count;
+}
+
+auto Sorcery::GameLog::journalled() const -> std::size_t {
+
+	return _journalled;
+}
+
+// Index 0 is the oldest message still in memory
+auto Sorcery::GameLog::operator[](const std::size_t index) const
+	-> const ConsoleMessage & {
+
+	return _ring[(_head + CAPACITY - _count + index) % CAPACITY];
+}
+
+// The last count messages (or all of them if count is 0), oldest first
+auto Sorcery::GameLog::recent(std::size_t count) const
+	-> std::vector<ConsoleMessage> {
+
+	if (count == 0 || count > _count)
+		count = _count;
+
+	std::vector<ConsoleMessage> messages{};
+	messages.reserve(count);
+	for (auto i = _count - count; i < _count; i++)
+		messages.emplace_back((*this)[i]);
+
+	return messages;
+}
+
+// Read up to count messages back from the journal, skipping the newest skip
+// of them, and return them oldest first
+auto Sorcery::GameLog::page(const std::size_t skip, const std::size_t count)
+	-> std::vector<ConsoleMessage> {
+
+	std::vector<ConsoleMessage> messages{};
+	if (_path.empty() || skip >= _journalled)
+		return messages;
+
+	_out.flush();
+	std::ifstream input{_path, std::ios::binary};
+	if (!input)
+		return messages;
+
+	std::string buffer{};
+	auto end{_journal_size};
+	for (auto i = 0u; i < skip + count && i < _journalled && end >= 8; i++) {
+		buffer.resize(4);
+		input.seekg(static_cast<std::streamoff>(end - 4));
+		input.read(buffer.data(), 4);
+		const auto length{get_u32(buffer, 0)};
+		if (!input || end < length + 8u)
+			break;
+
+		const auto start{end - length - 8};
+		if (i >= skip) {
+			buffer.resize(length);
+			input.seekg(static_cast<std::streamoff>(start + 4));
+			input.read(buffer.data(), length);
+			if (!input)
+				break;
+			messages.emplace_back(decode(buffer));
+		}
+		end = start;
+	}
+
+	std::ranges::reverse(messages);
+
+	return messages;
+}
+
+auto Sorcery::GameLog::_clear_ring() -> void {
+
+	std::ranges::fill(_ring, ConsoleMessage{});
+	_head = 0;
+	_count = 0;
+}
+
+auto Sorcery::GameLog::_journal(const ConsoleMessage &message) -> void {
+
+	if (_path.empty()) {
+		_unwritten.emplace_back(message);
+		return;
+	}
+
+	if (!_out.is_open())
+		_out.open(_path, std::ios::binary | std::ios::app);
+
+	const auto record{encode(message)};
+	_out.write(record.data(), static_cast<std::streamsize>(record.size()));
+	_journal_size += record.size();
+	++_journalled;
+}
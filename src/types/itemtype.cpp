@@ -30,22 +30,27 @@
 std::random_device Sorcery::ItemType::_device;
 std::mt19937_64 Sorcery::ItemType::_random(_device());
 
+auto Sorcery::ItemType::seed(const std::uint64_t value) -> void {
+
+	_random.seed(value);
+}
+
 auto Sorcery::ItemType::get_type_id() const -> Enums::Items::TypeID {
 
 	return _type;
 }
 
-auto Sorcery::ItemType::get_known_name() const -> std::string {
+auto Sorcery::ItemType::get_known_name() const -> const std::string & {
 
 	return _known_name;
 }
 
-auto Sorcery::ItemType::get_display_name() const -> std::string {
+auto Sorcery::ItemType::get_display_name() const -> const std::string & {
 
 	return _display_name;
 }
 
-auto Sorcery::ItemType::get_unknown_name() const -> std::string {
+auto Sorcery::ItemType::get_unknown_name() const -> const std::string & {
 
 	return _unknown_name;
 }
@@ -50,7 +50,9 @@ Sorcery::Level::Level(const Level &other)
 	  _dungeon{other._dungeon},
 	  _depth{other._depth},
 	  _bottom_left{other._bottom_left},
-	  _size{other._size} {
+	  _size{other._size},
+	  _cleared{other._cleared},
+	  _stored{other._stored} {
 
 	_tiles = other._tiles;
 }
@@ -63,6 +65,8 @@ auto Sorcery::Level::operator=(const Level &other) -> Level & {
 	_bottom_left = other._bottom_left;
 	_size = other._size;
 	_tiles = other._tiles;
+	_cleared = other._cleared;
+	_stored = other._stored;
 
 	return *this;
 }
@@ -75,6 +79,8 @@ auto Sorcery::Level::operator[](Coordinate loc) -> Tile & {
 auto Sorcery::Level::reset() -> void {
 
 	_create();
+	_cleared.clear();
+	_stored = false;
 }
 
 auto Sorcery::Level::depth() const -> int {
@@ -141,6 +147,8 @@ auto Sorcery::Level::load(const Json::Value row_data,
 	_set_complicated_walls(row_data);
 	_load_markers(row_data);
 	_load_metadata(note_data);
+	_cleared.clear();
+	_stored = true;
 
 	return true;
 }
@@ -153,6 +161,8 @@ auto Sorcery::Level::set(const Level *other) -> void {
 	_bottom_left = other->_bottom_left;
 	_size = other->_size;
 	_tiles = other->_tiles;
+	_cleared = other->_cleared;
+	_stored = other->_stored;
 }
 
 auto Sorcery::Level::at(const Coordinate loc) -> Tile & {
@@ -304,7 +314,50 @@ auto Sorcery::Level::_add_event_mappings() -> void {
 }
 
 auto Sorcery::Level::clear_event(const Coordinate loc) -> void {
+
 	_tiles.at(loc).clear_event();
+	_cleared.insert(loc);
+}
+
+auto Sorcery::Level::delta() const -> LevelDelta {
+
+	LevelDelta delta{.depth = _stored ? std::optional<int>{_depth}
+									  : std::nullopt,
+					 .cleared = {_cleared.begin(), _cleared.end()},
+					 .items = {}};
+	for (const auto &[loc, tile] : _tiles)
+		if (!tile.items.empty())
+			delta.items.emplace(loc, tile.items);
+
+	return delta;
+}
+
+// Work out what has changed on a floor that was saved whole, by comparing it
+// with the same floor fresh from the store
+auto Sorcery::Level::rebase(const Level &pristine) -> void {
+
+	if (_dungeon != pristine._dungeon || _depth != pristine._depth ||
+		_size.w != pristine._size.w || _size.h != pristine._size.h)
+		return;
+
+	for (const auto &[loc, tile] : pristine._tiles)
+		if (tile.has_event() && _tiles.contains(loc) &&
+			!_tiles.at(loc).has_event())
+			_cleared.insert(loc);
+
+	_stored = true;
+}
+
+// Replay a delta on top of the same floor, fresh from the store
+auto Sorcery::Level::apply(const LevelDelta &delta) -> void {
+
+	for (const auto loc : delta.cleared)
+		if (_tiles.contains(loc))
+			clear_event(loc);
+
+	for (const auto &[loc, items] : delta.items)
+		if (_tiles.contains(loc))
+			_tiles.at(loc).items = items;
 }
 
 auto Sorcery::Level::_load_metadata(const Json::Value note_data) -> bool {
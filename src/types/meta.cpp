@@ -25,9 +25,15 @@
 #include "core/enum.hpp"
 #include "types/enum.hpp"
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <functional>
+#include <limits>
 #include <meta>
+#include <numeric>
 #include <utility>
+#include <vector>
 
 namespace Sorcery {
 
@@ -54,22 +60,221 @@ namespace {
 	template <Enum E>
 	inline constexpr auto enum_entries{make_enum_entries<E>()};
 
+	inline constexpr auto NO_ENTRY{std::numeric_limits<std::uint16_t>::max()};
+
+	template <Enum E> constexpr auto enum_value(E value) -> std::intmax_t {
+
+		return static_cast<std::intmax_t>(std::to_underlying(value));
+	}
+
+	//
+	// Value to entry: an enum whose values are contiguous (allowing for the
+	// odd NO_X = -1 and gap) indexes a table by the value itself
+	//
+
+	template <Enum E> consteval auto enum_min() -> std::intmax_t {
+
+		auto result{std::numeric_limits<std::intmax_t>::max()};
+		for (const auto &entry : enum_entries<E>)
+			result = std::min(result, enum_value(entry.first));
+
+		return enum_entries<E>.empty() ? 0 : result;
+	}
+
+	// Size of the table, or 0 if the values are too spread out for one
+	template <Enum E> consteval auto enum_span() -> std::size_t {
+
+		auto max{std::numeric_limits<std::intmax_t>::min()};
+		for (const auto &entry : enum_entries<E>)
+			max = std::max(max, enum_value(entry.first));
+
+		const auto count{enum_entries<E>.size()};
+		if (count == 0 || max - enum_min<E>() >= std::intmax_t(count * 2 + 8))
+			return 0;
+
+		return static_cast<std::size_t>(max - enum_min<E>() + 1);
+	}
+
+	// Where enumerators share a value, the first of them is its name
+	template <Enum E> consteval auto make_enum_index() {
+
+		std::array<std::uint16_t, enum_span<E>()> index{};
+		index.fill(NO_ENTRY);
+		for (auto i = 0uz; i < enum_entries<E>.size(); i++) {
+			auto &slot{index[static_cast<std::size_t>(
+				enum_value(enum_entries<E>[i].first) - enum_min<E>())]};
+			if (slot == NO_ENTRY)
+				slot = static_cast<std::uint16_t>(i);
+		}
+
+		return index;
+	}
+
+	template <Enum E> inline constexpr auto enum_index{make_enum_index<E>()};
+
+	//
+	// Name (and the values of a sparse enum) to entry: a perfect hash, built
+	// by "hash and displace". Keys are spread into buckets by one hash, and
+	// each bucket (biggest first) is then given the displacement which moves
+	// all of its keys into empty slots. A lookup is one hash of the key, two
+	// table reads and a comparison to reject anything that isn't a key
+	//
+
+	constexpr auto mix(std::uint64_t value) -> std::uint64_t {
+
+		value ^= value >> 33;
+		value *= 0xff51afd7ed558ccdull;
+		value ^= value >> 33;
+		value *= 0xc4ceb9fe1a85ec53ull;
+		value ^= value >> 33;
+
+		return value;
+	}
+
+	constexpr auto key_hash(std::string_view key) -> std::uint64_t {
+
+		auto hash{14695981039346656037ull};
+		for (const auto c : key) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	constexpr auto key_hash(std::intmax_t key) -> std::uint64_t {
+
+		return static_cast<std::uint64_t>(key);
+	}
+
+	template <std::size_t N> struct PerfectHash {
+
+			static constexpr auto SIZE{std::bit_ceil(std::max(N * 2, 2uz))};
+
+			std::array<std::uint64_t, SIZE> displacements{};
+			std::array<std::uint16_t, SIZE> entries{};
+
+			constexpr auto find(const std::uint64_t hash) const
+				-> std::size_t {
+
+				const auto displacement{displacements[mix(hash) & (SIZE - 1)]};
+
+				return entries[mix(hash ^ displacement) & (SIZE - 1)];
+			}
+	};
+
+	template <typename Key, std::size_t N>
+	consteval auto make_perfect_hash(const std::array<Key, N> &keys) {
+
+		static_assert(N < NO_ENTRY);
+		using Hash = PerfectHash<N>;
+		Hash result{};
+		result.entries.fill(NO_ENTRY);
+
+		// Names are unique, but where values are aliased only the first
+		// enumerator with each is kept
+		std::vector<std::vector<std::uint16_t>> buckets(Hash::SIZE);
+		for (auto i = 0uz; i < N; i++) {
+			if constexpr (std::integral<Key>)
+				if (std::ranges::contains(keys.begin(), keys.begin() + i,
+										  keys[i]))
+					continue;
+			buckets[mix(key_hash(keys[i])) & (Hash::SIZE - 1)].push_back(
+				static_cast<std::uint16_t>(i));
+		}
+
+		std::vector<std::size_t> order(Hash::SIZE);
+		std::iota(order.begin(), order.end(), 0uz);
+		std::ranges::sort(order, std::greater{},
+						  [&](std::size_t b) { return buckets[b].size(); });
+
+		for (const auto bucket : order) {
+			if (buckets[bucket].empty())
+				break;
+
+			for (auto seed = 1ull;; seed++) {
+				if (seed > 1'000'000)
+					throw "Unable to build a perfect hash for this enum";
+
+				const auto displacement{mix(seed)};
+				std::vector<std::size_t> slots;
+				for (const auto entry : buckets[bucket]) {
+					const auto slot{mix(key_hash(keys[entry]) ^ displacement) &
+									(Hash::SIZE - 1)};
+					if (result.entries[slot] != NO_ENTRY ||
+						std::ranges::contains(slots, slot))
+						break;
+					slots.push_back(slot);
+				}
+				if (slots.size() < buckets[bucket].size())
+					continue;
+
+				for (auto i = 0uz; i < slots.size(); i++)
+					result.entries[slots[i]] = buckets[bucket][i];
+				result.displacements[bucket] = displacement;
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	template <Enum E> consteval auto make_enum_names() {
+
+		std::array<std::string_view, enum_entries<E>.size()> names{};
+		for (auto i = 0uz; i < names.size(); i++)
+			names[i] = enum_entries<E>[i].second;
+
+		return make_perfect_hash(names);
+	}
+
+	template <Enum E> consteval auto make_enum_values() {
+
+		std::array<std::intmax_t, enum_entries<E>.size()> values{};
+		for (auto i = 0uz; i < values.size(); i++)
+			values[i] = enum_value(enum_entries<E>[i].first);
+
+		return make_perfect_hash(values);
+	}
+
+	template <Enum E> inline constexpr auto enum_names{make_enum_names<E>()};
+
+	template <Enum E> inline constexpr auto enum_values{make_enum_values<E>()};
+
+	template <Enum E> auto find_entry(std::intmax_t value) -> std::size_t {
+
+		if constexpr (enum_span<E>() > 0) {
+			if (value < enum_min<E>() ||
+				value - enum_min<E>() >= std::intmax_t(enum_span<E>()))
+				return NO_ENTRY;
+
+			return enum_index<E>[static_cast<std::size_t>(
+				value - enum_min<E>())];
+		} else {
+			const auto entry{enum_values<E>.find(key_hash(value))};
+			if (entry == NO_ENTRY ||
+				enum_value(enum_entries<E>[entry].first) != value)
+				return NO_ENTRY;
+
+			return entry;
+		}
+	}
+
 } // namespace
 
 template <Enum E> auto enum_name(E value) -> std::string_view {
 
-	for (const auto &[enum_value, name] : enum_entries<E>)
-		if (enum_value == value)
-			return name;
+	if (const auto entry{find_entry<E>(enum_value(value))}; entry != NO_ENTRY)
+		return enum_entries<E>[entry].second;
 
 	return {};
 }
 
 template <Enum E> auto enum_cast(std::string_view name) -> std::optional<E> {
 
-	for (const auto &[enum_value, enum_name] : enum_entries<E>)
-		if (enum_name == name)
-			return enum_value;
+	if (const auto entry{enum_names<E>.find(key_hash(name))};
+		entry != NO_ENTRY && enum_entries<E>[entry].second == name)
+		return enum_entries<E>[entry].first;
 
 	return std::nullopt;
 }
@@ -77,9 +282,8 @@ template <Enum E> auto enum_cast(std::string_view name) -> std::optional<E> {
 template <Enum E>
 auto enum_cast_signed(std::intmax_t value) -> std::optional<E> {
 
-	for (const auto &entry : enum_entries<E>)
-		if (std::cmp_equal(std::to_underlying(entry.first), value))
-			return entry.first;
+	if (const auto entry{find_entry<E>(value)}; entry != NO_ENTRY)
+		return enum_entries<E>[entry].first;
 
 	return std::nullopt;
 }
@@ -87,11 +291,10 @@ auto enum_cast_signed(std::intmax_t value) -> std::optional<E> {
 template <Enum E>
 auto enum_cast_unsigned(std::uintmax_t value) -> std::optional<E> {
 
-	for (const auto &entry : enum_entries<E>)
-		if (std::cmp_equal(std::to_underlying(entry.first), value))
-			return entry.first;
+	if (!std::in_range<std::intmax_t>(value))
+		return std::nullopt;
 
-	return std::nullopt;
+	return enum_cast_signed<E>(static_cast<std::intmax_t>(value));
 }
 
 #define INSTANTIATE_ENUM(E)                                                    \
@@ -27,6 +27,11 @@
 std::random_device Sorcery::MonsterType::_device;
 std::mt19937_64 Sorcery::MonsterType::_random(_device());
 
+auto Sorcery::MonsterType::seed(const std::uint64_t value) -> void {
+
+	_random.seed(value);
+}
+
 auto Sorcery::MonsterType::get_type_id() const -> Enums::Monsters::TypeID {
 
 	return _type;
@@ -0,0 +1,101 @@
+// Copyright (C) 2026 Dave Moore
+//
+// This file is part of Sorcery.
+//
+// Sorcery is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Sorcery is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+// A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Sorcery.  If not, see <http://www.gnu.org/licenses/>.
+//
+// If you modify this program, or any covered work, by linking or combining
+// it with the libraries referred to in README (or a modified version of
+// said libraries), containing parts covered by the terms of said libraries,
+// the licensors of this program grant you additional permission to convey
+// the resulting work.
+
+
+#include "types/property.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <climits>
+#include <cstdlib>
+
+namespace Sorcery {
+
+// Properties that the UI reads as numbers or flags - anything else is only
+// ever used as text and so is accepted as-is
+static constexpr std::array<std::string_view, 20> NUMBER_PROPERTIES{
+	"adjust_x",	  "adjust_y",	"button_y",		"capacity",
+	"grid_width", "height",		"highlight",	"input_width",
+	"number",	  "offset_x",	"offset_y",		"row_gap",
+	"scale",	  "spacing_x",	"spacing_y",	"tile_height",
+	"tile_size",  "tile_spacing", "tile_width", "width"};
+static constexpr std::array<std::string_view, 2> BOOLEAN_PROPERTIES{
+	"dynamic", "numeric_input"};
+
+}
+
+auto Sorcery::Property::kind_of(std::string_view key) -> PropertyKind {
+
+	if (std::ranges::find(NUMBER_PROPERTIES, key) != NUMBER_PROPERTIES.end())
+		return PropertyKind::NUMBER;
+	else if (std::ranges::find(BOOLEAN_PROPERTIES, key) !=
+			 BOOLEAN_PROPERTIES.end())
+		return PropertyKind::BOOLEAN;
+	else
+		return PropertyKind::TEXT;
+}
+
+// Values are parsed the same way std::stoi/std::stof used to at draw time
+// (so "0x6060c8" is still a valid float), except that the whole of the value
+// must now be consumed; returns nothing if the value is not valid for the kind
+// of property it is
+auto Sorcery::Property::parse(const PropertyId &key, std::string_view value)
+	-> std::optional<Property> {
+
+	Property property{.id = key.id(),
+					  .text = std::string{value},
+					  .numeric = false,
+					  .integer = 0,
+					  .number = 0.0f,
+					  .boolean = value == "true"};
+
+	if (!property.text.empty()) {
+		const auto *first{property.text.c_str()};
+		char *last{nullptr};
+		const auto number{std::strtof(first, &last)};
+		if (last == first + property.text.size()) {
+			property.numeric = true;
+			property.number = number;
+			const auto end{first + property.text.size()};
+			if (std::from_chars(first, end, property.integer).ptr != end)
+				property.integer = static_cast<int>(std::clamp(
+					static_cast<double>(number), static_cast<double>(INT_MIN),
+					static_cast<double>(INT_MAX)));
+		}
+	}
+
+	switch (kind_of(key.key())) {
+	case PropertyKind::NUMBER:
+		if (!property.numeric)
+			return std::nullopt;
+		break;
+	case PropertyKind::BOOLEAN:
+		if (value != "true" && value != "false")
+			return std::nullopt;
+		break;
+	default:
+		break;
+	}
+
+	return property;
+}
@@ -23,10 +23,15 @@
 #include "types/state.hpp"
 #include "common/enum.hpp"
 #include "core/context.hpp"
+#include "core/resources.hpp"
 #include "core/system.hpp"
 #include "resources/itemstore.hpp"
+#include "resources/levelstore.hpp"
+#include "resources/savestore.hpp"
 #include "types/meta.hpp"
 
+#include <utility>
+
 using namespace std::literals;
 
 // Constructor used by Cereal to serialise this item
@@ -38,6 +43,7 @@ Sorcery::State::State(Context *ctx)
 
 	_clear();
 	_restart_expedition();
+	_log.open(_ctx->saves->journal_file());
 }
 
 auto Sorcery::State::reset_shop(ItemStore *itemstore) -> void {
@@ -77,7 +83,7 @@ auto Sorcery::State::_clear() -> void {
 	level.reset();
 	level = std::make_unique<Level>();
 	_clear_explored();
-	_version = 1;
+	_version = VERSION;
 	_turns = 0;
 
 	_log.clear();
@@ -166,6 +172,27 @@ auto Sorcery::State::post_construct(Context *ctx) -> void {
 auto Sorcery::State::set(Context *ctx) -> void {
 
 	_ctx = ctx;
+	_restore_floor();
+	_log.open(_ctx->saves->journal_file());
+}
+
+// Put the floor back together from the store and the changes that were saved
+auto Sorcery::State::_restore_floor() -> void {
+
+	// Older saves have the floor as it was, so it only needs comparing with
+	// the store to find out what has changed on it
+	if (std::exchange(_rebase_floor, false))
+		if (const auto pristine{_ctx->resources->levels->get(level->depth())})
+			level->rebase(pristine.value());
+
+	if (!_floor)
+		return;
+
+	if (_floor->depth)
+		if (const auto pristine{_ctx->resources->levels->get(*_floor->depth)})
+			level->set(&pristine.value());
+	level->apply(_floor.value());
+	_floor.reset();
 }
 
 auto Sorcery::State::set_party(std::vector<unsigned int> candidate_party)
@@ -328,7 +355,7 @@ auto Sorcery::State::add_log_message(
 	Enums::Internal::MessageType type = Enums::Internal::MessageType::STANDARD)
 	-> void {
 
-	_log.emplace_back(ConsoleMessage{type, text});
+	_log.add(ConsoleMessage{type, text});
 }
 
 auto Sorcery::State::clear_log_messages() -> void {
@@ -350,18 +377,21 @@ auto Sorcery::State::add_log_dice_roll(const std::string &message,
 		add_log_message(message, Enums::Internal::MessageType::GAME);
 }
 
+// Only covers what is still in memory - older messages are in the journal
 auto Sorcery::State::get_log_messages(unsigned int last) const
 	-> std::vector<ConsoleMessage> {
 
-	if (last == 0)
-		return _log;
-	else {
-		if (_log.size() < last)
-			last = _log.size();
+	return _log.recent(last);
+}
 
-		std::vector<ConsoleMessage> results{_log.cend() - last, _log.cend()};
-		return results;
-	}
+auto Sorcery::State::flush_log_journal() -> void {
+
+	_log.flush();
+}
+
+auto Sorcery::State::erase_log_journal() -> void {
+
+	_log.erase_journal();
 }
 
 auto Sorcery::State::check_shop_stock(